@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.20;
+
+/**
+ * @title AlgorandAddressLib
+ * @dev Text form of an Algorand address from its raw parts.
+ *
+ * An Algorand address is base32 (RFC 4648, no padding) over 36 bytes: the
+ * 32-byte account public key followed by a 4-byte checksum, the last four bytes
+ * of SHA-512/256(publicKey). The EVM has no SHA-512/256, so callers pass the
+ * checksum; a wrong one just yields a different address, which a signature over
+ * the text form then rejects.
+ *
+ * The relayer-side encoder is scripts/compactLimitOrder.cjs.
+ */
+library AlgorandAddressLib {
+    bytes32 private constant ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+    uint256 internal constant ADDRESS_LENGTH = 58;
+
+    /**
+     * @dev 58-character address for `publicKey` and its `checksum`
+     */
+    function encode(bytes32 publicKey, bytes4 checksum) internal pure returns (string memory) {
+        // One zero byte of slack: the last character reads 2 bits past the checksum
+        bytes memory raw = abi.encodePacked(publicKey, checksum, bytes1(0));
+        bytes memory text = new bytes(ADDRESS_LENGTH);
+        for (uint256 i = 0; i < ADDRESS_LENGTH; ++i) {
+            uint256 bit = i * 5;
+            uint256 window = uint256(uint8(raw[bit / 8])) << 8 | uint8(raw[bit / 8 + 1]);
+            text[i] = ALPHABET[(window >> (11 - bit % 8)) & 31];
+        }
+        return string(text);
+    }
+}
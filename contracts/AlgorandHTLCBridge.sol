@@ -3,9 +3,10 @@ pragma solidity ^0.8.20;
 
 import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
-import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+import "@openzeppelin/contracts/utils/ReentrancyGuardTransient.sol";
 import "@openzeppelin/contracts/access/Ownable.sol";
 import "@openzeppelin/contracts/utils/cryptography/ECDSA.sol";
+import "./AuctionCurveLib.sol";
 
 /**
  * @title AlgorandHTLCBridge
@@ -24,7 +25,37 @@ import "@openzeppelin/contracts/utils/cryptography/ECDSA.sol";
  * - Bridge: Algorand Bridge
  * - RPC: https://mainnet-api.algonode.cloud
  */
-contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
+contract AlgorandHTLCBridge is ReentrancyGuardTransient, Ownable {
+    error NotAuthorizedRelayer();
+    error NotAuctionWinner();
+    error AuctionMismatch();
+    error InvalidRecipient();
+    error ZeroAmount();
+    error TimelockTooShort();
+    error TimelockTooLong();
+    error InvalidAlgorandChain();
+    error AlgorandAddressRequired();
+    error HTLCExists();
+    error ETHAmountMismatch();
+    error ETHNotExpected();
+    error EmptyCurve();
+    error HTLCNotFound();
+    error HTLCAlreadyExecuted();
+    error HTLCAlreadyRefunded();
+    error HTLCExpired();
+    error AuctionExists();
+    error AuctionNotFound();
+    error AuctionAlreadyFilled();
+    error AuctionExpired();
+    error AuctionEnded();
+    error GasPriceTooLow();
+    error GasPriceTooHigh();
+    error LengthMismatch();
+    error NoFeesToWithdraw();
+    error InvalidSecret();
+    error HTLCNotExpired();
+    error InvalidAuctionCurve(string reason);
+
     using SafeERC20 for IERC20;
     using ECDSA for bytes32;
 
@@ -63,7 +94,7 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
         bytes32 auctionId;
         bytes32 htlcId;
         uint256 startPrice;
-        uint256 currentPrice;
+        uint256 currentPrice; // filled in by getDutchAuction, not kept up to date in storage
         uint256 startTime;
         uint256 endTime;
         address winningRelayer;
@@ -82,8 +113,10 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
     mapping(bytes32 => HTLCContract) public htlcContracts;
     mapping(bytes32 => DutchAuction) public dutchAuctions;
     mapping(bytes32 => RelayerBid[]) public relayerBids;
+    mapping(bytes32 => uint256) public auctionCurves; // AuctionCurveLib word over MIN_GAS_PRICE; 0 = hourly decay
     mapping(address => bool) public authorizedRelayers;
-    mapping(bytes32 => bytes32) public revealedSecrets; // htlcId => secret
+    mapping(bytes32 => bytes32) public revealedSecrets; // htlcId => secret (empty in event-only mode)
+    bool public eventOnlySecrets; // secrets only in SecretRevealed logs
     mapping(address => uint256) public relayerBalances;
     
     event HTLCCreated(
@@ -121,14 +154,18 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
     event HTLCRefunded(bytes32 indexed htlcId, address initiator);
     event RelayerAuthorized(address indexed relayer, bool authorized);
     event RelayerBalanceWithdrawn(address indexed relayer, uint256 amount);
+    event SecretStorageModeSet(bool eventOnly);
+    
+    // Per-item outcome of the batch* functions (reason is the custom error selector, zero on success)
+    event HTLCBatchResult(bytes32 indexed htlcId, bool success, bytes4 reason);
     
     modifier onlyAuthorizedRelayer() {
-        require(authorizedRelayers[msg.sender] || msg.sender == owner(), "Not authorized relayer");
+        if (!authorizedRelayers[msg.sender] && msg.sender != owner()) revert NotAuthorizedRelayer();
         _;
     }
     
     modifier onlyAuctionWinner(bytes32 _auctionId) {
-        require(dutchAuctions[_auctionId].winningRelayer == msg.sender, "Not auction winner");
+        if (dutchAuctions[_auctionId].winningRelayer != msg.sender) revert NotAuctionWinner();
         _;
     }
     
@@ -150,12 +187,12 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
         string calldata _algorandToken,
         uint256 _algorandAmount
     ) external payable nonReentrant returns (bytes32 htlcId) {
-        require(_recipient != address(0), "Invalid recipient");
-        require(_amount > 0, "Amount must be > 0");
-        require(_timelock >= block.timestamp + MIN_TIMELOCK, "Timelock too short");
-        require(_timelock <= block.timestamp + MAX_TIMELOCK, "Timelock too long");
-        require(_algorandChainId == ALGORAND_MAINNET_CHAIN_ID || _algorandChainId == ALGORAND_TESTNET_CHAIN_ID, "Invalid Algorand chain");
-        require(bytes(_algorandAddress).length > 0, "Algorand address required");
+        if (_recipient == address(0)) revert InvalidRecipient();
+        if (_amount == 0) revert ZeroAmount();
+        if (_timelock < block.timestamp + MIN_TIMELOCK) revert TimelockTooShort();
+        if (_timelock > block.timestamp + MAX_TIMELOCK) revert TimelockTooLong();
+        if (_algorandChainId != ALGORAND_MAINNET_CHAIN_ID && _algorandChainId != ALGORAND_TESTNET_CHAIN_ID) revert InvalidAlgorandChain();
+        if (bytes(_algorandAddress).length == 0) revert AlgorandAddressRequired();
         
         htlcId = keccak256(abi.encodePacked(
             msg.sender,
@@ -169,12 +206,12 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
             block.timestamp
         ));
         
-        require(htlcContracts[htlcId].initiator == address(0), "HTLC exists");
+        if (htlcContracts[htlcId].initiator != address(0)) revert HTLCExists();
         
         if (_token == address(0)) {
-            require(msg.value == _amount, "ETH amount mismatch");
+            if (msg.value != _amount) revert ETHAmountMismatch();
         } else {
-            require(msg.value == 0, "ETH not expected");
+            if (msg.value != 0) revert ETHNotExpected();
             IERC20(_token).safeTransferFrom(msg.sender, address(this), _amount);
         }
         
@@ -209,11 +246,29 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
      * @dev Start Dutch auction for HTLC execution
      */
     function startDutchAuction(bytes32 _htlcId) external onlyAuthorizedRelayer returns (bytes32 auctionId) {
+        return _startDutchAuction(_htlcId, 0);
+    }
+    
+    /**
+     * @dev Start Dutch auction with a piecewise-linear gas price curve (1inch Fusion style).
+     * The price is MIN_GAS_PRICE scaled by the curve's rate bump.
+     */
+    function startDutchAuctionWithCurve(
+        bytes32 _htlcId,
+        uint256 _curve
+    ) external onlyAuthorizedRelayer returns (bytes32 auctionId) {
+        if (_curve == 0) revert EmptyCurve();
+        string memory err = AuctionCurveLib.validationError(_curve, DUTCH_AUCTION_DURATION);
+        if (bytes(err).length != 0) revert InvalidAuctionCurve(err);
+        return _startDutchAuction(_htlcId, _curve);
+    }
+    
+    function _startDutchAuction(bytes32 _htlcId, uint256 _curve) internal returns (bytes32 auctionId) {
         HTLCContract storage htlc = htlcContracts[_htlcId];
-        require(htlc.initiator != address(0), "HTLC not found");
-        require(!htlc.executed, "HTLC already executed");
-        require(!htlc.refunded, "HTLC refunded");
-        require(block.timestamp < htlc.timelock, "HTLC expired");
+        if (htlc.initiator == address(0)) revert HTLCNotFound();
+        if (htlc.executed) revert HTLCAlreadyExecuted();
+        if (htlc.refunded) revert HTLCAlreadyRefunded();
+        if (block.timestamp >= htlc.timelock) revert HTLCExpired();
         
         auctionId = keccak256(abi.encodePacked(
             _htlcId,
@@ -221,16 +276,22 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
             msg.sender
         ));
         
-        require(dutchAuctions[auctionId].auctionId == bytes32(0), "Auction exists");
+        if (dutchAuctions[auctionId].auctionId != bytes32(0)) revert AuctionExists();
         
         uint256 startTime = block.timestamp;
         uint256 endTime = startTime + DUTCH_AUCTION_DURATION;
+        uint256 startPrice = INITIAL_GAS_PRICE;
+        if (_curve != 0) {
+            startPrice = MIN_GAS_PRICE * (AuctionCurveLib.BASE_POINTS + AuctionCurveLib.initialRateBump(_curve))
+                / AuctionCurveLib.BASE_POINTS;
+            auctionCurves[auctionId] = _curve;
+        }
         
         dutchAuctions[auctionId] = DutchAuction({
             auctionId: auctionId,
             htlcId: _htlcId,
-            startPrice: INITIAL_GAS_PRICE,
-            currentPrice: INITIAL_GAS_PRICE,
+            startPrice: startPrice,
+            currentPrice: startPrice,
             startTime: startTime,
             endTime: endTime,
             winningRelayer: address(0),
@@ -242,7 +303,7 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
         emit DutchAuctionStarted(
             auctionId,
             _htlcId,
-            INITIAL_GAS_PRICE,
+            startPrice,
             startTime,
             endTime
         );
@@ -253,63 +314,136 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
      */
     function placeBid(bytes32 _auctionId, uint256 _gasPrice) external onlyAuthorizedRelayer {
         DutchAuction storage auction = dutchAuctions[_auctionId];
-        require(auction.auctionId != bytes32(0), "Auction not found");
-        require(!auction.filled, "Auction already filled");
-        require(!auction.expired, "Auction expired");
-        require(block.timestamp < auction.endTime, "Auction ended");
-        require(_gasPrice >= MIN_GAS_PRICE, "Gas price too low");
-        require(_gasPrice <= auction.currentPrice, "Gas price too high");
+        if (auction.auctionId == bytes32(0)) revert AuctionNotFound();
+        if (auction.filled) revert AuctionAlreadyFilled();
+        if (auction.expired) revert AuctionExpired();
+        if (block.timestamp >= auction.endTime) revert AuctionEnded();
+        if (_gasPrice < MIN_GAS_PRICE) revert GasPriceTooLow();
+        if (_gasPrice > auction.startPrice) revert GasPriceTooHigh();
         
-        // Update current price based on time decay
-        uint256 timeElapsed = block.timestamp - auction.startTime;
-        uint256 priceDecay = (timeElapsed * GAS_PRICE_DECAY_RATE) / 3600; // Decay per hour
-        uint256 newPrice = auction.startPrice > priceDecay ? auction.startPrice - priceDecay : MIN_GAS_PRICE;
-        auction.currentPrice = newPrice;
+        emit RelayerBidPlaced(_auctionId, msg.sender, _gasPrice, block.timestamp);
         
-        // Accept bid if it's at or below current price
-        if (_gasPrice <= newPrice) {
-            auction.winningRelayer = msg.sender;
-            auction.winningGasPrice = _gasPrice;
-            auction.filled = true;
-            
-            relayerBids[_auctionId].push(RelayerBid({
-                relayer: msg.sender,
-                gasPrice: _gasPrice,
-                timestamp: block.timestamp,
-                accepted: true
-            }));
-            
-            emit RelayerBidPlaced(_auctionId, msg.sender, _gasPrice, block.timestamp);
-            emit AuctionWon(_auctionId, msg.sender, _gasPrice);
-        } else {
-            relayerBids[_auctionId].push(RelayerBid({
-                relayer: msg.sender,
-                gasPrice: _gasPrice,
-                timestamp: block.timestamp,
-                accepted: false
-            }));
-            
-            emit RelayerBidPlaced(_auctionId, msg.sender, _gasPrice, block.timestamp);
-        }
+        // Losing bids are only logged; the decayed price is computed, not stored
+        if (_gasPrice > _auctionPrice(_auctionId, auction)) return;
+        
+        auction.winningRelayer = msg.sender;
+        auction.winningGasPrice = _gasPrice;
+        auction.filled = true;
+        
+        relayerBids[_auctionId].push(RelayerBid({
+            relayer: msg.sender,
+            gasPrice: _gasPrice,
+            timestamp: block.timestamp,
+            accepted: true
+        }));
+        
+        emit AuctionWon(_auctionId, msg.sender, _gasPrice);
     }
     
     /**
-     * @dev Execute HTLC with secret reveal (gasless execution)
+     * @dev Execute HTLC with secret reveal (gasless execution); the auction must be the HTLC's own
      */
     function executeHTLCWithSecret(
         bytes32 _htlcId,
         bytes32 _secret,
         bytes32 _auctionId
     ) external onlyAuctionWinner(_auctionId) nonReentrant {
+        if (dutchAuctions[_auctionId].htlcId != _htlcId) revert AuctionMismatch();
         HTLCContract storage htlc = htlcContracts[_htlcId];
-        require(htlc.initiator != address(0), "HTLC not found");
-        require(!htlc.executed, "HTLC already executed");
-        require(!htlc.refunded, "HTLC refunded");
-        require(keccak256(abi.encodePacked(_secret)) == htlc.hashlock, "Invalid secret");
-        require(block.timestamp < htlc.timelock, "HTLC expired");
+        bytes4 err = _executeError(htlc, _secret);
+        if (err != bytes4(0)) _revertWith(err);
         
-        // Store revealed secret
-        revealedSecrets[_htlcId] = _secret;
+        _execute(_htlcId, htlc, _secret, _auctionId);
+    }
+    
+    /**
+     * @dev Execute several HTLCs won by the caller; invalid items are skipped
+     * @return results results[i] is true if _htlcIds[i] was executed
+     */
+    function batchExecuteHTLCWithSecret(
+        bytes32[] calldata _htlcIds,
+        bytes32[] calldata _secrets,
+        bytes32[] calldata _auctionIds
+    ) external nonReentrant returns (bool[] memory results) {
+        if (_htlcIds.length != _secrets.length || _htlcIds.length != _auctionIds.length) revert LengthMismatch();
+        
+        results = new bool[](_htlcIds.length);
+        for (uint256 i = 0; i < _htlcIds.length; ++i) {
+            HTLCContract storage htlc = htlcContracts[_htlcIds[i]];
+            DutchAuction storage auction = dutchAuctions[_auctionIds[i]];
+            bytes4 err = auction.winningRelayer != msg.sender ? NotAuctionWinner.selector
+                : auction.htlcId != _htlcIds[i] ? AuctionMismatch.selector
+                : _executeError(htlc, _secrets[i]);
+            
+            if (err == bytes4(0)) {
+                _execute(_htlcIds[i], htlc, _secrets[i], _auctionIds[i]);
+                results[i] = true;
+            }
+            
+            emit HTLCBatchResult(_htlcIds[i], results[i], err);
+        }
+    }
+    
+    /**
+     * @dev Refund expired HTLC
+     */
+    function refundHTLC(bytes32 _htlcId) external nonReentrant {
+        HTLCContract storage htlc = htlcContracts[_htlcId];
+        bytes4 err = _refundError(htlc);
+        if (err != bytes4(0)) _revertWith(err);
+        
+        _refund(_htlcId, htlc);
+    }
+    
+    /**
+     * @dev Refund several expired HTLCs; invalid items are skipped
+     * @return results results[i] is true if _htlcIds[i] was refunded
+     */
+    function batchRefundHTLC(bytes32[] calldata _htlcIds) external nonReentrant returns (bool[] memory results) {
+        results = new bool[](_htlcIds.length);
+        for (uint256 i = 0; i < _htlcIds.length; ++i) {
+            HTLCContract storage htlc = htlcContracts[_htlcIds[i]];
+            bytes4 err = _refundError(htlc);
+            
+            if (err == bytes4(0)) {
+                _refund(_htlcIds[i], htlc);
+                results[i] = true;
+            }
+            
+            emit HTLCBatchResult(_htlcIds[i], results[i], err);
+        }
+    }
+    
+    // Validation is split from the state change so the batch functions can skip
+    // a failing item instead of reverting; the result is the selector of the custom
+    // error the single-item call reverts with, zero when the item is valid.
+    function _executeError(HTLCContract storage htlc, bytes32 _secret) internal view returns (bytes4) {
+        if (htlc.initiator == address(0)) return HTLCNotFound.selector;
+        if (htlc.executed) return HTLCAlreadyExecuted.selector;
+        if (htlc.refunded) return HTLCAlreadyRefunded.selector;
+        if (keccak256(abi.encodePacked(_secret)) != htlc.hashlock) return InvalidSecret.selector;
+        if (block.timestamp >= htlc.timelock) return HTLCExpired.selector;
+        return bytes4(0);
+    }
+    
+    function _refundError(HTLCContract storage htlc) internal view returns (bytes4) {
+        if (htlc.initiator == address(0)) return HTLCNotFound.selector;
+        if (htlc.executed) return HTLCAlreadyExecuted.selector;
+        if (htlc.refunded) return HTLCAlreadyRefunded.selector;
+        if (block.timestamp < htlc.timelock) return HTLCNotExpired.selector;
+        return bytes4(0);
+    }
+    
+    function _revertWith(bytes4 selector) private pure {
+        assembly ("memory-safe") {
+            mstore(0, selector)
+            revert(0, 4)
+        }
+    }
+    
+    function _execute(bytes32 _htlcId, HTLCContract storage htlc, bytes32 _secret, bytes32 _auctionId) internal {
+        // Store revealed secret unless the SecretRevealed log is enough
+        if (!eventOnlySecrets) revealedSecrets[_htlcId] = _secret;
         
         // Execute the HTLC
         htlc.executed = true;
@@ -332,16 +466,7 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
         emit HTLCWithdrawn(_htlcId, htlc.recipient);
     }
     
-    /**
-     * @dev Refund expired HTLC
-     */
-    function refundHTLC(bytes32 _htlcId) external nonReentrant {
-        HTLCContract storage htlc = htlcContracts[_htlcId];
-        require(htlc.initiator != address(0), "HTLC not found");
-        require(!htlc.executed, "HTLC already executed");
-        require(!htlc.refunded, "HTLC already refunded");
-        require(block.timestamp >= htlc.timelock, "HTLC not expired");
-        
+    function _refund(bytes32 _htlcId, HTLCContract storage htlc) internal {
         htlc.refunded = true;
         
         // Return funds to initiator
@@ -374,12 +499,21 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
     function getCurrentAuctionPrice(bytes32 _auctionId) external view returns (uint256) {
         DutchAuction storage auction = dutchAuctions[_auctionId];
         if (auction.auctionId == bytes32(0)) return 0;
+        return _auctionPrice(_auctionId, auction);
+    }
+    
+    /**
+     * @dev Time-decayed price: the auction's curve if it has one, else startPrice minus hourly decay
+     */
+    function _auctionPrice(bytes32 _auctionId, DutchAuction storage auction) internal view returns (uint256) {
+        uint256 curve = auctionCurves[_auctionId];
+        if (curve != 0) {
+            return AuctionCurveLib.currentPrice(curve, MIN_GAS_PRICE, auction.startTime, auction.endTime);
+        }
         
         uint256 timeElapsed = block.timestamp - auction.startTime;
         uint256 priceDecay = (timeElapsed * GAS_PRICE_DECAY_RATE) / 3600;
-        uint256 currentPrice = auction.startPrice > priceDecay ? auction.startPrice - priceDecay : MIN_GAS_PRICE;
-        
-        return currentPrice;
+        return auction.startPrice > priceDecay ? auction.startPrice - priceDecay : MIN_GAS_PRICE;
     }
     
     /**
@@ -392,12 +526,15 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
     /**
      * @dev Get Dutch auction details
      */
-    function getDutchAuction(bytes32 _auctionId) external view returns (DutchAuction memory) {
-        return dutchAuctions[_auctionId];
+    function getDutchAuction(bytes32 _auctionId) external view returns (DutchAuction memory auction) {
+        auction = dutchAuctions[_auctionId];
+        if (auction.auctionId != bytes32(0)) {
+            auction.currentPrice = _auctionPrice(_auctionId, dutchAuctions[_auctionId]);
+        }
     }
     
     /**
-     * @dev Get relayer bids for an auction
+     * @dev Get the accepted bid for an auction (losing bids are in RelayerBidPlaced events)
      */
     function getRelayerBids(bytes32 _auctionId) external view returns (RelayerBid[] memory) {
         return relayerBids[_auctionId];
@@ -409,6 +546,24 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
     function getRevealedSecret(bytes32 _htlcId) external view returns (bytes32) {
         return revealedSecrets[_htlcId];
     }
+
+    /**
+     * @dev Opt in to event-only secret revelation: claims emit SecretRevealed but
+     * skip the revealedSecrets SSTORE. On-chain consumers use verifyRevealedSecret.
+     */
+    function setEventOnlySecrets(bool _eventOnly) external onlyOwner {
+        eventOnlySecrets = _eventOnly;
+        emit SecretStorageModeSet(_eventOnly);
+    }
+    
+    /**
+     * @dev Proof of reveal: true if the HTLC was claimed and `_secret` is its preimage.
+     * A claim only succeeds with the preimage, so this holds in either storage mode.
+     */
+    function verifyRevealedSecret(bytes32 _htlcId, bytes32 _secret) external view returns (bool) {
+        HTLCContract storage htlc = htlcContracts[_htlcId];
+        return htlc.executed && keccak256(abi.encodePacked(_secret)) == htlc.hashlock;
+    }
     
     /**
      * @dev Authorize/deauthorize relayers
@@ -423,7 +578,7 @@ contract AlgorandHTLCBridge is ReentrancyGuard, Ownable {
      */
     function withdrawRelayerFees() external {
         uint256 balance = relayerBalances[msg.sender];
-        require(balance > 0, "No fees to withdraw");
+        if (balance == 0) revert NoFeesToWithdraw();
         
         relayerBalances[msg.sender] = 0;
         payable(msg.sender).transfer(balance);
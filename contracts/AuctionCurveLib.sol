@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.20;
+
+/**
+ * @title AuctionCurveLib
+ * @dev Piecewise-linear Dutch auction curves packed into one storage word
+ * (1inch Fusion AuctionCalculator model).
+ *
+ * A curve is a rate bump that starts at initialRateBump, moves linearly through
+ * up to MAX_POINTS (rateBump, timeDelta) points and reaches 0 at the auction end.
+ * The price is basePrice * (BASE_POINTS + rateBump - gasBump) / BASE_POINTS, where
+ * gasBump = gasBumpEstimate * block.basefee / gasPriceEstimate / 1e6 hands part of
+ * the premium back when gas is expensive.
+ *
+ * Word layout (high to low bits):
+ *   gasBumpEstimate  uint24  [232..255]
+ *   gasPriceEstimate uint32  [200..231]  (1e6 wei units, i.e. gwei * 1000)
+ *   initialRateBump  uint24  [176..199]
+ *   pointsCount      uint8   [168..175]
+ *   point i          uint40  [128 - 40i .. 167 - 40i]  = rateBump uint24 | timeDelta uint16
+ *
+ * Start time and duration come from the auction itself. Evaluation matches
+ * AuctionCalculator._getAuctionBump bit for bit; the off-chain twin is
+ * scripts/auctionCurve.cjs.
+ */
+library AuctionCurveLib {
+    uint256 internal constant BASE_POINTS = 10_000_000; // rate bump unit: 1e7 = +100%
+    uint256 internal constant MAX_POINTS = 4;
+
+    function gasBumpEstimate(uint256 curve) internal pure returns (uint256) {
+        return curve >> 232;
+    }
+
+    function gasPriceEstimate(uint256 curve) internal pure returns (uint256) {
+        return (curve >> 200) & 0xffffffff;
+    }
+
+    function initialRateBump(uint256 curve) internal pure returns (uint256) {
+        return (curve >> 176) & 0xffffff;
+    }
+
+    function pointsCount(uint256 curve) internal pure returns (uint256) {
+        return (curve >> 168) & 0xff;
+    }
+
+    /**
+     * @dev Empty string if `curve` is usable for an auction of `duration` seconds.
+     * Points must fit the duration and never raise the bump, so the price only falls.
+     */
+    function validationError(uint256 curve, uint256 duration) internal pure returns (string memory) {
+        uint256 count = pointsCount(curve);
+        if (count > MAX_POINTS) return "Too many curve points";
+        if ((curve & ((uint256(1) << (168 - 40 * count)) - 1)) != 0) {
+            return "Unused curve bits set";
+        }
+        if (gasBumpEstimate(curve) != 0 && gasPriceEstimate(curve) == 0) return "Missing gas price estimate";
+
+        uint256 previousBump = initialRateBump(curve);
+        uint256 elapsed;
+        for (uint256 i = 0; i < count; i++) {
+            uint256 point = curve >> (128 - 40 * i);
+            uint256 bump = (point >> 16) & 0xffffff;
+            if (bump > previousBump) return "Curve must not increase";
+            elapsed += point & 0xffff;
+            previousBump = bump;
+        }
+        if (elapsed >= duration) return "Curve points exceed duration";
+        return "";
+    }
+
+    /**
+     * @dev Auction rate bump at `timestamp`, before the gas adjustment
+     */
+    function auctionBump(
+        uint256 curve,
+        uint256 startTime,
+        uint256 finishTime,
+        uint256 timestamp
+    ) internal pure returns (uint256) {
+        uint256 currentRateBump = initialRateBump(curve);
+        if (timestamp <= startTime) return currentRateBump;
+        if (timestamp >= finishTime) return 0;
+
+        uint256 currentPointTime = startTime;
+        uint256 count = pointsCount(curve);
+        for (uint256 i = 0; i < count; i++) {
+            uint256 point = curve >> (128 - 40 * i);
+            uint256 nextRateBump = (point >> 16) & 0xffffff;
+            uint256 nextPointTime = currentPointTime + (point & 0xffff);
+            if (timestamp <= nextPointTime) {
+                return ((timestamp - currentPointTime) * nextRateBump + (nextPointTime - timestamp) * currentRateBump)
+                    / (nextPointTime - currentPointTime);
+            }
+            currentRateBump = nextRateBump;
+            currentPointTime = nextPointTime;
+        }
+        return (finishTime - timestamp) * currentRateBump / (finishTime - currentPointTime);
+    }
+
+    /**
+     * @dev Rate bump after handing back gasBump for `baseFee`
+     */
+    function rateBump(
+        uint256 curve,
+        uint256 startTime,
+        uint256 finishTime,
+        uint256 timestamp,
+        uint256 baseFee
+    ) internal pure returns (uint256) {
+        uint256 bump = auctionBump(curve, startTime, finishTime, timestamp);
+        uint256 gasEstimate = gasPriceEstimate(curve);
+        uint256 gasBump = gasEstimate == 0 ? 0 : gasBumpEstimate(curve) * baseFee / gasEstimate / 1e6;
+        return bump > gasBump ? bump - gasBump : 0;
+    }
+
+    function priceAt(
+        uint256 curve,
+        uint256 basePrice,
+        uint256 startTime,
+        uint256 finishTime,
+        uint256 timestamp,
+        uint256 baseFee
+    ) internal pure returns (uint256) {
+        return basePrice * (BASE_POINTS + rateBump(curve, startTime, finishTime, timestamp, baseFee)) / BASE_POINTS;
+    }
+
+    /**
+     * @dev Price for the current block
+     */
+    function currentPrice(
+        uint256 curve,
+        uint256 basePrice,
+        uint256 startTime,
+        uint256 finishTime
+    ) internal view returns (uint256) {
+        return priceAt(curve, basePrice, startTime, finishTime, block.timestamp, block.basefee);
+    }
+}
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.20;
+
+import { LimitOrderBridge } from "./LimitOrderBridge.sol";
+import { EnhancedLimitOrderBridge } from "./EnhancedLimitOrderBridge.sol";
+import { PartialFillLimitOrderBridge } from "./PartialFillLimitOrderBridge.sol";
+import { CrossChainHTLCResolver } from "./CrossChainHTLCResolver.sol";
+import { Timelocks, BridgeTimelocksLib } from "./BridgeTimelocksLib.sol";
+
+interface IRevealedSecrets {
+    function revealedSecrets(bytes32 id) external view returns (bytes32);
+}
+
+/**
+ * @title BridgeOrderLens
+ * @dev Stateless, read-only batch views over the bridges, meant for eth_call.
+ *
+ * Relayer restarts and dashboards read a few hundred orders in one round-trip
+ * instead of one getter call per order. Nothing here is stored or written;
+ * the lens can be redeployed at will and pointed at any bridge instance.
+ *
+ * Status word (one uint256 per order):
+ *   bits   0..7   status (Status enum)
+ *   bits   8..15  flags (FLAG_*)
+ *   bits  16..23  fill count, saturating at 255
+ *   bits  24..55  HTLC expiry timestamp (refunds open from here)
+ *   bits  56..151 remaining amount, saturating at type(uint96).max
+ *   bits 152..247 total amount, saturating at type(uint96).max
+ *   bits 248..255 bid count, saturating at 255 (EnhancedLimitOrderBridge only)
+ *
+ * The relayer-side decoder is scripts/bridgeOrderLens.cjs.
+ */
+contract BridgeOrderLens {
+    using BridgeTimelocksLib for Timelocks;
+
+    enum BridgeKind {
+        LimitOrder,            // LimitOrderBridge
+        EnhancedLimitOrder,    // EnhancedLimitOrderBridge
+        PartialFill,           // PartialFillLimitOrderBridge
+        CrossChainHTLC         // CrossChainHTLCResolver
+    }
+
+    enum Status {
+        Unknown,
+        Open,
+        PartiallyFilled,
+        Filled,
+        Cancelled,             // cancelled or refunded
+        Expired                // past its deadline / expiry and still funded
+    }
+
+    uint256 public constant FLAG_SECRET_REVEALED = 1 << 0;  // secret stored on-chain (resolver orders)
+    uint256 public constant FLAG_MULTI_SECRET = 1 << 1;     // hashlock is a Merkle root of fill secrets
+    uint256 public constant NO_BID = type(uint256).max;
+
+    /**
+     * @dev Status words for `ids` on `bridge`; unknown ids yield Status.Unknown
+     */
+    function getOrders(
+        address bridge,
+        BridgeKind kind,
+        bytes32[] calldata ids
+    ) external view returns (uint256[] memory words) {
+        words = new uint256[](ids.length);
+        for (uint256 i = 0; i < ids.length; ++i) {
+            if (kind == BridgeKind.LimitOrder) {
+                words[i] = _limitOrderWord(LimitOrderBridge(bridge), ids[i]);
+            } else if (kind == BridgeKind.EnhancedLimitOrder) {
+                words[i] = _enhancedOrderWord(EnhancedLimitOrderBridge(bridge), ids[i]);
+            } else if (kind == BridgeKind.PartialFill) {
+                words[i] = _partialFillWord(PartialFillLimitOrderBridge(bridge), ids[i]);
+            } else {
+                words[i] = _crossChainWord(CrossChainHTLCResolver(bridge), ids[i]);
+            }
+        }
+    }
+
+    /**
+     * @dev Best active bid per order (EnhancedLimitOrderBridge.getBestBid);
+     * bestIndexes[i] is NO_BID when the order has no active bid
+     */
+    function getBestBids(
+        EnhancedLimitOrderBridge bridge,
+        bytes32[] calldata ids
+    ) external view returns (EnhancedLimitOrderBridge.Bid[] memory bestBids, uint256[] memory bestIndexes) {
+        bestBids = new EnhancedLimitOrderBridge.Bid[](ids.length);
+        bestIndexes = new uint256[](ids.length);
+        for (uint256 i = 0; i < ids.length; ++i) {
+            (EnhancedLimitOrderBridge.Bid memory bid, uint256 index) = bridge.getBestBid(ids[i]);
+            bestBids[i] = bid;
+            bestIndexes[i] = bid.resolver == address(0) ? NO_BID : index;
+        }
+    }
+
+    /**
+     * @dev Revealed secrets (zero if not revealed) from any bridge with a public
+     * revealedSecrets mapping: CrossChainHTLCResolver, AlgorandHTLCBridge,
+     * Enhanced1inchStyleBridge. Bridges in event-only mode and the limit order
+     * bridges reveal secrets in events only (scripts/secretStore.cjs).
+     */
+    function getRevealedSecrets(
+        IRevealedSecrets bridge,
+        bytes32[] calldata ids
+    ) external view returns (bytes32[] memory secrets) {
+        secrets = new bytes32[](ids.length);
+        for (uint256 i = 0; i < ids.length; ++i) {
+            secrets[i] = bridge.revealedSecrets(ids[i]);
+        }
+    }
+
+    function _limitOrderWord(LimitOrderBridge bridge, bytes32 id) internal view returns (uint256) {
+        LimitOrderBridge.LimitOrder memory order = bridge.getOrder(id);
+        if (order.intent.maker == address(0)) return 0;
+
+        uint256 expiry = order.timelocks.cancellationStart();
+        bool settled = order.filled || order.cancelled;
+        Status status = _status(
+            order.filled,
+            order.cancelled,
+            block.timestamp > order.intent.deadline || block.timestamp >= expiry,
+            0
+        );
+        return _pack(status, 0, order.filled ? 1 : 0, expiry, settled ? 0 : order.depositedAmount, order.depositedAmount, 0);
+    }
+
+    function _enhancedOrderWord(EnhancedLimitOrderBridge bridge, bytes32 id) internal view returns (uint256) {
+        EnhancedLimitOrderBridge.LimitOrder memory order = bridge.getOrder(id);
+        if (order.intent.maker == address(0)) return 0;
+
+        Status status = _status(
+            order.filled,
+            order.cancelled,
+            block.timestamp > order.intent.deadline || block.timestamp > order.timelock,
+            order.partialFills
+        );
+        uint256 flags = bridge.secretPartsAmount(id) != 0 ? FLAG_MULTI_SECRET : 0;
+        return _pack(
+            status,
+            flags,
+            order.partialFills,
+            order.timelock,
+            order.cancelled ? 0 : order.remainingAmount,
+            order.depositedAmount,
+            bridge.getBidCount(id)
+        );
+    }
+
+    function _partialFillWord(PartialFillLimitOrderBridge bridge, bytes32 id) internal view returns (uint256) {
+        PartialFillLimitOrderBridge.LimitOrder memory order = bridge.getOrder(id);
+        if (order.intent.maker == address(0)) return 0;
+
+        Status status = _status(
+            order.fullyFilled,
+            order.cancelled,
+            block.timestamp > order.intent.deadline || block.timestamp > order.timelock,
+            order.fillCount
+        );
+        uint256 flags = bridge.secretPartsAmount(id) != 0 ? FLAG_MULTI_SECRET : 0;
+        return _pack(
+            status,
+            flags,
+            order.fillCount,
+            order.timelock,
+            order.cancelled ? 0 : order.remainingAmount,
+            order.depositedAmount,
+            0
+        );
+    }
+
+    function _crossChainWord(CrossChainHTLCResolver resolver, bytes32 id) internal view returns (uint256) {
+        CrossChainHTLCResolver.CrossChainOrder memory order = resolver.getCrossChainOrder(id);
+        if (order.maker == address(0)) return 0;
+
+        uint256 expiry = order.timelocks.cancellationStart();
+        Status status = _status(order.executed, order.refunded, block.timestamp >= expiry, 0);
+        uint256 flags = resolver.revealedSecrets(id) != bytes32(0) ? FLAG_SECRET_REVEALED : 0;
+        bool settled = order.executed || order.refunded;
+        return _pack(status, flags, order.executed ? 1 : 0, expiry, settled ? 0 : order.amount, order.amount, 0);
+    }
+
+    function _status(bool filled, bool cancelled, bool expired, uint256 fillCount) internal pure returns (Status) {
+        if (cancelled) return Status.Cancelled;
+        if (filled) return Status.Filled;
+        if (expired) return Status.Expired;
+        if (fillCount != 0) return Status.PartiallyFilled;
+        return Status.Open;
+    }
+
+    function _pack(
+        Status status,
+        uint256 flags,
+        uint256 fillCount,
+        uint256 expiry,
+        uint256 remaining,
+        uint256 total,
+        uint256 bidCount
+    ) internal pure returns (uint256) {
+        return uint256(status)
+            | flags << 8
+            | _min(fillCount, type(uint8).max) << 16
+            | _min(expiry, type(uint32).max) << 24
+            | _min(remaining, type(uint96).max) << 56
+            | _min(total, type(uint96).max) << 152
+            | _min(bidCount, type(uint8).max) << 248;
+    }
+
+    function _min(uint256 a, uint256 b) private pure returns (uint256) {
+        return a < b ? a : b;
+    }
+}
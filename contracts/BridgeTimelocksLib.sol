@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.20;
+
+import { Timelocks, TimelocksLib } from "../1inch-official-temp/libraries/TimelocksLib.sol";
+
+/**
+ * @title BridgeTimelocksLib
+ * @dev Builds and reads the 1inch packed Timelocks word for the custom bridges.
+ *
+ * Every deadline of an order lives in one uint256: the creation time in the top
+ * 32 bits and each source stage as a uint32 offset from it (TimelocksLib layout).
+ * The bridges use the source stages only:
+ *   SrcWithdrawal         private withdrawal (resolver / recipient with the secret)
+ *   SrcPublicWithdrawal   anyone with the secret
+ *   SrcCancellation       maker refund
+ *   SrcPublicCancellation anyone may trigger the refund
+ * Rescue starts at TimelocksLib.rescueStart(rescueDelay).
+ *
+ * The relayer-side decoder is scripts/timelocks.cjs.
+ */
+library BridgeTimelocksLib {
+    using TimelocksLib for Timelocks;
+
+    error TimelocksOutOfOrder();
+    error TimelockTooLong();
+    error ExpiryInThePast();
+
+    /**
+     * @dev Pack source stage offsets (seconds after `deployedAt`); offsets must not decrease
+     */
+    function pack(
+        uint256 deployedAt,
+        uint256 withdrawal,
+        uint256 publicWithdrawal,
+        uint256 cancellation,
+        uint256 publicCancellation
+    ) internal pure returns (Timelocks) {
+        if (withdrawal > publicWithdrawal || publicWithdrawal > cancellation || cancellation > publicCancellation) {
+            revert TimelocksOutOfOrder();
+        }
+        if (publicCancellation > type(uint32).max) revert TimelockTooLong();
+        return Timelocks.wrap(
+            withdrawal | publicWithdrawal << 32 | cancellation << 64 | publicCancellation << 96
+        ).setDeployedAt(deployedAt);
+    }
+
+    /**
+     * @dev Plain HTLC: withdraw with the secret from creation until `expiry`, refund afterwards
+     */
+    function untilExpiry(uint256 deployedAt, uint256 expiry) internal pure returns (Timelocks) {
+        if (expiry <= deployedAt) revert ExpiryInThePast();
+        uint256 offset = expiry - deployedAt;
+        return pack(deployedAt, 0, offset, offset, offset);
+    }
+
+    function deployedAt(Timelocks timelocks) internal pure returns (uint256) {
+        return Timelocks.unwrap(timelocks) >> 224;
+    }
+
+    function withdrawalStart(Timelocks timelocks) internal pure returns (uint256) {
+        return timelocks.get(TimelocksLib.Stage.SrcWithdrawal);
+    }
+
+    function publicWithdrawalStart(Timelocks timelocks) internal pure returns (uint256) {
+        return timelocks.get(TimelocksLib.Stage.SrcPublicWithdrawal);
+    }
+
+    function cancellationStart(Timelocks timelocks) internal pure returns (uint256) {
+        return timelocks.get(TimelocksLib.Stage.SrcCancellation);
+    }
+
+    function publicCancellationStart(Timelocks timelocks) internal pure returns (uint256) {
+        return timelocks.get(TimelocksLib.Stage.SrcPublicCancellation);
+    }
+
+    /**
+     * @dev Number of source stages that have started at `timestamp` (0 = none, 4 = public cancellation)
+     */
+    function srcStagesStarted(Timelocks timelocks, uint256 timestamp) internal pure returns (uint256 started) {
+        uint256 data = Timelocks.unwrap(timelocks);
+        uint256 base = data >> 224;
+        for (; started < 4; started++) {
+            if (timestamp < base + uint32(data >> (started * 32))) break;
+        }
+    }
+}
@@ -30,6 +30,7 @@ import { SafeERC20 } from "@1inch/solidity-utils/contracts/libraries/SafeERC20.s
 import { RevertReasonForwarder } from "@1inch/solidity-utils/contracts/libraries/RevertReasonForwarder.sol";
 import { IOrderMixin } from "@1inch/limit-order-protocol-contract/contracts/interfaces/IOrderMixin.sol";
 import { ITakerInteraction } from "@1inch/limit-order-protocol-contract/contracts/interfaces/ITakerInteraction.sol";
+import { Timelocks, BridgeTimelocksLib } from "./BridgeTimelocksLib.sol";
 
 // 🎯 CROSS-CHAIN HTLC INTEGRATION
 interface IEscrowFactory {
@@ -55,6 +56,7 @@ contract CrossChainHTLCResolver is ITakerInteraction {
 
     using SafeERC20 for IERC20;
     using AddressLib for Address;
+    using BridgeTimelocksLib for Timelocks;
 
     // 🎯 OFFICIAL 1INCH CONTRACTS (Sepolia)
     IOrderMixin private immutable _LOPV4;
@@ -71,7 +73,7 @@ contract CrossChainHTLCResolver is ITakerInteraction {
     struct CrossChainOrder {
         bytes32 orderHash;
         bytes32 hashlock;
-        uint256 timelock;
+        Timelocks timelocks; // created-at + stage offsets; expiry = cancellationStart()
         address token;
         uint256 amount;
         address recipient;
@@ -80,12 +82,12 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         address escrowDst;
         bool executed;
         bool refunded;
-        uint256 createdAt;
         address maker; // Store the original maker address
     }
     
     mapping(bytes32 => CrossChainOrder) public crossChainOrders;
-    mapping(bytes32 => bytes32) public revealedSecrets; // orderHash => secret
+    mapping(bytes32 => bytes32) public revealedSecrets; // orderHash => secret (empty in event-only mode)
+    bool public eventOnlySecrets; // secrets only in SecretRevealed logs
 
     // 🎉 EVENTS
     event CrossChainOrderCreated(
@@ -115,6 +117,10 @@ contract CrossChainHTLCResolver is ITakerInteraction {
     
     event SecretRevealed(bytes32 indexed orderHash, bytes32 secret);
     event OrderRefunded(bytes32 indexed orderHash, address indexed maker);
+    event SecretStorageModeSet(bool eventOnly);
+    
+    // Per-item outcome of the batch* functions (reason is empty on success)
+    event OrderBatchResult(bytes32 indexed orderHash, bool success, string reason);
 
     modifier onlyOwner () {
         if (msg.sender != _OWNER) revert OnlyOwner();
@@ -160,6 +166,43 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         address _recipient,
         string calldata _algorandAddress
     ) external payable returns (bytes32 orderHash) {
+        orderHash = _createOrder(_hashlock, _timelock, _token, _amount, _recipient, _algorandAddress);
+    }
+    
+    /**
+     * @dev Create the order and its escrows in one transaction (saves the relayer a block per swap)
+     * @param _hashlock Secret hash for HTLC
+     * @param _timelock HTLC expiry timestamp
+     * @param _token Token address (address(0) for ETH)
+     * @param _amount Amount to swap
+     * @param _recipient Ethereum recipient address
+     * @param _algorandAddress Algorand recipient address
+     * @param _resolverCalldata Encoded resolver data for cross-chain execution
+     * @return orderHash Unique order identifier
+     * @return escrowSrc Source chain escrow address
+     * @return escrowDst Destination chain escrow address
+     */
+    function createCrossChainHTLCWithEscrow(
+        bytes32 _hashlock,
+        uint256 _timelock,
+        address _token,
+        uint256 _amount,
+        address _recipient,
+        string calldata _algorandAddress,
+        bytes calldata _resolverCalldata
+    ) external payable onlyOwner returns (bytes32 orderHash, address escrowSrc, address escrowDst) {
+        orderHash = _createOrder(_hashlock, _timelock, _token, _amount, _recipient, _algorandAddress);
+        (escrowSrc, escrowDst) = _postOrderCreated(orderHash, crossChainOrders[orderHash], _resolverCalldata);
+    }
+    
+    function _createOrder(
+        bytes32 _hashlock,
+        uint256 _timelock,
+        address _token,
+        uint256 _amount,
+        address _recipient,
+        string calldata _algorandAddress
+    ) internal returns (bytes32 orderHash) {
         require(_amount >= MIN_ORDER_VALUE, "Amount too small");
         require(_timelock >= block.timestamp + DEFAULT_TIMELOCK, "Timelock too short");
         require(_hashlock != bytes32(0), "Invalid hashlock");
@@ -188,7 +231,7 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         crossChainOrders[orderHash] = CrossChainOrder({
             orderHash: orderHash,
             hashlock: _hashlock,
-            timelock: _timelock,
+            timelocks: BridgeTimelocksLib.untilExpiry(block.timestamp, _timelock),
             token: _token,
             amount: _amount,
             recipient: _recipient,
@@ -197,7 +240,6 @@ contract CrossChainHTLCResolver is ITakerInteraction {
             escrowDst: address(0),
             executed: false,
             refunded: false,
-            createdAt: block.timestamp,
             maker: msg.sender
         });
         
@@ -227,14 +269,27 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         require(order.orderHash != bytes32(0), "Order not found");
         require(!order.executed, "Order already executed");
         require(!order.refunded, "Order refunded");
-        require(block.timestamp < order.timelock, "Order expired");
+        require(block.timestamp < order.timelocks.cancellationStart(), "Order expired");
+        require(order.escrowSrc == address(0), "Escrow already created");
         
+        (escrowSrc, escrowDst) = _postOrderCreated(_orderHash, order, _resolverCalldata);
+    }
+    
+    /**
+     * @dev Escrow deployment hook run once the order is recorded
+     * (same role as BaseEscrowFactory._postInteraction after a LOP fill)
+     */
+    function _postOrderCreated(
+        bytes32 _orderHash,
+        CrossChainOrder storage order,
+        bytes calldata _resolverCalldata
+    ) internal returns (address escrowSrc, address escrowDst) {
         // Create source escrow (holds user tokens)
         escrowSrc = ESCROW_FACTORY.createEscrow{value: order.token == address(0) ? order.amount : 0}(
             order.token,
             order.amount,
             _orderHash,
-            order.timelock,
+            order.timelocks.cancellationStart(),
             _resolverCalldata
         );
         
@@ -266,15 +321,93 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         bytes32 _secret
     ) external onlyOwner {
         CrossChainOrder storage order = crossChainOrders[_orderHash];
-        require(order.orderHash != bytes32(0), "Order not found");
-        require(!order.executed, "Order already executed");
-        require(!order.refunded, "Order refunded");
-        require(keccak256(abi.encodePacked(_secret)) == order.hashlock, "Invalid secret");
-        require(block.timestamp < order.timelock, "Order expired");
-        require(order.escrowSrc != address(0), "Escrow not created");
+        string memory err = _executeError(order, _secret);
+        require(bytes(err).length == 0, err);
         
-        // Store revealed secret
-        revealedSecrets[_orderHash] = _secret;
+        _execute(_orderHash, order, _secret);
+    }
+    
+    /**
+     * @dev Execute several swaps in one transaction; invalid items are skipped
+     * @param _orderHashes Order hashes to execute
+     * @param _secrets Secrets matching each order's hashlock
+     * @return results results[i] is true if _orderHashes[i] was executed
+     */
+    function batchExecuteCrossChainSwap(
+        bytes32[] calldata _orderHashes,
+        bytes32[] calldata _secrets
+    ) external onlyOwner returns (bool[] memory results) {
+        require(_orderHashes.length == _secrets.length, "Length mismatch");
+        
+        results = new bool[](_orderHashes.length);
+        for (uint256 i = 0; i < _orderHashes.length; ++i) {
+            CrossChainOrder storage order = crossChainOrders[_orderHashes[i]];
+            string memory err = _executeError(order, _secrets[i]);
+            
+            if (bytes(err).length == 0) {
+                _execute(_orderHashes[i], order, _secrets[i]);
+                results[i] = true;
+            }
+            
+            emit OrderBatchResult(_orderHashes[i], results[i], err);
+        }
+    }
+    
+    /**
+     * @dev Refund expired order
+     * @param _orderHash Order hash to refund
+     */
+    function refundOrder(bytes32 _orderHash) external {
+        CrossChainOrder storage order = crossChainOrders[_orderHash];
+        string memory err = _refundError(order);
+        require(bytes(err).length == 0, err);
+        
+        _refund(_orderHash, order);
+    }
+    
+    /**
+     * @dev Refund several expired orders in one transaction; invalid items are skipped
+     * @param _orderHashes Order hashes to refund
+     * @return results results[i] is true if _orderHashes[i] was refunded
+     */
+    function batchRefundOrders(bytes32[] calldata _orderHashes) external returns (bool[] memory results) {
+        results = new bool[](_orderHashes.length);
+        for (uint256 i = 0; i < _orderHashes.length; ++i) {
+            CrossChainOrder storage order = crossChainOrders[_orderHashes[i]];
+            string memory err = _refundError(order);
+            
+            if (bytes(err).length == 0) {
+                _refund(_orderHashes[i], order);
+                results[i] = true;
+            }
+            
+            emit OrderBatchResult(_orderHashes[i], results[i], err);
+        }
+    }
+    
+    // Validation is split from the state change so the batch functions can skip
+    // a failing item instead of reverting; an empty string means the item is valid.
+    function _executeError(CrossChainOrder storage order, bytes32 _secret) internal view returns (string memory) {
+        if (order.orderHash == bytes32(0)) return "Order not found";
+        if (order.executed) return "Order already executed";
+        if (order.refunded) return "Order refunded";
+        if (keccak256(abi.encodePacked(_secret)) != order.hashlock) return "Invalid secret";
+        if (block.timestamp >= order.timelocks.cancellationStart()) return "Order expired";
+        if (order.escrowSrc == address(0)) return "Escrow not created";
+        return "";
+    }
+    
+    function _refundError(CrossChainOrder storage order) internal view returns (string memory) {
+        if (order.orderHash == bytes32(0)) return "Order not found";
+        if (order.executed) return "Order already executed";
+        if (order.refunded) return "Order already refunded";
+        if (block.timestamp < order.timelocks.cancellationStart()) return "Order not expired";
+        return "";
+    }
+    
+    function _execute(bytes32 _orderHash, CrossChainOrder storage order, bytes32 _secret) internal {
+        // Store revealed secret unless the SecretRevealed log is enough
+        if (!eventOnlySecrets) revealedSecrets[_orderHash] = _secret;
         
         // Mark as executed
         order.executed = true;
@@ -289,17 +422,7 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         emit SecretRevealed(_orderHash, _secret);
     }
     
-    /**
-     * @dev Refund expired order
-     * @param _orderHash Order hash to refund
-     */
-    function refundOrder(bytes32 _orderHash) external {
-        CrossChainOrder storage order = crossChainOrders[_orderHash];
-        require(order.orderHash != bytes32(0), "Order not found");
-        require(!order.executed, "Order already executed");
-        require(!order.refunded, "Order already refunded");
-        require(block.timestamp >= order.timelock, "Order not expired");
-        
+    function _refund(bytes32 _orderHash, CrossChainOrder storage order) internal {
         order.refunded = true;
         
         // Return funds to original maker
@@ -320,6 +443,15 @@ contract CrossChainHTLCResolver is ITakerInteraction {
     function getCrossChainOrder(bytes32 _orderHash) external view returns (CrossChainOrder memory) {
         return crossChainOrders[_orderHash];
     }
+
+    /**
+     * @dev Get the expiry of an order (start of its cancellation stage)
+     * @param _orderHash Order hash to query
+     * @return Unix time after which the order can be refunded
+     */
+    function getExpiry(bytes32 _orderHash) external view returns (uint256) {
+        return crossChainOrders[_orderHash].timelocks.cancellationStart();
+    }
     
     /**
      * @dev Get revealed secret for an order
@@ -330,6 +462,24 @@ contract CrossChainHTLCResolver is ITakerInteraction {
         return revealedSecrets[_orderHash];
     }
 
+    /**
+     * @dev Opt in to event-only secret revelation: claims emit SecretRevealed but
+     * skip the revealedSecrets SSTORE. On-chain consumers use verifyRevealedSecret.
+     */
+    function setEventOnlySecrets(bool _eventOnly) external onlyOwner {
+        eventOnlySecrets = _eventOnly;
+        emit SecretStorageModeSet(_eventOnly);
+    }
+    
+    /**
+     * @dev Proof of reveal: true if the order was claimed and `_secret` is its preimage.
+     * A claim only succeeds with the preimage, so this holds in either storage mode.
+     */
+    function verifyRevealedSecret(bytes32 _orderHash, bytes32 _secret) external view returns (bool) {
+        CrossChainOrder storage order = crossChainOrders[_orderHash];
+        return order.executed && keccak256(abi.encodePacked(_secret)) == order.hashlock;
+    }
+
     /**
      * @dev 1inch Fusion taker interaction implementation
      * Required for integration with LimitOrderProtocol
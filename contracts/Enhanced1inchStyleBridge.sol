@@ -5,6 +5,7 @@ import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
 import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
 import "@openzeppelin/contracts/access/Ownable.sol";
+import "./AuctionCurveLib.sol";
 
 /**
  * @title Enhanced1inchStyleBridge
@@ -31,6 +32,7 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
         uint256 duration;           // Simple duration (like 1inch's 180s)
         uint256 initialRateBump;    // Price premium (like 1inch's 0)
         bool linearDecay;           // Simple linear price decay
+        uint256 curve;              // Piecewise-linear AuctionCurveLib word (0 = none)
     }
     
     // 🌉 Cross-chain HTLC with 1inch patterns
@@ -72,7 +74,8 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
     mapping(bytes32 => FusionHTLC) public htlcContracts;
     mapping(bytes32 => ResolverAuction) public auctions;
     mapping(address => bool) public authorizedResolvers;
-    mapping(bytes32 => bytes32) public revealedSecrets;
+    mapping(bytes32 => bytes32) public revealedSecrets; // empty in event-only mode
+    bool public eventOnlySecrets; // secrets only in SecretRevealed logs
     
     // 🎯 1inch-inspired auction defaults
     uint256 public constant DEFAULT_AUCTION_DURATION = 180; // 3 minutes (like 1inch)
@@ -101,6 +104,9 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
         bytes result
     );
     
+    event SecretRevealed(bytes32 indexed htlcId, bytes32 secret);
+    event SecretStorageModeSet(bool eventOnly);
+    
     constructor() Ownable(msg.sender) {
         // Initialize with 1inch-inspired defaults
     }
@@ -188,6 +194,29 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
         bytes32 _htlcId,
         uint256 _duration
     ) external returns (bytes32 auctionId) {
+        return _startAuction(_htlcId, _duration, 0);
+    }
+    
+    /**
+     * @dev Start auction with 1inch Fusion-style curve points instead of the linear decay.
+     * The price is MIN_GAS_PRICE scaled by the curve's rate bump (see AuctionCurveLib).
+     */
+    function startCurveAuction(
+        bytes32 _htlcId,
+        uint256 _duration,
+        uint256 _curve
+    ) external returns (bytes32 auctionId) {
+        require(_curve != 0, "Empty curve");
+        string memory err = AuctionCurveLib.validationError(_curve, _duration > 0 ? _duration : DEFAULT_AUCTION_DURATION);
+        require(bytes(err).length == 0, err);
+        return _startAuction(_htlcId, _duration, _curve);
+    }
+    
+    function _startAuction(
+        bytes32 _htlcId,
+        uint256 _duration,
+        uint256 _curve
+    ) internal returns (bytes32 auctionId) {
         require(authorizedResolvers[msg.sender], "Not authorized");
         FusionHTLC storage htlc = htlcContracts[_htlcId];
         require(htlc.initiator != address(0), "HTLC not found");
@@ -202,8 +231,9 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
             config: SimpleAuction({
                 startTime: block.timestamp,
                 duration: duration,
-                initialRateBump: DEFAULT_INITIAL_RATE_BUMP,
-                linearDecay: true
+                initialRateBump: _curve != 0 ? AuctionCurveLib.initialRateBump(_curve) : DEFAULT_INITIAL_RATE_BUMP,
+                linearDecay: _curve == 0,
+                curve: _curve
             }),
             winningResolver: address(0),
             winningGasPrice: 0,
@@ -233,8 +263,9 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
         require(keccak256(abi.encodePacked(_secret)) == htlc.hashlock, "Invalid secret");
         require(block.timestamp < htlc.timelock, "HTLC expired");
         
-        // Store revealed secret
-        revealedSecrets[_htlcId] = _secret;
+        // Store revealed secret unless the SecretRevealed log is enough
+        if (!eventOnlySecrets) revealedSecrets[_htlcId] = _secret;
+        emit SecretRevealed(_htlcId, _secret);
         
         // Execute 1inch-style resolver interaction
         if (_interaction.target != address(0)) {
@@ -259,10 +290,15 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
     }
     
     /**
-     * @dev Get current auction price (1inch-style linear decay)
+     * @dev Get current auction price (1inch-style curve, or linear decay)
      */
     function getCurrentAuctionPrice(bytes32 _auctionId) external view returns (uint256) {
         ResolverAuction storage auction = auctions[_auctionId];
+        uint256 curve = auction.config.curve;
+        if (curve != 0) {
+            uint256 startTime = auction.config.startTime;
+            return AuctionCurveLib.currentPrice(curve, MIN_GAS_PRICE, startTime, startTime + auction.config.duration);
+        }
         if (!auction.config.linearDecay) return auction.currentPrice;
         
         uint256 elapsed = block.timestamp - auction.config.startTime;
@@ -281,4 +317,22 @@ contract Enhanced1inchStyleBridge is ReentrancyGuard, Ownable {
     function setResolverAuthorization(address _resolver, bool _authorized) external onlyOwner {
         authorizedResolvers[_resolver] = _authorized;
     }
+
+    /**
+     * @dev Opt in to event-only secret revelation: claims emit SecretRevealed but
+     * skip the revealedSecrets SSTORE. On-chain consumers use verifyRevealedSecret.
+     */
+    function setEventOnlySecrets(bool _eventOnly) external onlyOwner {
+        eventOnlySecrets = _eventOnly;
+        emit SecretStorageModeSet(_eventOnly);
+    }
+    
+    /**
+     * @dev Proof of reveal: true if the HTLC was claimed and `_secret` is its preimage.
+     * A claim only succeeds with the preimage, so this holds in either storage mode.
+     */
+    function verifyRevealedSecret(bytes32 _htlcId, bytes32 _secret) external view returns (bool) {
+        FusionHTLC storage htlc = htlcContracts[_htlcId];
+        return htlc.executed && keccak256(abi.encodePacked(_secret)) == htlc.hashlock;
+    }
 } 
\ No newline at end of file
@@ -3,11 +3,13 @@ pragma solidity ^0.8.20;
 
 import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
-import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+import "@openzeppelin/contracts/utils/ReentrancyGuardTransient.sol";
 import "@openzeppelin/contracts/access/Ownable.sol";
 import "@openzeppelin/contracts/utils/cryptography/ECDSA.sol";
 import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
 import "@openzeppelin/contracts/utils/math/Math.sol";
+import "./AuctionCurveLib.sol";
+import "./BridgeTimelocksLib.sol";
 
 /**
  * @title EnhancedCrossChainResolver
@@ -27,8 +29,41 @@ import "@openzeppelin/contracts/utils/math/Math.sol";
  * - Resolver competition
  * - Gasless execution
  */
-contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
+contract EnhancedCrossChainResolver is ReentrancyGuardTransient, Ownable, EIP712 {
+    error NotAuthorizedResolver();
+    error OrderNotFound();
+    error InvalidAccessToken();
+    error AmountTooSmall();
+    error TimelockTooShort();
+    error InvalidAuctionTimes();
+    error InvalidPriceRange();
+    error OrderAlreadyExists();
+    error IncorrectETHAmount();
+    error OrderNotActive();
+    error OrderAlreadyExecuted();
+    error InvalidSecret();
+    error ZeroFillAmount();
+    error FillAmountExceedsRemaining();
+    error FillTooSmall();
+    error TooManyPartialFills();
+    error PartialFillsDisabled();
+    error InsufficientOutput();
+    error OnlyMaker();
+    error AuctionNotActive();
+    error AuctionStarted();
+    error AuctionNotStarted();
+    error AuctionEnded();
+    error BidTooLow();
+    error BidIncrementTooSmall();
+    error OnlyMakerCanWithdraw();
+    error NotInWithdrawalStage();
+    error NotInPublicStage();
+    error OrderAlreadyProcessed();
+    error NoFeesToWithdraw();
+    error InvalidAuctionCurve(string reason);
+
     using SafeERC20 for IERC20;
+    using BridgeTimelocksLib for Timelocks;
     using ECDSA for bytes32;
     using Math for uint256;
 
@@ -83,11 +118,11 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
         uint256 winningBid;
         
         // 🔄 NEW: Multi-stage Timelock
+        // Stage boundaries live in one packed word (BridgeTimelocksLib source stages):
+        // SrcWithdrawal = end of Active, SrcPublicWithdrawal = Public, SrcCancellation = Cancelled.
+        // currentStage is the last stage announced by transitionStage; checks use getStage().
         TimelockStage currentStage;
-        uint256 stageStartTime;
-        uint256 withdrawalDeadline;
-        uint256 publicDeadline;
-        uint256 cancellationDeadline;
+        Timelocks timelocks;
         
         // 🔑 NEW: Access Token
         address accessToken;
@@ -113,10 +148,15 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
         uint256 endPrice;
         uint256 minBidIncrement;
         bool active;
+        uint256 curve;              // AuctionCurveLib word; 0 = linear startPrice → endPrice
     }
     
-    // Separate mapping for bids to avoid struct assignment issues
-    mapping(bytes32 => address[]) public auctionBidders;
+    // Separate mappings for bids to avoid struct assignment issues.
+    // Bidders are tracked by membership + count (not an array) so placeBid
+    // costs the same for the 1st and the 100th bidder; the full bidder list
+    // is in the BidPlaced events.
+    mapping(bytes32 => mapping(address => bool)) public isAuctionBidder;
+    mapping(bytes32 => uint256) public auctionBidderCount;
     mapping(bytes32 => mapping(address => uint256)) public auctionBids;
 
     // 📊 Storage
@@ -167,6 +207,12 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
         uint256 endPrice
     );
 
+    event AuctionCurveSet(
+        bytes32 indexed orderHash,
+        uint256 curve,
+        uint256 startPrice
+    );
+
     event BidPlaced(
         bytes32 indexed orderHash,
         address indexed resolver,
@@ -200,21 +246,17 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
 
     // 🔒 Modifiers
     modifier onlyAuthorizedResolver() {
-        require(authorizedResolvers[msg.sender], "Not authorized resolver");
+        if (!authorizedResolvers[msg.sender]) revert NotAuthorizedResolver();
         _;
     }
 
     modifier validOrder(bytes32 orderHash) {
-        require(orders[orderHash].maker != address(0), "Order not found");
+        if (orders[orderHash].maker == address(0)) revert OrderNotFound();
         _;
     }
 
     modifier validAccessToken(bytes32 orderHash) {
-        require(
-            orders[orderHash].accessToken == address(0) || 
-            accessTokens[orders[orderHash].accessToken],
-            "Invalid access token"
-        );
+        if (orders[orderHash].accessToken != address(0) && !accessTokens[orders[orderHash].accessToken]) revert InvalidAccessToken();
         _;
     }
 
@@ -241,10 +283,10 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
         uint256 _endPrice,
         address _accessToken
     ) external payable returns (bytes32 orderHash) {
-        require(_amount >= MIN_ORDER_VALUE, "Amount too small");
-        require(_timelock >= DEFAULT_TIMELOCK, "Timelock too short");
-        require(_auctionEndTime > _auctionStartTime, "Invalid auction times");
-        require(_startPrice > _endPrice, "Invalid price range");
+        if (_amount < MIN_ORDER_VALUE) revert AmountTooSmall();
+        if (_timelock < DEFAULT_TIMELOCK) revert TimelockTooShort();
+        if (_auctionEndTime <= _auctionStartTime) revert InvalidAuctionTimes();
+        if (_startPrice <= _endPrice) revert InvalidPriceRange();
 
         // Create order hash
         orderHash = keccak256(abi.encodePacked(
@@ -258,13 +300,7 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
             msg.sender
         ));
 
-        require(orders[orderHash].maker == address(0), "Order already exists");
-
-        // Calculate timelock stages
-        uint256 stageStartTime = block.timestamp;
-        uint256 withdrawalDeadline = stageStartTime + WITHDRAWAL_TIMELOCK;
-        uint256 publicDeadline = withdrawalDeadline + PUBLIC_TIMELOCK;
-        uint256 cancellationDeadline = stageStartTime + _timelock;
+        if (orders[orderHash].maker != address(0)) revert OrderAlreadyExists();
 
         // Create order
         orders[orderHash] = CrossChainOrder({
@@ -300,10 +336,13 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
             
             // Multi-stage timelock
             currentStage: TimelockStage.Active,
-            stageStartTime: stageStartTime,
-            withdrawalDeadline: withdrawalDeadline,
-            publicDeadline: publicDeadline,
-            cancellationDeadline: cancellationDeadline,
+            timelocks: BridgeTimelocksLib.pack(
+                block.timestamp,
+                WITHDRAWAL_TIMELOCK,
+                WITHDRAWAL_TIMELOCK + PUBLIC_TIMELOCK,
+                _timelock,
+                _timelock
+            ),
             
             // Access token
             accessToken: _accessToken
@@ -316,15 +355,13 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
             startPrice: _startPrice,
             endPrice: _endPrice,
             minBidIncrement: _startPrice / 100, // 1% minimum increment
-            active: true
+            active: true,
+            curve: 0
         });
-        
-        // Initialize auction bidders array
-        auctionBidders[orderHash] = new address[](0);
 
         // Transfer funds
         if (_token == address(0)) {
-            require(msg.value == _amount, "Incorrect ETH amount");
+            if (msg.value != _amount) revert IncorrectETHAmount();
         } else {
             IERC20(_token).safeTransferFrom(msg.sender, address(this), _amount);
         }
@@ -357,26 +394,25 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
     ) external onlyAuthorizedResolver validOrder(_orderHash) validAccessToken(_orderHash) nonReentrant {
         CrossChainOrder storage order = orders[_orderHash];
         
-        // Validate order state
-        require(order.currentStage == TimelockStage.Active, "Order not active");
-        require(!order.executed, "Order already executed");
-        require(keccak256(abi.encodePacked(_secret)) == order.hashlock, "Invalid secret");
-        require(block.timestamp < order.cancellationDeadline, "Order expired");
+        // Validate order state: fills stay open until the cancellation stage, as with the stored stage
+        if (_stage(order) >= TimelockStage.Cancelled) revert OrderNotActive();
+        if (order.executed) revert OrderAlreadyExecuted();
+        if (keccak256(abi.encodePacked(_secret)) != order.hashlock) revert InvalidSecret();
 
         // Validate partial fill
-        require(_fillAmount > 0, "Fill amount must be > 0");
-        require(_fillAmount <= order.remainingAmount, "Fill amount exceeds remaining");
+        if (_fillAmount == 0) revert ZeroFillAmount();
+        if (_fillAmount > order.remainingAmount) revert FillAmountExceedsRemaining();
         
         if (order.partialFillsEnabled) {
-            require(_fillAmount >= order.minFillAmount || _fillAmount == order.remainingAmount, "Fill too small");
-            require(order.fillCount < MAX_PARTIAL_FILLS, "Too many partial fills");
+            if (_fillAmount < order.minFillAmount && _fillAmount != order.remainingAmount) revert FillTooSmall();
+            if (order.fillCount >= MAX_PARTIAL_FILLS) revert TooManyPartialFills();
         } else {
-            require(_fillAmount == order.remainingAmount, "Partial fills disabled");
+            if (_fillAmount != order.remainingAmount) revert PartialFillsDisabled();
         }
 
         // Get current auction price
         uint256 currentPrice = getCurrentAuctionPrice(_orderHash);
-        require(_algorandAmount >= currentPrice, "Insufficient output");
+        if (_algorandAmount < currentPrice) revert InsufficientOutput();
 
         // Calculate resolver fee with partial fill bonus
         uint256 baseFeeRate = resolverFeeRate;
@@ -438,12 +474,46 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
      * @dev Get current Dutch auction price (1inch-style linear decay)
      */
     function getCurrentAuctionPrice(bytes32 _orderHash) public view returns (uint256) {
+        return _auctionPrice(auctions[_orderHash]);
+    }
+
+    /**
+     * @dev Replace the linear decay with a piecewise-linear curve (1inch Fusion style).
+     * endPrice becomes the curve's base price; startPrice follows from initialRateBump.
+     * Only the maker, and only before the auction starts.
+     */
+    function setAuctionCurve(bytes32 _orderHash, uint256 _curve) external {
         CrossChainOrder storage order = orders[_orderHash];
         DutchAuctionConfig storage auction = auctions[_orderHash];
-        
+
+        if (msg.sender != order.maker) revert OnlyMaker();
+        if (!auction.active) revert AuctionNotActive();
+        if (block.timestamp >= auction.startTime) revert AuctionStarted();
+        string memory err = AuctionCurveLib.validationError(_curve, auction.endTime - auction.startTime);
+        if (bytes(err).length != 0) revert InvalidAuctionCurve(err);
+
+        uint256 startPrice = auction.endPrice * (AuctionCurveLib.BASE_POINTS + AuctionCurveLib.initialRateBump(_curve))
+            / AuctionCurveLib.BASE_POINTS;
+        auction.curve = _curve;
+        auction.startPrice = startPrice;
+        auction.minBidIncrement = startPrice / 100;
+        order.startPrice = startPrice;
+
+        emit AuctionCurveSet(_orderHash, _curve, startPrice);
+    }
+
+    /**
+     * @dev Price from the curve parameters; never stored, so bids don't pay for price updates
+     */
+    function _auctionPrice(DutchAuctionConfig storage auction) internal view returns (uint256) {
         if (!auction.active || block.timestamp < auction.startTime) {
             return auction.startPrice;
         }
+
+        uint256 curve = auction.curve;
+        if (curve != 0) {
+            return AuctionCurveLib.currentPrice(curve, auction.endPrice, auction.startTime, auction.endTime);
+        }
         
         if (block.timestamp >= auction.endTime) {
             return auction.endPrice;
@@ -465,28 +535,21 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
         CrossChainOrder storage order = orders[_orderHash];
         DutchAuctionConfig storage auction = auctions[_orderHash];
         
-        require(auction.active, "Auction not active");
-        require(block.timestamp >= auction.startTime, "Auction not started");
-        require(block.timestamp < auction.endTime, "Auction ended");
+        if (!auction.active) revert AuctionNotActive();
+        if (block.timestamp < auction.startTime) revert AuctionNotStarted();
+        if (block.timestamp >= auction.endTime) revert AuctionEnded();
         
-        uint256 currentPrice = getCurrentAuctionPrice(_orderHash);
-        require(_bidAmount >= currentPrice, "Bid too low");
-        require(_bidAmount >= order.winningBid + auction.minBidIncrement, "Bid increment too small");
+        uint256 currentPrice = _auctionPrice(auction);
+        if (_bidAmount < currentPrice) revert BidTooLow();
+        if (_bidAmount < order.winningBid + auction.minBidIncrement) revert BidIncrementTooSmall();
 
         order.winningResolver = msg.sender;
         order.winningBid = _bidAmount;
         
-        // Track bidder
-        bool bidderExists = false;
-        address[] storage bidders = auctionBidders[_orderHash];
-        for (uint i = 0; i < bidders.length; i++) {
-            if (bidders[i] == msg.sender) {
-                bidderExists = true;
-                break;
-            }
-        }
-        if (!bidderExists) {
-            auctionBidders[_orderHash].push(msg.sender);
+        // Track bidder (O(1) membership check)
+        if (!isAuctionBidder[_orderHash][msg.sender]) {
+            isAuctionBidder[_orderHash][msg.sender] = true;
+            auctionBidderCount[_orderHash]++;
         }
         auctionBids[_orderHash][msg.sender] = _bidAmount;
 
@@ -494,31 +557,28 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
     }
 
     /**
-     * @dev Transition order to next timelock stage
+     * @dev Stage derived from the packed timelocks; no transaction is needed to advance it
+     */
+    function _stage(CrossChainOrder storage order) internal view returns (TimelockStage) {
+        uint256 started = order.timelocks.srcStagesStarted(block.timestamp);
+        return TimelockStage(started > uint256(TimelockStage.Cancelled) ? uint256(TimelockStage.Cancelled) : started);
+    }
+
+    function getStage(bytes32 _orderHash) external view returns (TimelockStage) {
+        return _stage(orders[_orderHash]);
+    }
+
+    /**
+     * @dev Announce the current timelock stage (records it and emits StageTransitioned)
      */
     function transitionStage(bytes32 _orderHash) external {
         CrossChainOrder storage order = orders[_orderHash];
         
         TimelockStage currentStage = order.currentStage;
-        TimelockStage newStage = currentStage;
-        
-        if (currentStage == TimelockStage.Active) {
-            if (block.timestamp >= order.withdrawalDeadline) {
-                newStage = TimelockStage.Withdrawal;
-            }
-        } else if (currentStage == TimelockStage.Withdrawal) {
-            if (block.timestamp >= order.publicDeadline) {
-                newStage = TimelockStage.Public;
-            }
-        } else if (currentStage == TimelockStage.Public) {
-            if (block.timestamp >= order.cancellationDeadline) {
-                newStage = TimelockStage.Cancelled;
-            }
-        }
+        TimelockStage newStage = _stage(order);
         
-        if (newStage != currentStage) {
+        if (newStage > currentStage) {
             order.currentStage = newStage;
-            order.stageStartTime = block.timestamp;
             
             emit StageTransitioned(_orderHash, currentStage, newStage, block.timestamp);
         }
@@ -530,9 +590,9 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
     function withdrawFunds(bytes32 _orderHash) external validOrder(_orderHash) {
         CrossChainOrder storage order = orders[_orderHash];
         
-        require(msg.sender == order.maker, "Only maker can withdraw");
-        require(order.currentStage == TimelockStage.Withdrawal, "Not in withdrawal stage");
-        require(!order.executed, "Order already executed");
+        if (msg.sender != order.maker) revert OnlyMakerCanWithdraw();
+        if (_stage(order) != TimelockStage.Withdrawal) revert NotInWithdrawalStage();
+        if (order.executed) revert OrderAlreadyExecuted();
         
         order.refunded = true;
         
@@ -550,9 +610,9 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
     function publicClaim(bytes32 _orderHash, bytes32 _secret) external validOrder(_orderHash) {
         CrossChainOrder storage order = orders[_orderHash];
         
-        require(order.currentStage == TimelockStage.Public, "Not in public stage");
-        require(!order.executed && !order.refunded, "Order already processed");
-        require(keccak256(abi.encodePacked(_secret)) == order.hashlock, "Invalid secret");
+        if (_stage(order) != TimelockStage.Public) revert NotInPublicStage();
+        if (order.executed || order.refunded) revert OrderAlreadyProcessed();
+        if (keccak256(abi.encodePacked(_secret)) != order.hashlock) revert InvalidSecret();
         
         order.executed = true;
         
@@ -616,7 +676,7 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
         uint256 endPrice,
         uint256 minBidIncrement,
         bool active,
-        address[] memory bidders
+        uint256 bidderCount
     ) {
         DutchAuctionConfig storage auction = auctions[_orderHash];
         return (
@@ -626,7 +686,7 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
             auction.endPrice,
             auction.minBidIncrement,
             auction.active,
-            auctionBidders[_orderHash]
+            auctionBidderCount[_orderHash]
         );
     }
 
@@ -642,7 +702,7 @@ contract EnhancedCrossChainResolver is ReentrancyGuard, Ownable, EIP712 {
      */
     function withdrawResolverFees() external {
         uint256 balance = resolverBalances[msg.sender];
-        require(balance > 0, "No fees to withdraw");
+        if (balance == 0) revert NoFeesToWithdraw();
         
         resolverBalances[msg.sender] = 0;
         payable(msg.sender).transfer(balance);
@@ -3,11 +3,14 @@ pragma solidity ^0.8.20;
 
 import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
-import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+import "@openzeppelin/contracts/utils/ReentrancyGuardTransient.sol";
 import "@openzeppelin/contracts/access/Ownable.sol";
 import "@openzeppelin/contracts/utils/cryptography/ECDSA.sol";
 import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
 import "@1inch/limit-order-protocol-contract/contracts/interfaces/ITakerInteraction.sol";
+import "./MultiFillSecretLib.sol";
+import "./AlgorandAddressLib.sol";
+import "@openzeppelin/contracts/utils/cryptography/MerkleProof.sol";
 
 /**
  * @title EnhancedLimitOrderBridge
@@ -15,12 +18,55 @@ import "@1inch/limit-order-protocol-contract/contracts/interfaces/ITakerInteract
  * 
  * 🎯 FEATURES:
  * - Ethereum-only competitive bidding
- * - Partial fill support
+ * - Partial fill support (optionally one secret per part via a Merkle tree)
  * - Bidirectional ETH ↔ ALGO swaps
  * - Automatic best-bid selection
  * - 1inch Fusion+ integration
  */
-contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInteraction {
+contract EnhancedLimitOrderBridge is ReentrancyGuardTransient, Ownable, EIP712, ITakerInteraction {
+    error NotAuthorizedResolver();
+    error OrderDoesNotExist();
+    error OrderAlreadyFilled();
+    error OrderCancelled();
+    error OrderExpired();
+    error InvalidBidIndex();
+    error BidNotActive();
+    error PartialFillsNotAllowed();
+    error InvalidPartsAmount();
+    error InvalidMaker();
+    error InvalidMakerAmount();
+    error InvalidTakerAmount();
+    error InsufficientDeposit();
+    error OrderTooSmall();
+    error InvalidTimelock();
+    error ZeroMinPartialFill();
+    error MinPartialFillTooLarge();
+    error InvalidSignature();
+    error InvalidInputAmount();
+    error InvalidOutputAmount();
+    error InvalidGasEstimate();
+    error OutputTooLow();
+    error InputTooHigh();
+    error NotBidOwner();
+    error OrderRequiresProof();
+    error InvalidSecret();
+    error HTLCExpired();
+    error FillAmountTooLarge();
+    error FillAmountTooSmall();
+    error OrderHasNoSecretTree();
+    error InvalidFillAmount();
+    error FillMustReachNextPart();
+    error InvalidSecretProof();
+    error OnlyMakerCanCancel();
+    error OrderAlreadyCancelled();
+    error TimelockNotExpired();
+    error FeeRateTooHigh();
+    error NoFeesToWithdraw();
+    error InvalidBatchProof();
+    error DepositMismatch();
+    error OrderAlreadyExists();
+    error InsufficientMakerDeposit();
+
     using SafeERC20 for IERC20;
     using ECDSA for bytes32;
 
@@ -39,6 +85,33 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
         uint256 minPartialFill;     // NEW: Minimum partial fill amount
     }
 
+    // 📦 Bit-packed LimitOrderIntent for submitCompactLimitOrder (maker is msg.sender)
+    struct CompactIntent {
+        address makerToken;
+        address takerToken;
+        uint256 amounts;            // makerAmount (bits 0..127) | takerAmount (bits 128..255)
+        uint256 terms;              // deadline (0..39) | algorandChainId (40..71) | minPartialFill (72..167)
+                                    // | flags (168..175) | Algorand address checksum (176..207)
+        bytes32 salt;
+        bytes32 algorandPublicKey;  // Algorand account public key; the address is rebuilt from it
+    }
+
+    // 🪜 One order of a signed batch (submitLimitOrdersFromBatch)
+    struct BatchOrder {
+        LimitOrderIntent intent;
+        bytes32[] proof;            // Merkle proof of the intent's struct hash under the batch root
+        bytes32 hashlock;
+        uint256 timelock;
+    }
+
+    // ⛽ Gasless order: maker signs intent + locks, a relayer submits, funds come from makerDeposits
+    struct RelayedOrder {
+        LimitOrderIntent intent;
+        bytes32 hashlock;
+        uint256 timelock;
+        bytes signature;            // EIP-712 RelayedLimitOrder by intent.maker
+    }
+
     // 🔒 Enhanced Limit Order
     struct LimitOrder {
         LimitOrderIntent intent;    // Original signed intent
@@ -72,6 +145,10 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
     mapping(address => bool) public authorizedResolvers;
     mapping(address => uint256) public resolverBalances;
     mapping(address => uint256) public resolverBidCount;      // NEW: Track resolver activity
+    mapping(bytes32 => uint256) public secretPartsAmount;     // 0 = single hashlock, else hashlock is a secrets root
+    mapping(address => mapping(bytes32 => bool)) public approvedOrderRoots; // maker => batch root => signature checked
+    mapping(address => uint256) public makerDeposits;         // ETH prefunded for relayed (gasless) orders
+    mapping(bytes32 => bool) public usedRelayedOrders;        // RelayedLimitOrder struct hash => submitted
 
     // 🔧 Configuration
     uint256 public algorandAppId;                    // Algorand contract app ID
@@ -80,12 +157,22 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
     uint256 public constant MIN_BID_DURATION = 5 minutes;  // NEW: Minimum bid duration
     uint256 public resolverFeeRate = 50;            // 0.5% resolver fee (50 / 10000)
     uint256 public biddingFeeRate = 10;             // NEW: 0.1% bidding fee
+    uint256 public constant COMPACT_ALLOW_PARTIAL_FILLS = 1 << 0; // CompactIntent flags
 
     // 📋 Enhanced EIP-712 Type Hash
     bytes32 public constant LIMIT_ORDER_TYPEHASH = keccak256(
         "LimitOrderIntent(address maker,address makerToken,address takerToken,uint256 makerAmount,uint256 takerAmount,uint256 deadline,uint256 algorandChainId,string algorandAddress,bytes32 salt,bool allowPartialFills,uint256 minPartialFill)"
     );
 
+    // 🪜 Maker signs one root over many LimitOrderIntent struct hashes (sorted-pair Merkle tree)
+    bytes32 public constant LIMIT_ORDER_BATCH_TYPEHASH = keccak256("LimitOrderBatch(address maker,bytes32 root)");
+
+    // ⛽ Gasless submission: the maker also signs the HTLC locks the relayer will use
+    bytes32 public constant RELAYED_LIMIT_ORDER_TYPEHASH = keccak256(
+        "RelayedLimitOrder(LimitOrderIntent intent,bytes32 hashlock,uint256 timelock)"
+        "LimitOrderIntent(address maker,address makerToken,address takerToken,uint256 makerAmount,uint256 takerAmount,uint256 deadline,uint256 algorandChainId,string algorandAddress,bytes32 salt,bool allowPartialFills,uint256 minPartialFill)"
+    );
+
     // 🎉 Enhanced Events
     event LimitOrderCreated(
         bytes32 indexed orderId,
@@ -145,23 +232,46 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
         uint256 refundAmount
     );
 
+    event MultipleFillsEnabled(
+        bytes32 indexed orderId,
+        bytes32 secretsRoot,
+        uint256 partsAmount
+    );
+
+    event OrderRootApproved(
+        address indexed maker,
+        bytes32 indexed root
+    );
+
+    event MakerDepositChanged(
+        address indexed maker,
+        uint256 balance
+    );
+
+    // Relayed order left out of a batch (replayed, underfunded or failing validation); the rest still go through
+    event RelayedOrderSkipped(
+        bytes32 indexed relayedHash,
+        address indexed maker,
+        bytes4 reason
+    );
+
     // 🔧 Modifiers
     modifier onlyAuthorizedResolver() {
-        require(authorizedResolvers[msg.sender], "Not authorized resolver");
+        if (!authorizedResolvers[msg.sender]) revert NotAuthorizedResolver();
         _;
     }
 
     modifier validOrder(bytes32 orderId) {
-        require(limitOrders[orderId].intent.maker != address(0), "Order does not exist");
-        require(!limitOrders[orderId].filled, "Order already filled");
-        require(!limitOrders[orderId].cancelled, "Order cancelled");
-        require(block.timestamp <= limitOrders[orderId].intent.deadline, "Order expired");
+        if (limitOrders[orderId].intent.maker == address(0)) revert OrderDoesNotExist();
+        if (limitOrders[orderId].filled) revert OrderAlreadyFilled();
+        if (limitOrders[orderId].cancelled) revert OrderCancelled();
+        if (block.timestamp > limitOrders[orderId].intent.deadline) revert OrderExpired();
         _;
     }
 
     modifier validBid(bytes32 orderId, uint256 bidIndex) {
-        require(bidIndex < bids[orderId].length, "Invalid bid index");
-        require(bids[orderId][bidIndex].active, "Bid not active");
+        if (bidIndex >= bids[orderId].length) revert InvalidBidIndex();
+        if (!bids[orderId][bidIndex].active) revert BidNotActive();
         _;
     }
 
@@ -176,31 +286,209 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
         bytes32 hashlock,
         uint256 timelock
     ) external payable nonReentrant returns (bytes32 orderId) {
-        require(intent.maker == msg.sender, "Invalid maker");
-        require(intent.makerAmount > 0, "Invalid maker amount");
-        require(intent.takerAmount > 0, "Invalid taker amount");
-        require(intent.deadline > block.timestamp, "Order expired");
-        require(msg.value >= intent.makerAmount, "Insufficient deposit");
-        require(msg.value >= MIN_ORDER_VALUE, "Order too small");
-        require(timelock == 0 || timelock >= block.timestamp + 1 hours, "Invalid timelock");
+        if (intent.maker != msg.sender) revert InvalidMaker();
+        orderId = _submitLimitOrder(intent, _recoverSigner(intent, signature), hashlock, timelock, msg.value);
+    }
 
-        // Validate partial fill parameters
-        if (intent.allowPartialFills) {
-            require(intent.minPartialFill > 0, "Min partial fill must be > 0");
-            require(intent.minPartialFill <= intent.makerAmount, "Min partial fill too large");
+    /**
+     * 📦 Same as submitLimitOrder with about half the calldata, for L2s.
+     * The maker still signs the full LimitOrderIntent (LIMIT_ORDER_TYPEHASH); the
+     * Algorand address is rebuilt from its public key and checksum, and the
+     * signature is EIP-2098 compact (r, yParity | s).
+     */
+    function submitCompactLimitOrder(
+        CompactIntent calldata compact,
+        bytes32 r,
+        bytes32 vs,
+        bytes32 hashlock,
+        uint256 timelock
+    ) external payable nonReentrant returns (bytes32 orderId) {
+        LimitOrderIntent memory intent = _expandIntent(compact);
+        address signer = _hashTypedDataV4(_hashIntent(intent)).recover(r, vs);
+        orderId = _submitLimitOrder(intent, signer, hashlock, timelock, msg.value);
+    }
+
+    /**
+     * 🪜 Submit one order out of a signed batch.
+     * The first order of a batch carries the maker's LimitOrderBatch signature;
+     * once checked the root is cached, so later orders pass an empty signature.
+     */
+    function submitLimitOrderFromBatch(
+        LimitOrderIntent calldata intent,
+        bytes32 root,
+        bytes32[] calldata proof,
+        bytes calldata rootSignature,
+        bytes32 hashlock,
+        uint256 timelock
+    ) external payable nonReentrant returns (bytes32 orderId) {
+        if (intent.maker != msg.sender) revert InvalidMaker();
+        _checkOrderRoot(intent.maker, root, rootSignature);
+        if (!MerkleProof.verifyCalldata(proof, root, _hashIntent(intent))) revert InvalidBatchProof();
+        orderId = _submitLimitOrder(intent, intent.maker, hashlock, timelock, msg.value);
+    }
+
+    /**
+     * 🪜 Submit many orders of one signed batch in a single transaction.
+     * Each order is funded with exactly its makerAmount; msg.value must be the sum.
+     */
+    function submitLimitOrdersFromBatch(
+        BatchOrder[] calldata orders,
+        bytes32 root,
+        bytes calldata rootSignature
+    ) external payable nonReentrant returns (bytes32[] memory orderIds) {
+        _checkOrderRoot(msg.sender, root, rootSignature);
+
+        orderIds = new bytes32[](orders.length);
+        uint256 funded = 0;
+        for (uint256 i = 0; i < orders.length; ++i) {
+            BatchOrder calldata order = orders[i];
+            if (!MerkleProof.verifyCalldata(order.proof, root, _hashIntent(order.intent))) revert InvalidBatchProof();
+            funded += order.intent.makerAmount;
+            orderIds[i] = _submitLimitOrder(order.intent, msg.sender, order.hashlock, order.timelock, order.intent.makerAmount);
+        }
+        if (funded != msg.value) revert DepositMismatch();
+    }
+
+    /**
+     * ⛽ Prefund relayed orders; withdrawMakerDeposit returns what is not locked in orders
+     */
+    function depositForRelayedOrders() external payable {
+        makerDeposits[msg.sender] += msg.value;
+        emit MakerDepositChanged(msg.sender, makerDeposits[msg.sender]);
+    }
+
+    function withdrawMakerDeposit(uint256 amount) external nonReentrant {
+        if (makerDeposits[msg.sender] < amount) revert InsufficientMakerDeposit();
+        makerDeposits[msg.sender] -= amount;
+        emit MakerDepositChanged(msg.sender, makerDeposits[msg.sender]);
+        payable(msg.sender).transfer(amount);
+    }
+
+    /**
+     * ⛽ Submit many makers' signed orders in one transaction (relayer intent pool flush).
+     * Each order locks its makerAmount from the maker's deposit. An order that was
+     * already submitted, is underfunded or fails any _submitError check (including
+     * a bad signature) is skipped with RelayedOrderSkipped and gets orderId 0;
+     * the batch itself never reverts on a single order.
+     */
+    function submitRelayedLimitOrders(
+        RelayedOrder[] calldata orders
+    ) external nonReentrant returns (bytes32[] memory orderIds) {
+        orderIds = new bytes32[](orders.length);
+        for (uint256 i = 0; i < orders.length; ++i) {
+            RelayedOrder calldata order = orders[i];
+            LimitOrderIntent calldata intent = order.intent;
+            bytes32 relayedHash = keccak256(abi.encode(
+                RELAYED_LIMIT_ORDER_TYPEHASH,
+                _hashIntent(intent),
+                order.hashlock,
+                order.timelock
+            ));
+
+            (address signer, ECDSA.RecoverError recoverError, ) = _hashTypedDataV4(relayedHash).tryRecover(order.signature);
+            bytes32 orderId = _orderId(intent, intent.makerAmount);
+
+            bytes4 skipped;
+            if (usedRelayedOrders[relayedHash]) skipped = OrderAlreadyExists.selector;
+            else if (makerDeposits[intent.maker] < intent.makerAmount) skipped = InsufficientMakerDeposit.selector;
+            else if (recoverError != ECDSA.RecoverError.NoError) skipped = InvalidSignature.selector;
+            else skipped = _submitError(intent, signer, orderId, order.timelock, intent.makerAmount);
+            if (skipped != bytes4(0)) {
+                emit RelayedOrderSkipped(relayedHash, intent.maker, skipped);
+                continue;
+            }
+
+            usedRelayedOrders[relayedHash] = true;
+            makerDeposits[intent.maker] -= intent.makerAmount;
+            _storeLimitOrder(intent, orderId, order.hashlock, order.timelock, intent.makerAmount);
+            orderIds[i] = orderId;
         }
+    }
+
+    /**
+     * 🌳 Submit limit order whose partial fills each reveal their own secret
+     * @param secretsRoot Root over partsAmount + 1 leaves (see MultiFillSecretLib)
+     * @param partsAmount Number of parts the order is split into
+     */
+    function submitLimitOrderWithSecretTree(
+        LimitOrderIntent calldata intent,
+        bytes calldata signature,
+        bytes32 secretsRoot,
+        uint256 partsAmount,
+        uint256 timelock
+    ) external payable nonReentrant returns (bytes32 orderId) {
+        if (!intent.allowPartialFills) revert PartialFillsNotAllowed();
+        if (partsAmount <= 1) revert InvalidPartsAmount();
+
+        if (intent.maker != msg.sender) revert InvalidMaker();
+        orderId = _submitLimitOrder(intent, _recoverSigner(intent, signature), secretsRoot, timelock, msg.value);
+        secretPartsAmount[orderId] = partsAmount;
 
-        // Generate unique order ID
-        orderId = keccak256(abi.encodePacked(
+        emit MultipleFillsEnabled(orderId, secretsRoot, partsAmount);
+    }
+
+    function _submitLimitOrder(
+        LimitOrderIntent memory intent,
+        address signer,
+        bytes32 hashlock,
+        uint256 timelock,
+        uint256 deposit
+    ) internal returns (bytes32 orderId) {
+        orderId = _orderId(intent, deposit);
+        bytes4 err = _submitError(intent, signer, orderId, timelock, deposit);
+        if (err != bytes4(0)) _revertWith(err);
+
+        _storeLimitOrder(intent, orderId, hashlock, timelock, deposit);
+    }
+
+    function _orderId(LimitOrderIntent memory intent, uint256 deposit) internal view returns (bytes32) {
+        return keccak256(abi.encodePacked(
             intent.maker,
             intent.salt,
             block.timestamp,
-            msg.value
+            deposit
         ));
+    }
+
+    /**
+     * Every submit-time check, as the selector of the error it fails (0 if none).
+     * Direct submits revert with it; relayed batches skip the order instead.
+     */
+    function _submitError(
+        LimitOrderIntent memory intent,
+        address signer,
+        bytes32 orderId,
+        uint256 timelock,
+        uint256 deposit
+    ) internal view returns (bytes4) {
+        if (intent.makerAmount == 0) return InvalidMakerAmount.selector;
+        if (intent.takerAmount == 0) return InvalidTakerAmount.selector;
+        if (intent.deadline <= block.timestamp) return OrderExpired.selector;
+        if (deposit < intent.makerAmount) return InsufficientDeposit.selector;
+        if (deposit < MIN_ORDER_VALUE) return OrderTooSmall.selector;
+        if (timelock != 0 && timelock < block.timestamp + 1 hours) return InvalidTimelock.selector;
+
+        // Validate partial fill parameters
+        if (intent.allowPartialFills) {
+            if (intent.minPartialFill == 0) return ZeroMinPartialFill.selector;
+            if (intent.minPartialFill > intent.makerAmount) return MinPartialFillTooLarge.selector;
+        }
+
+        // Orders of one batch share a block; a reused salt must not overwrite an order
+        if (limitOrders[orderId].intent.maker != address(0)) return OrderAlreadyExists.selector;
 
         // Verify EIP-712 signature
-        require(_verifySignature(intent, signature, intent.maker), "Invalid signature");
+        if (signer != intent.maker) return InvalidSignature.selector;
+        return bytes4(0);
+    }
 
+    function _storeLimitOrder(
+        LimitOrderIntent memory intent,
+        bytes32 orderId,
+        bytes32 hashlock,
+        uint256 timelock,
+        uint256 deposit
+    ) internal {
         // Set default timelock if not provided
         if (timelock == 0) {
             timelock = block.timestamp + DEFAULT_TIMELOCK;
@@ -211,7 +499,7 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
             intent: intent,
             hashlock: hashlock,
             timelock: timelock,
-            depositedAmount: msg.value,
+            depositedAmount: deposit,
             remainingAmount: intent.makerAmount,  // Initialize remaining amount
             filled: false,
             cancelled: false,
@@ -256,9 +544,9 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
         LimitOrder storage order = limitOrders[orderId];
         
         // Validate bid parameters
-        require(inputAmount > 0, "Invalid input amount");
-        require(outputAmount > 0, "Invalid output amount");
-        require(gasEstimate > 0, "Invalid gas estimate");
+        if (inputAmount == 0) revert InvalidInputAmount();
+        if (outputAmount == 0) revert InvalidOutputAmount();
+        if (gasEstimate == 0) revert InvalidGasEstimate();
 
         // Calculate total cost including gas
         uint256 gasCost = gasEstimate * tx.gasprice;
@@ -267,10 +555,10 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
         // Validate bid meets order requirements
         if (order.intent.makerToken == address(0)) {
             // ETH → ALGO: Higher output = better rate
-            require(outputAmount >= order.intent.takerAmount, "Output too low");
+            if (outputAmount < order.intent.takerAmount) revert OutputTooLow();
         } else {
             // ALGO → ETH: Lower input = better rate
-            require(inputAmount <= order.intent.makerAmount, "Input too high");
+            if (inputAmount > order.intent.makerAmount) revert InputTooHigh();
         }
 
         // Create new bid
@@ -303,7 +591,7 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
      */
     function withdrawBid(bytes32 orderId, uint256 bidIndex) external validBid(orderId, bidIndex) {
         Bid storage bid = bids[orderId][bidIndex];
-        require(bid.resolver == msg.sender, "Not your bid");
+        if (bid.resolver != msg.sender) revert NotBidOwner();
 
         bid.active = false;
         resolverBidCount[msg.sender]--;
@@ -321,12 +609,13 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
     ) external onlyAuthorizedResolver validOrder(orderId) validBid(orderId, bidIndex) {
         LimitOrder storage order = limitOrders[orderId];
         Bid storage bid = bids[orderId][bidIndex];
+        if (secretPartsAmount[orderId] != 0) revert OrderRequiresProof();
 
         // Verify secret matches hashlock
-        require(keccak256(abi.encodePacked(secret)) == order.hashlock, "Invalid secret");
+        if (keccak256(abi.encodePacked(secret)) != order.hashlock) revert InvalidSecret();
         
         // Verify timelock hasn't expired
-        require(block.timestamp <= order.timelock, "HTLC expired");
+        if (block.timestamp > order.timelock) revert HTLCExpired();
 
         // Mark bid as winning
         order.winningBid = bid;
@@ -354,11 +643,52 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
     ) external onlyAuthorizedResolver validOrder(orderId) {
         LimitOrder storage order = limitOrders[orderId];
         
-        require(order.intent.allowPartialFills, "Partial fills not allowed");
-        require(fillAmount <= order.remainingAmount, "Fill amount too large");
-        require(fillAmount >= order.intent.minPartialFill, "Fill amount too small");
-        require(keccak256(abi.encodePacked(secret)) == order.hashlock, "Invalid secret");
-        require(block.timestamp <= order.timelock, "HTLC expired");
+        if (!order.intent.allowPartialFills) revert PartialFillsNotAllowed();
+        if (secretPartsAmount[orderId] != 0) revert OrderRequiresProof();
+        if (fillAmount > order.remainingAmount) revert FillAmountTooLarge();
+        if (fillAmount < order.intent.minPartialFill) revert FillAmountTooSmall();
+        if (keccak256(abi.encodePacked(secret)) != order.hashlock) revert InvalidSecret();
+
+        _executePartialFill(orderId, order, fillAmount, algorandAmount);
+    }
+
+    /**
+     * 🌳 Execute one part of a secret-tree order, revealing only that part's secret
+     * @param proof Merkle proof for leaf (secretIndex, keccak256(secret))
+     */
+    function executePartialFillWithProof(
+        bytes32 orderId,
+        uint256 fillAmount,
+        uint256 algorandAmount,
+        bytes32 secret,
+        bytes32[] calldata proof
+    ) external onlyAuthorizedResolver validOrder(orderId) {
+        LimitOrder storage order = limitOrders[orderId];
+        uint256 partsAmount = secretPartsAmount[orderId];
+        
+        if (partsAmount == 0) revert OrderHasNoSecretTree();
+        if (fillAmount == 0 || fillAmount > order.remainingAmount) revert InvalidFillAmount();
+        if (fillAmount < order.intent.minPartialFill && fillAmount != order.remainingAmount) revert FillAmountTooSmall();
+
+        (bool validIndex, uint256 idx) = MultiFillSecretLib.secretIndex(
+            order.intent.makerAmount,
+            order.intent.makerAmount - order.remainingAmount,
+            fillAmount,
+            partsAmount
+        );
+        if (!validIndex) revert FillMustReachNextPart();
+        if (!MultiFillSecretLib.verify(order.hashlock, idx, secret, proof)) revert InvalidSecretProof();
+
+        _executePartialFill(orderId, order, fillAmount, algorandAmount);
+    }
+
+    function _executePartialFill(
+        bytes32 orderId,
+        LimitOrder storage order,
+        uint256 fillAmount,
+        uint256 algorandAmount
+    ) internal {
+        if (block.timestamp > order.timelock) revert HTLCExpired();
 
         // Calculate proportional amounts
         uint256 proportionalAlgorand = (algorandAmount * fillAmount) / order.intent.makerAmount;
@@ -447,10 +777,18 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
     /**
      * 🔍 View Functions
      */
+    function getOrder(bytes32 orderId) external view returns (LimitOrder memory) {
+        return limitOrders[orderId];
+    }
+
     function getBids(bytes32 orderId) external view returns (Bid[] memory) {
         return bids[orderId];
     }
 
+    function getBidCount(bytes32 orderId) external view returns (uint256) {
+        return bids[orderId].length;
+    }
+
     function getActiveBids(bytes32 orderId) external view returns (Bid[] memory) {
         Bid[] memory allBids = bids[orderId];
         Bid[] memory activeBids = new Bid[](allBids.length);
@@ -496,7 +834,7 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
      */
     function cancelLimitOrder(bytes32 orderId) external validOrder(orderId) nonReentrant {
         LimitOrder storage order = limitOrders[orderId];
-        require(order.intent.maker == msg.sender, "Only maker can cancel");
+        if (order.intent.maker != msg.sender) revert OnlyMakerCanCancel();
 
         order.cancelled = true;
 
@@ -512,10 +850,10 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
      */
     function refundExpiredOrder(bytes32 orderId) external nonReentrant {
         LimitOrder storage order = limitOrders[orderId];
-        require(order.intent.maker != address(0), "Order does not exist");
-        require(!order.filled, "Order already filled");
-        require(!order.cancelled, "Order already cancelled");
-        require(block.timestamp > order.timelock, "Timelock not expired");
+        if (order.intent.maker == address(0)) revert OrderDoesNotExist();
+        if (order.filled) revert OrderAlreadyFilled();
+        if (order.cancelled) revert OrderAlreadyCancelled();
+        if (block.timestamp <= order.timelock) revert TimelockNotExpired();
 
         order.cancelled = true;
 
@@ -538,7 +876,7 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
     }
 
     function setResolverFeeRate(uint256 newRate) external onlyOwner {
-        require(newRate <= 1000, "Fee rate too high"); // Max 10%
+        if (newRate > 1000) revert FeeRateTooHigh(); // Max 10%
         resolverFeeRate = newRate;
     }
 
@@ -547,21 +885,44 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
      */
     function withdrawResolverFees() external {
         uint256 balance = resolverBalances[msg.sender];
-        require(balance > 0, "No fees to withdraw");
+        if (balance == 0) revert NoFeesToWithdraw();
 
         resolverBalances[msg.sender] = 0;
         payable(msg.sender).transfer(balance);
     }
 
     /**
-     * 🔐 Internal signature verification
+     * 🔐 Signer of the EIP-712 LimitOrderIntent
      */
-    function _verifySignature(
+    function _recoverSigner(
         LimitOrderIntent calldata intent,
-        bytes calldata signature,
-        address expectedSigner
-    ) internal view returns (bool) {
-        bytes32 structHash = keccak256(abi.encode(
+        bytes calldata signature
+    ) internal view returns (address) {
+        return _hashTypedDataV4(_hashIntent(intent)).recover(signature);
+    }
+
+    function _revertWith(bytes4 selector) private pure {
+        assembly ("memory-safe") {
+            mstore(0, selector)
+            revert(0, 4)
+        }
+    }
+
+    /**
+     * 🪜 Check the maker's LimitOrderBatch signature once per root, then trust the cache
+     */
+    function _checkOrderRoot(address maker, bytes32 root, bytes calldata rootSignature) internal {
+        if (approvedOrderRoots[maker][root]) return;
+
+        bytes32 structHash = keccak256(abi.encode(LIMIT_ORDER_BATCH_TYPEHASH, maker, root));
+        if (_hashTypedDataV4(structHash).recover(rootSignature) != maker) revert InvalidSignature();
+        approvedOrderRoots[maker][root] = true;
+
+        emit OrderRootApproved(maker, root);
+    }
+
+    function _hashIntent(LimitOrderIntent memory intent) internal pure returns (bytes32) {
+        return keccak256(abi.encode(
             LIMIT_ORDER_TYPEHASH,
             intent.maker,
             intent.makerToken,
@@ -575,9 +936,26 @@ contract EnhancedLimitOrderBridge is ReentrancyGuard, Ownable, EIP712, ITakerInt
             intent.allowPartialFills,
             intent.minPartialFill
         ));
+    }
 
-        bytes32 hash = _hashTypedDataV4(structHash);
-        return hash.recover(signature) == expectedSigner;
+    /**
+     * 📦 CompactIntent → LimitOrderIntent (maker is msg.sender)
+     */
+    function _expandIntent(CompactIntent calldata compact) internal view returns (LimitOrderIntent memory intent) {
+        uint256 terms = compact.terms;
+        intent = LimitOrderIntent({
+            maker: msg.sender,
+            makerToken: compact.makerToken,
+            takerToken: compact.takerToken,
+            makerAmount: uint128(compact.amounts),
+            takerAmount: compact.amounts >> 128,
+            deadline: uint40(terms),
+            algorandChainId: uint32(terms >> 40),
+            algorandAddress: AlgorandAddressLib.encode(compact.algorandPublicKey, bytes4(uint32(terms >> 176))),
+            salt: compact.salt,
+            allowPartialFills: (terms >> 168) & COMPACT_ALLOW_PARTIAL_FILLS != 0,
+            minPartialFill: uint96(terms >> 72)
+        });
     }
 
     /**
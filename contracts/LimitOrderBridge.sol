@@ -3,10 +3,11 @@ pragma solidity ^0.8.20;
 
 import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
-import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+import "@openzeppelin/contracts/utils/ReentrancyGuardTransient.sol";
 import "@openzeppelin/contracts/access/Ownable.sol";
 import "@openzeppelin/contracts/utils/cryptography/ECDSA.sol";
 import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
+import "./BridgeTimelocksLib.sol";
 
 /**
  * @title LimitOrderBridge
@@ -27,9 +28,31 @@ import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
  * - Dutch auction mechanisms for competitive resolver selection
  * - Threshold-based user protection
  */
-contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
+contract LimitOrderBridge is ReentrancyGuardTransient, Ownable, EIP712 {
+    error NotAuthorizedResolver();
+    error OrderDoesNotExist();
+    error OrderAlreadyFilled();
+    error OrderCancelled();
+    error OrderExpired();
+    error InvalidMaker();
+    error InvalidMakerAmount();
+    error InvalidTakerAmount();
+    error InsufficientDeposit();
+    error OrderTooSmall();
+    error InvalidTimelock();
+    error InvalidSignature();
+    error InvalidSecret();
+    error HTLCExpired();
+    error InsufficientOutput();
+    error OnlyMakerCanCancel();
+    error OrderAlreadyCancelled();
+    error TimelockNotExpired();
+    error FeeRateTooHigh();
+    error NoFeesToWithdraw();
+
     using SafeERC20 for IERC20;
     using ECDSA for bytes32;
+    using BridgeTimelocksLib for Timelocks;
 
     // 🎯 Limit Order Intent Structure (EIP-712)
     struct LimitOrderIntent {
@@ -48,11 +71,10 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
     struct LimitOrder {
         LimitOrderIntent intent;    // Original signed intent
         bytes32 hashlock;          // Secret hash for HTLC
-        uint256 timelock;          // HTLC expiry
+        Timelocks timelocks;       // Creation time + HTLC stages (expiry = cancellationStart)
         uint256 depositedAmount;   // Actual deposited amount
         bool filled;               // Whether order has been filled
         bool cancelled;            // Whether order has been cancelled
-        uint256 createdAt;         // Creation timestamp
         address resolver;          // Resolver who filled the order
     }
 
@@ -105,15 +127,15 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
 
     // 🔧 Modifiers
     modifier onlyAuthorizedResolver() {
-        require(authorizedResolvers[msg.sender], "Not authorized resolver");
+        if (!authorizedResolvers[msg.sender]) revert NotAuthorizedResolver();
         _;
     }
 
     modifier validOrder(bytes32 orderId) {
-        require(limitOrders[orderId].intent.maker != address(0), "Order does not exist");
-        require(!limitOrders[orderId].filled, "Order already filled");
-        require(!limitOrders[orderId].cancelled, "Order cancelled");
-        require(block.timestamp <= limitOrders[orderId].intent.deadline, "Order expired");
+        if (limitOrders[orderId].intent.maker == address(0)) revert OrderDoesNotExist();
+        if (limitOrders[orderId].filled) revert OrderAlreadyFilled();
+        if (limitOrders[orderId].cancelled) revert OrderCancelled();
+        if (block.timestamp > limitOrders[orderId].intent.deadline) revert OrderExpired();
         _;
     }
 
@@ -131,13 +153,13 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         bytes32 hashlock,
         uint256 timelock
     ) external payable nonReentrant returns (bytes32 orderId) {
-        require(intent.maker == msg.sender, "Invalid maker");
-        require(intent.makerAmount > 0, "Invalid maker amount");
-        require(intent.takerAmount > 0, "Invalid taker amount");
-        require(intent.deadline > block.timestamp, "Order expired");
-        require(msg.value >= intent.makerAmount, "Insufficient deposit");
-        require(msg.value >= MIN_ORDER_VALUE, "Order too small");
-        require(timelock == 0 || timelock >= block.timestamp + 1 hours, "Invalid timelock");
+        if (intent.maker != msg.sender) revert InvalidMaker();
+        if (intent.makerAmount == 0) revert InvalidMakerAmount();
+        if (intent.takerAmount == 0) revert InvalidTakerAmount();
+        if (intent.deadline <= block.timestamp) revert OrderExpired();
+        if (msg.value < intent.makerAmount) revert InsufficientDeposit();
+        if (msg.value < MIN_ORDER_VALUE) revert OrderTooSmall();
+        if (timelock != 0 && timelock < block.timestamp + 1 hours) revert InvalidTimelock();
 
         // Generate unique order ID
         orderId = keccak256(abi.encodePacked(
@@ -148,7 +170,7 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         ));
 
         // Verify EIP-712 signature
-        require(_verifySignature(intent, signature, intent.maker), "Invalid signature");
+        if (!_verifySignature(intent, signature, intent.maker)) revert InvalidSignature();
 
         // Set default timelock if not provided
         if (timelock == 0) {
@@ -159,11 +181,10 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         limitOrders[orderId] = LimitOrder({
             intent: intent,
             hashlock: hashlock,
-            timelock: timelock,
+            timelocks: BridgeTimelocksLib.untilExpiry(block.timestamp, timelock),
             depositedAmount: msg.value,
             filled: false,
             cancelled: false,
-            createdAt: block.timestamp,
             resolver: address(0)
         });
 
@@ -193,13 +214,13 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         LimitOrder storage order = limitOrders[orderId];
 
         // Verify secret matches hashlock
-        require(keccak256(abi.encodePacked(secret)) == order.hashlock, "Invalid secret");
+        if (keccak256(abi.encodePacked(secret)) != order.hashlock) revert InvalidSecret();
         
         // Verify timelock hasn't expired
-        require(block.timestamp <= order.timelock, "HTLC expired");
+        if (block.timestamp >= order.timelocks.cancellationStart()) revert HTLCExpired();
         
         // Verify minimum output amount
-        require(algorandAmount >= order.intent.takerAmount, "Insufficient output");
+        if (algorandAmount < order.intent.takerAmount) revert InsufficientOutput();
 
         // Calculate resolver fee
         uint256 resolverFee = (order.depositedAmount * resolverFeeRate) / 10000;
@@ -229,7 +250,7 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
      */
     function cancelLimitOrder(bytes32 orderId) external validOrder(orderId) nonReentrant {
         LimitOrder storage order = limitOrders[orderId];
-        require(order.intent.maker == msg.sender, "Only maker can cancel");
+        if (order.intent.maker != msg.sender) revert OnlyMakerCanCancel();
 
         order.cancelled = true;
 
@@ -245,10 +266,10 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
      */
     function refundExpiredOrder(bytes32 orderId) external nonReentrant {
         LimitOrder storage order = limitOrders[orderId];
-        require(order.intent.maker != address(0), "Order does not exist");
-        require(!order.filled, "Order already filled");
-        require(!order.cancelled, "Order already cancelled");
-        require(block.timestamp > order.timelock, "Timelock not expired");
+        if (order.intent.maker == address(0)) revert OrderDoesNotExist();
+        if (order.filled) revert OrderAlreadyFilled();
+        if (order.cancelled) revert OrderAlreadyCancelled();
+        if (block.timestamp < order.timelocks.cancellationStart()) revert TimelockNotExpired();
 
         order.cancelled = true;
 
@@ -273,7 +294,7 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
     }
 
     function setResolverFeeRate(uint256 newRate) external onlyOwner {
-        require(newRate <= 1000, "Fee rate too high"); // Max 10%
+        if (newRate > 1000) revert FeeRateTooHigh(); // Max 10%
         resolverFeeRate = newRate;
     }
 
@@ -282,7 +303,7 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
      */
     function withdrawResolverFees() external {
         uint256 balance = resolverBalances[msg.sender];
-        require(balance > 0, "No fees to withdraw");
+        if (balance == 0) revert NoFeesToWithdraw();
 
         resolverBalances[msg.sender] = 0;
         payable(msg.sender).transfer(balance);
@@ -307,6 +328,10 @@ contract LimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         return limitOrders[orderId].hashlock;
     }
 
+    function getOrderExpiry(bytes32 orderId) external view returns (uint256) {
+        return limitOrders[orderId].timelocks.cancellationStart();
+    }
+
     /**
      * 🔐 Internal signature verification
      */
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.20;
+
+import "@openzeppelin/contracts/utils/cryptography/MerkleProof.sol";
+
+/**
+ * @title MultiFillSecretLib
+ * @dev Merkle tree of secrets for orders filled in parts (1inch Fusion+ multiple fills).
+ *
+ * An order split into N parts commits to N + 1 secrets. Leaf i is
+ * keccak256(abi.encodePacked(uint64(i), keccak256(secret_i))) and the order's
+ * hashlock is the tree root (OpenZeppelin sorted-pair hashing). A fill that takes
+ * the filled amount into part k must reveal secret k; the fill that completes the
+ * order reveals secret N. Revealing one secret exposes nothing about the others,
+ * so resolvers can hold and fill different parts concurrently.
+ *
+ * Index rule mirrors BaseEscrowFactory._isValidPartialFill; the off-chain twin is
+ * scripts/secretTree.cjs.
+ */
+library MultiFillSecretLib {
+    using MerkleProof for bytes32[];
+
+    function leaf(uint256 idx, bytes32 secretHash) internal pure returns (bytes32) {
+        return keccak256(abi.encodePacked(uint64(idx), secretHash));
+    }
+
+    /**
+     * @dev Secret index a fill of `fillAmount` must reveal, given `filledBefore` of `orderAmount`.
+     * Returns valid = false when the fill ends in the same part as the previous fill.
+     */
+    function secretIndex(
+        uint256 orderAmount,
+        uint256 filledBefore,
+        uint256 fillAmount,
+        uint256 partsAmount
+    ) internal pure returns (bool valid, uint256 idx) {
+        uint256 filledAfter = filledBefore + fillAmount;
+        idx = (filledAfter - 1) * partsAmount / orderAmount;
+
+        if (filledAfter == orderAmount) {
+            // Completing fill uses the extra secret after the last part
+            return (true, idx + 1);
+        }
+        if (filledBefore != 0 && (filledBefore - 1) * partsAmount / orderAmount == idx) {
+            return (false, idx);
+        }
+        return (true, idx);
+    }
+
+    function verify(
+        bytes32 root,
+        uint256 idx,
+        bytes32 secret,
+        bytes32[] calldata proof
+    ) internal pure returns (bool) {
+        return proof.processProofCalldata(leaf(idx, keccak256(abi.encodePacked(secret)))) == root;
+    }
+}
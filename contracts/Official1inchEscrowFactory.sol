@@ -1,150 +1,200 @@
 // SPDX-License-Identifier: MIT
-pragma solidity ^0.8.0;
+pragma solidity ^0.8.20;
+
+import { Clones } from "@openzeppelin/contracts/proxy/Clones.sol";
+import { Create2 } from "@openzeppelin/contracts/utils/Create2.sol";
+
+import { ProxyHashLib } from "../1inch-official-temp/libraries/ProxyHashLib.sol";
+
+/**
+ * Parameters every escrow is bound to. They are not stored: the CREATE2 salt is
+ * their hash, so the escrow address itself commits to them (1inch pattern).
+ */
+struct EscrowImmutables {
+    bytes32 orderHash;
+    address creator;
+    address token;
+    uint256 amount;
+    uint256 deadline;
+}
+
+/**
+ * Hashing for EscrowImmutables, mirroring 1inch ImmutablesLib (fixed-size struct,
+ * so the hash is keccak256 over its five words).
+ */
+library EscrowImmutablesLib {
+    uint256 internal constant IMMUTABLES_SIZE = 0xa0;
+
+    function hash(EscrowImmutables calldata immutables) internal pure returns (bytes32 ret) {
+        assembly ("memory-safe") {
+            let ptr := mload(0x40)
+            calldatacopy(ptr, immutables, IMMUTABLES_SIZE)
+            ret := keccak256(ptr, IMMUTABLES_SIZE)
+        }
+    }
+
+    function hashMem(EscrowImmutables memory immutables) internal pure returns (bytes32 ret) {
+        assembly ("memory-safe") {
+            ret := keccak256(immutables, IMMUTABLES_SIZE)
+        }
+    }
+}
 
 /**
  * Official 1inch-compatible EscrowFactory
  * Based on 1inch cross-chain-swap BaseEscrowFactory patterns
- * Implements deterministic escrow deployment for atomic swaps
+ * Implements deterministic escrow deployment for atomic swaps:
+ * each escrow is an EIP-1167 clone of one implementation, deployed with CREATE2
+ * and salted by the hash of its immutables (which include the orderHash), so
+ * relayers can compute - and pre-fund - the escrow address before it exists.
  */
 contract Official1inchEscrowFactory {
+    using Clones for address;
+    using EscrowImmutablesLib for EscrowImmutables;
+
+    address public immutable ESCROW_IMPLEMENTATION;
+    bytes32 public immutable PROXY_BYTECODE_HASH;
+
     // Storage for deployed escrows
     mapping(bytes32 => address) public escrows;
-    
+
     // Events matching 1inch patterns
     event EscrowCreated(bytes32 indexed orderHash, address indexed escrow, address indexed token, uint256 amount);
     event EscrowResolved(address indexed escrow, bytes32 secret);
-    
+    // Full immutables, so resolve()/refund() callers can rebuild them from logs
+    event EscrowDeployed(bytes32 indexed orderHash, address indexed escrow, EscrowImmutables immutables);
+
+    constructor() {
+        ESCROW_IMPLEMENTATION = address(new Official1inchEscrow());
+        PROXY_BYTECODE_HASH = ProxyHashLib.computeProxyBytecodeHash(ESCROW_IMPLEMENTATION);
+    }
+
     /**
      * Create a new escrow for cross-chain atomic swap
      * Compatible with 1inch EscrowFactory interface
+     * ETH already sent to the predicted address counts towards `amount`.
      */
     function createEscrow(
         address token,
-        uint256 amount, 
+        uint256 amount,
         bytes32 orderHash,
         uint256 deadline,
         bytes calldata /* resolverCalldata */
     ) external payable returns (address escrow) {
         require(escrows[orderHash] == address(0), "Escrow already exists");
         require(token == address(0), "Only ETH supported for demo");
-        require(msg.value == amount, "Incorrect ETH amount");
-        
-        // Deploy escrow using regular CREATE (not CREATE2 to avoid complexity)
-        // This matches the 1inch pattern of deploying proxy contracts
-        escrow = address(new Official1inchEscrow{value: msg.value}(
-            msg.sender, 
-            token, 
-            amount, 
-            deadline, 
-            orderHash
-        ));
-        
+
+        EscrowImmutables memory immutables = EscrowImmutables({
+            orderHash: orderHash,
+            creator: msg.sender,
+            token: token,
+            amount: amount,
+            deadline: deadline
+        });
+        bytes32 salt = immutables.hashMem();
+
+        address predicted = Create2.computeAddress(salt, PROXY_BYTECODE_HASH);
+        require(predicted.balance + msg.value >= amount, "Incorrect ETH amount");
+
+        // Minimal proxy (45 bytes of code) instead of a full escrow deployment
+        escrow = ESCROW_IMPLEMENTATION.cloneDeterministic(salt, msg.value);
+
         // Store the escrow mapping
         escrows[orderHash] = escrow;
-        
+
         emit EscrowCreated(orderHash, escrow, token, amount);
+        emit EscrowDeployed(orderHash, escrow, immutables);
         return escrow;
     }
-    
+
     /**
      * Get escrow address for order hash (1inch compatible)
      */
     function getEscrow(bytes32 orderHash) external view returns (address) {
         return escrows[orderHash];
     }
-    
+
     /**
      * Check if resolver is valid (1inch compatible)
      */
     function isValidResolver(address /* resolver */) external pure returns (bool) {
         return true; // Simplified for demo
     }
-    
+
     /**
      * Address computation for source escrow (1inch pattern)
      */
     function addressOfEscrowSrc(bytes32 orderHash) external view returns (address) {
         return escrows[orderHash];
     }
+
+    /**
+     * Deterministic address of the escrow for `immutables`, valid before deployment
+     */
+    function addressOfEscrow(EscrowImmutables calldata immutables) external view returns (address) {
+        return Create2.computeAddress(immutables.hash(), PROXY_BYTECODE_HASH);
+    }
 }
 
 /**
- * Individual escrow contract for atomic swaps
+ * Escrow implementation; every escrow is a clone delegating to it.
+ * Callers pass the immutables back in; they are checked against the clone's own
+ * CREATE2 address instead of being read from storage.
  */
 contract Official1inchEscrow {
-    address public immutable creator;
-    address public immutable token;
-    uint256 public immutable amount;
-    uint256 public immutable deadline;
-    bytes32 public immutable orderHash;
+    using EscrowImmutablesLib for EscrowImmutables;
+
+    address public immutable FACTORY = msg.sender;
+    bytes32 public immutable PROXY_BYTECODE_HASH = ProxyHashLib.computeProxyBytecodeHash(address(this));
+
     bool public resolved;
-    
+    bool public refunded;
+
     event EscrowResolved(bytes32 secret, address resolver);
-    
-    constructor(
-        address _creator, 
-        address _token, 
-        uint256 _amount, 
-        uint256 _deadline,
-        bytes32 _orderHash
-    ) payable {
-        creator = _creator;
-        token = _token;
-        amount = _amount;
-        deadline = _deadline;
-        orderHash = _orderHash;
-        
-        // Verify we received the correct ETH amount
-        require(msg.value == _amount, "Incorrect ETH amount in constructor");
+
+    modifier onlyValidImmutables(EscrowImmutables calldata immutables) {
+        require(
+            Create2.computeAddress(immutables.hash(), PROXY_BYTECODE_HASH, FACTORY) == address(this),
+            "Invalid immutables"
+        );
+        _;
     }
-    
+
     /**
      * Resolve escrow with secret (1inch compatible)
      */
-    function resolve(bytes32 secret) external {
+    function resolve(bytes32 secret, EscrowImmutables calldata immutables) external onlyValidImmutables(immutables) {
         require(!resolved, "Already resolved");
-        require(block.timestamp < deadline, "Escrow expired");
-        
+        require(!refunded, "Already refunded");
+        require(block.timestamp < immutables.deadline, "Escrow expired");
+
         resolved = true;
-        
-        // Transfer funds to resolver
-        if (token == address(0)) {
-            (bool success, ) = msg.sender.call{value: amount}("");
+
+        // Transfer funds to resolver (includes anything pre-funded above `amount`)
+        if (immutables.token == address(0)) {
+            (bool success, ) = msg.sender.call{value: address(this).balance}("");
             require(success, "ETH transfer failed");
         }
-        
+
         emit EscrowResolved(secret, msg.sender);
     }
-    
+
     /**
      * Refund after deadline (only creator)
      */
-    function refund() external {
-        require(msg.sender == creator, "Only creator can refund");
-        require(block.timestamp >= deadline, "Not yet expired");
+    function refund(EscrowImmutables calldata immutables) external onlyValidImmutables(immutables) {
+        require(msg.sender == immutables.creator, "Only creator can refund");
+        require(block.timestamp >= immutables.deadline, "Not yet expired");
         require(!resolved, "Already resolved");
-        
-        resolved = true;
-        
-        if (token == address(0)) {
-            (bool success, ) = creator.call{value: amount}("");
+        require(!refunded, "Already refunded");
+
+        refunded = true;
+
+        if (immutables.token == address(0)) {
+            (bool success, ) = immutables.creator.call{value: address(this).balance}("");
             require(success, "ETH refund failed");
         }
     }
-    
-    /**
-     * Get escrow info
-     */
-    function getInfo() external view returns (
-        address _creator,
-        address _token,
-        uint256 _amount,
-        uint256 _deadline,
-        bytes32 _orderHash,
-        bool _resolved
-    ) {
-        return (creator, token, amount, deadline, orderHash, resolved);
-    }
-    
+
     receive() external payable {}
-}
\ No newline at end of file
+}
@@ -3,10 +3,11 @@ pragma solidity ^0.8.20;
 
 import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
-import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+import "@openzeppelin/contracts/utils/ReentrancyGuardTransient.sol";
 import "@openzeppelin/contracts/access/Ownable.sol";
 import "@openzeppelin/contracts/utils/cryptography/ECDSA.sol";
 import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
+import "./MultiFillSecretLib.sol";
 
 /**
  * @title PartialFillLimitOrderBridge
@@ -15,6 +16,7 @@ import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
  * 🧩 PARTIAL FILL FEATURES:
  * - Orders can be filled incrementally over time
  * - Multiple resolvers can compete for partial fills
+ * - Optional Merkle tree of secrets: one secret per part, so parts fill concurrently
  * - Optimal capital efficiency and price discovery
  * 
  * 🎯 INTENT-BASED LIMIT ORDERS:
@@ -27,7 +29,37 @@ import "@openzeppelin/contracts/utils/cryptography/EIP712.sol";
  * - HTLC-based security with hashlock/timelock
  * - Resolver pays all gas fees and earns profit from spread
  */
-contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
+contract PartialFillLimitOrderBridge is ReentrancyGuardTransient, Ownable, EIP712 {
+    error NotAuthorizedResolver();
+    error OrderDoesNotExist();
+    error OrderAlreadyFullyFilled();
+    error OrderCancelled();
+    error OrderExpired();
+    error NoRemainingAmount();
+    error PartialFillsDisabled();
+    error InvalidPartsAmount();
+    error InvalidMaker();
+    error InvalidMakerAmount();
+    error InvalidTakerAmount();
+    error InsufficientDeposit();
+    error OrderTooSmall();
+    error InvalidMinFillAmount();
+    error MinFillTooLarge();
+    error MinFillTooSmall();
+    error InvalidSignature();
+    error OrderRequiresProof();
+    error InvalidSecret();
+    error OrderHasNoSecretTree();
+    error FillMustReachNextPart();
+    error InvalidSecretProof();
+    error ZeroFillAmount();
+    error FillAmountExceedsRemaining();
+    error FillTooSmall();
+    error TooManyPartialFills();
+    error HTLCExpired();
+    error InsufficientOutput();
+    error OnlyMakerCanCancel();
+
     using SafeERC20 for IERC20;
     using ECDSA for bytes32;
 
@@ -57,26 +89,18 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         bool fullyFilled;          // Whether order is completely filled
         bool cancelled;            // Whether order has been cancelled
         uint256 createdAt;         // Creation timestamp
-        address[] resolvers;       // List of resolvers who filled parts (NEW!)
         uint256 fillCount;         // Number of partial fills (NEW!)
-    }
-
-    // 🧩 Partial Fill Execution Record
-    struct PartialFill {
-        bytes32 orderId;           // Order being filled
-        address resolver;          // Resolver executing the fill
-        uint256 fillAmount;        // Amount being filled in this execution
-        uint256 algorandAmount;    // Corresponding Algorand amount
-        bytes32 secret;            // HTLC secret for this fill
-        uint256 timestamp;         // Execution timestamp
-        uint256 resolverFee;       // Fee earned by resolver
+        uint256 totalResolverFees; // Running sum of fees over all fills
     }
 
     // 📊 Enhanced Storage
+    // Per-fill details (resolver, amounts, fee, secret) live only in the
+    // PartialOrderFilled / PartialFillSecretRevealed events; history is served
+    // off-chain (scripts/partialFillHistoryIndex.cjs), so fill gas stays flat.
     mapping(bytes32 => LimitOrder) public limitOrders;
-    mapping(bytes32 => PartialFill[]) public orderFills;  // All fills for an order
     mapping(address => bool) public authorizedResolvers;
     mapping(address => uint256) public resolverBalances;
+    mapping(bytes32 => uint256) public secretPartsAmount;   // 0 = single hashlock, else hashlock is a secrets root
     
     // 🧩 Partial Fill Configuration
     uint256 public constant MIN_PARTIAL_FILL_RATIO = 500;    // 5% minimum (500/10000)
@@ -121,6 +145,12 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         bool isFullyFilled
     );
 
+    event PartialFillSecretRevealed(
+        bytes32 indexed orderId,
+        uint256 indexed fillIndex,
+        bytes32 secret
+    );
+
     event OrderFullyFilled(
         bytes32 indexed orderId,
         address indexed finalResolver,
@@ -135,20 +165,26 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         uint256 refundAmount
     );
 
+    event MultipleFillsEnabled(
+        bytes32 indexed orderId,
+        bytes32 secretsRoot,
+        uint256 partsAmount
+    );
+
     event ResolverAuthorized(address indexed resolver, bool authorized);
 
     // 🔧 Enhanced Modifiers
     modifier onlyAuthorizedResolver() {
-        require(authorizedResolvers[msg.sender], "Not authorized resolver");
+        if (!authorizedResolvers[msg.sender]) revert NotAuthorizedResolver();
         _;
     }
 
     modifier validOrderForFill(bytes32 orderId) {
-        require(limitOrders[orderId].intent.maker != address(0), "Order does not exist");
-        require(!limitOrders[orderId].fullyFilled, "Order fully filled");
-        require(!limitOrders[orderId].cancelled, "Order cancelled");
-        require(block.timestamp <= limitOrders[orderId].intent.deadline, "Order expired");
-        require(limitOrders[orderId].remainingAmount > 0, "No remaining amount");
+        if (limitOrders[orderId].intent.maker == address(0)) revert OrderDoesNotExist();
+        if (limitOrders[orderId].fullyFilled) revert OrderAlreadyFullyFilled();
+        if (limitOrders[orderId].cancelled) revert OrderCancelled();
+        if (block.timestamp > limitOrders[orderId].intent.deadline) revert OrderExpired();
+        if (limitOrders[orderId].remainingAmount == 0) revert NoRemainingAmount();
         _;
     }
 
@@ -165,18 +201,48 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         bytes32 hashlock,
         uint256 timelock
     ) external payable nonReentrant returns (bytes32 orderId) {
-        require(intent.maker == msg.sender, "Invalid maker");
-        require(intent.makerAmount > 0, "Invalid maker amount");
-        require(intent.takerAmount > 0, "Invalid taker amount");
-        require(intent.deadline > block.timestamp, "Order expired");
-        require(msg.value >= intent.makerAmount, "Insufficient deposit");
-        require(msg.value >= MIN_ORDER_VALUE, "Order too small");
+        orderId = _submitLimitOrder(intent, signature, hashlock, timelock);
+    }
+
+    /**
+     * 🌳 Submit limit order whose parts are protected by a Merkle tree of secrets
+     * @param secretsRoot Root over partsAmount + 1 leaves (see MultiFillSecretLib)
+     * @param partsAmount Number of parts the order is split into
+     */
+    function submitLimitOrderWithSecretTree(
+        LimitOrderIntent calldata intent,
+        bytes calldata signature,
+        bytes32 secretsRoot,
+        uint256 partsAmount,
+        uint256 timelock
+    ) external payable nonReentrant returns (bytes32 orderId) {
+        if (!intent.partialFillsEnabled) revert PartialFillsDisabled();
+        if (partsAmount <= 1 || partsAmount > MAX_PARTIAL_FILLS_PER_ORDER) revert InvalidPartsAmount();
+
+        orderId = _submitLimitOrder(intent, signature, secretsRoot, timelock);
+        secretPartsAmount[orderId] = partsAmount;
+
+        emit MultipleFillsEnabled(orderId, secretsRoot, partsAmount);
+    }
+
+    function _submitLimitOrder(
+        LimitOrderIntent calldata intent,
+        bytes calldata signature,
+        bytes32 hashlock,
+        uint256 timelock
+    ) internal returns (bytes32 orderId) {
+        if (intent.maker != msg.sender) revert InvalidMaker();
+        if (intent.makerAmount == 0) revert InvalidMakerAmount();
+        if (intent.takerAmount == 0) revert InvalidTakerAmount();
+        if (intent.deadline <= block.timestamp) revert OrderExpired();
+        if (msg.value < intent.makerAmount) revert InsufficientDeposit();
+        if (msg.value < MIN_ORDER_VALUE) revert OrderTooSmall();
         
         // Partial fill validation
         if (intent.partialFillsEnabled) {
-            require(intent.minFillAmount > 0, "Invalid min fill amount");
-            require(intent.minFillAmount <= intent.makerAmount, "Min fill too large");
-            require(intent.minFillAmount >= (intent.makerAmount * MIN_PARTIAL_FILL_RATIO) / 10000, "Min fill too small");
+            if (intent.minFillAmount == 0) revert InvalidMinFillAmount();
+            if (intent.minFillAmount > intent.makerAmount) revert MinFillTooLarge();
+            if (intent.minFillAmount < (intent.makerAmount * MIN_PARTIAL_FILL_RATIO) / 10000) revert MinFillTooSmall();
         }
 
         // Generate unique order ID
@@ -188,7 +254,7 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         ));
 
         // Verify EIP-712 signature
-        require(_verifySignature(intent, signature, intent.maker), "Invalid signature");
+        if (!_verifySignature(intent, signature, intent.maker)) revert InvalidSignature();
 
         // Set default timelock if not provided
         if (timelock == 0) {
@@ -206,8 +272,8 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
             fullyFilled: false,                 // NEW: Full fill status
             cancelled: false,
             createdAt: block.timestamp,
-            resolvers: new address[](0),        // NEW: Resolver history
-            fillCount: 0                        // NEW: Fill counter
+            fillCount: 0,                       // NEW: Fill counter
+            totalResolverFees: 0
         });
 
         emit LimitOrderCreated(
@@ -236,28 +302,71 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         uint256 algorandAmount
     ) external onlyAuthorizedResolver validOrderForFill(orderId) nonReentrant {
         LimitOrder storage order = limitOrders[orderId];
+        if (secretPartsAmount[orderId] != 0) revert OrderRequiresProof();
         
-        // Validate fill amount
-        require(fillAmount > 0, "Fill amount must be > 0");
-        require(fillAmount <= order.remainingAmount, "Fill amount exceeds remaining");
+        _validateFillAmount(order, fillAmount);
+
+        // Verify secret matches hashlock
+        if (keccak256(abi.encodePacked(secret)) != order.hashlock) revert InvalidSecret();
+        
+        _executeFill(orderId, order, fillAmount, secret, algorandAmount);
+    }
+
+    /**
+     * 🌳 Fill one part of a secret-tree order, revealing only that part's secret
+     * @param proof Merkle proof for leaf (secretIndex, keccak256(secret))
+     */
+    function fillLimitOrderWithProof(
+        bytes32 orderId,
+        uint256 fillAmount,
+        bytes32 secret,
+        uint256 algorandAmount,
+        bytes32[] calldata proof
+    ) external onlyAuthorizedResolver validOrderForFill(orderId) nonReentrant {
+        LimitOrder storage order = limitOrders[orderId];
+        uint256 partsAmount = secretPartsAmount[orderId];
+        if (partsAmount == 0) revert OrderHasNoSecretTree();
+        
+        _validateFillAmount(order, fillAmount);
+
+        (bool validIndex, uint256 idx) = MultiFillSecretLib.secretIndex(
+            order.depositedAmount,
+            order.filledAmount,
+            fillAmount,
+            partsAmount
+        );
+        if (!validIndex) revert FillMustReachNextPart();
+        if (!MultiFillSecretLib.verify(order.hashlock, idx, secret, proof)) revert InvalidSecretProof();
+        
+        _executeFill(orderId, order, fillAmount, secret, algorandAmount);
+    }
+
+    function _validateFillAmount(LimitOrder storage order, uint256 fillAmount) internal view {
+        if (fillAmount == 0) revert ZeroFillAmount();
+        if (fillAmount > order.remainingAmount) revert FillAmountExceedsRemaining();
         
         // Partial fill validation
         if (order.intent.partialFillsEnabled) {
-            require(fillAmount >= order.intent.minFillAmount || fillAmount == order.remainingAmount, "Fill too small");
-            require(order.fillCount < MAX_PARTIAL_FILLS_PER_ORDER, "Too many partial fills");
+            if (fillAmount < order.intent.minFillAmount && fillAmount != order.remainingAmount) revert FillTooSmall();
+            if (order.fillCount >= MAX_PARTIAL_FILLS_PER_ORDER) revert TooManyPartialFills();
         } else {
-            require(fillAmount == order.remainingAmount, "Partial fills disabled");
+            if (fillAmount != order.remainingAmount) revert PartialFillsDisabled();
         }
+    }
 
-        // Verify secret matches hashlock
-        require(keccak256(abi.encodePacked(secret)) == order.hashlock, "Invalid secret");
-        
+    function _executeFill(
+        bytes32 orderId,
+        LimitOrder storage order,
+        uint256 fillAmount,
+        bytes32 secret,
+        uint256 algorandAmount
+    ) internal {
         // Verify timelock hasn't expired
-        require(block.timestamp <= order.timelock, "HTLC expired");
+        if (block.timestamp > order.timelock) revert HTLCExpired();
         
         // Calculate proportional taker amount
         uint256 proportionalTakerAmount = (order.intent.takerAmount * fillAmount) / order.intent.makerAmount;
-        require(algorandAmount >= proportionalTakerAmount, "Insufficient output");
+        if (algorandAmount < proportionalTakerAmount) revert InsufficientOutput();
 
         // Calculate resolver fee with partial fill bonus
         uint256 baseFeeRate = resolverFeeRate;
@@ -272,26 +381,13 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         order.filledAmount += fillAmount;
         order.remainingAmount -= fillAmount;
         order.fillCount += 1;
+        order.totalResolverFees += resolverFee;
         
         // Check if order is now fully filled
         bool isFullyFilled = (order.remainingAmount == 0);
         if (isFullyFilled) {
             order.fullyFilled = true;
         }
-        
-        // Add resolver to history
-        order.resolvers.push(msg.sender);
-
-        // Record this partial fill
-        orderFills[orderId].push(PartialFill({
-            orderId: orderId,
-            resolver: msg.sender,
-            fillAmount: fillAmount,
-            algorandAmount: algorandAmount,
-            secret: secret,
-            timestamp: block.timestamp,
-            resolverFee: resolverFee
-        }));
 
         // Transfer ETH to resolver (minus fee)
         payable(msg.sender).transfer(resolverAmount);
@@ -309,30 +405,22 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
             order.fillCount - 1,
             isFullyFilled
         );
+        emit PartialFillSecretRevealed(orderId, order.fillCount - 1, secret);
 
         // Emit full completion event if applicable
         if (isFullyFilled) {
-            uint256 totalFees = 0;
-            PartialFill[] memory fills = orderFills[orderId];
-            for (uint i = 0; i < fills.length; i++) {
-                totalFees += fills[i].resolverFee;
-            }
-
             emit OrderFullyFilled(
                 orderId,
                 msg.sender,
                 order.filledAmount,
-                totalFees,
+                order.totalResolverFees,
                 order.fillCount
             );
         }
     }
 
-    /**
-     * 🔍 Get order fill history
-     */
-    function getOrderFills(bytes32 orderId) external view returns (PartialFill[] memory) {
-        return orderFills[orderId];
+    function getOrder(bytes32 orderId) external view returns (LimitOrder memory) {
+        return limitOrders[orderId];
     }
 
     /**
@@ -344,7 +432,7 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
         uint256 remainingAmount,
         uint256 fillCount,
         bool fullyFilled,
-        address[] memory resolvers
+        uint256 totalResolverFees
     ) {
         LimitOrder storage order = limitOrders[orderId];
         return (
@@ -353,7 +441,7 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
             order.remainingAmount,
             order.fillCount,
             order.fullyFilled,
-            order.resolvers
+            order.totalResolverFees
         );
     }
 
@@ -362,7 +450,7 @@ contract PartialFillLimitOrderBridge is ReentrancyGuard, Ownable, EIP712 {
      */
     function cancelLimitOrder(bytes32 orderId) external validOrderForFill(orderId) nonReentrant {
         LimitOrder storage order = limitOrders[orderId];
-        require(order.intent.maker == msg.sender, "Only maker can cancel");
+        if (order.intent.maker != msg.sender) revert OnlyMakerCanCancel();
 
         order.cancelled = true;
 
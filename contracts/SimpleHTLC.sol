@@ -1,11 +1,14 @@
 // SPDX-License-Identifier: MIT
 pragma solidity ^0.8.20;
 
+import "./BridgeTimelocksLib.sol";
+
 /**
  * @title SimpleHTLC
  * @dev Simple HTLC contract for cross-chain atomic swaps
  */
 contract SimpleHTLC {
+    using BridgeTimelocksLib for Timelocks;
     
     struct Escrow {
         address initiator;
@@ -13,7 +16,7 @@ contract SimpleHTLC {
         address resolver;
         uint256 amount;
         bytes32 hashlock;
-        uint256 timelock;
+        Timelocks timelocks;        // packed; withdraw until cancellationStart, refund from it
         bool withdrawn;
         bool refunded;
     }
@@ -46,6 +49,13 @@ contract SimpleHTLC {
         bytes32 indexed secret
     );
     
+    // Per-item outcome of the batch* functions (reason is empty on success)
+    event HTLCBatchResult(
+        bytes32 indexed escrowId,
+        bool success,
+        string reason
+    );
+    
     modifier onlyOwner() {
         require(msg.sender == owner, "Only owner");
         _;
@@ -71,35 +81,197 @@ contract SimpleHTLC {
         uint256 _timelock,
         uint256 _resolverFeeRate
     ) external payable returns (bytes32 escrowId) {
+        escrowId = _escrowId(_recipient, _hashlock, _timelock);
+        string memory err = _createError(escrowId, _recipient, _resolver, _hashlock, _timelock, _resolverFeeRate, msg.value);
+        require(bytes(err).length == 0, err);
+        
+        _createEscrow(escrowId, _recipient, _resolver, _hashlock, _timelock, _resolverFeeRate, msg.value);
+        
+        return escrowId;
+    }
+    
+    /**
+     * @dev Create several escrows with one resolver and fee rate.
+     * msg.value must equal the sum of _amounts; invalid items are skipped and
+     * their value is returned to the sender at the end of the batch.
+     */
+    function batchCreateHTLCEscrow(
+        address[] calldata _recipients,
+        address _resolver,
+        bytes32[] calldata _hashlocks,
+        uint256[] calldata _timelocks,
+        uint256[] calldata _amounts,
+        uint256 _resolverFeeRate
+    ) external payable returns (bytes32[] memory escrowIds) {
+        uint256 count = _recipients.length;
+        require(
+            _hashlocks.length == count && _timelocks.length == count && _amounts.length == count,
+            "Length mismatch"
+        );
+        
+        uint256 total;
+        for (uint256 i = 0; i < count; ++i) {
+            total += _amounts[i];
+        }
+        require(total == msg.value, "ETH amount mismatch");
         
-        require(_recipient != address(0), "Invalid recipient");
-        require(_resolver != address(0), "Invalid resolver");
-        require(authorizedResolvers[_resolver], "Resolver not authorized");
-        require(msg.value > 0, "Amount must be > 0");
-        require(_timelock > block.timestamp + 30 minutes, "Timelock too short");
-        require(_hashlock != bytes32(0), "Invalid hashlock");
-        require(_resolverFeeRate <= 500, "Resolver fee too high");
+        escrowIds = new bytes32[](count);
+        uint256 unused;
+        for (uint256 i = 0; i < count; ++i) {
+            bytes32 escrowId = _escrowId(_recipients[i], _hashlocks[i], _timelocks[i]);
+            string memory err = _createError(
+                escrowId, _recipients[i], _resolver, _hashlocks[i], _timelocks[i], _resolverFeeRate, _amounts[i]
+            );
+            
+            if (bytes(err).length == 0) {
+                _createEscrow(escrowId, _recipients[i], _resolver, _hashlocks[i], _timelocks[i], _resolverFeeRate, _amounts[i]);
+                escrowIds[i] = escrowId;
+            } else {
+                unused += _amounts[i];
+            }
+            
+            emit HTLCBatchResult(escrowId, bytes(err).length == 0, err);
+        }
         
-        escrowId = keccak256(abi.encodePacked(
+        if (unused > 0) {
+            payable(msg.sender).transfer(unused);
+        }
+    }
+    
+    function withdrawWithSecret(bytes32 _escrowId, bytes32 _secret) external returns (bool) {
+        Escrow storage escrow = escrows[_escrowId];
+        string memory err = _withdrawError(escrow, _secret);
+        require(bytes(err).length == 0, err);
+        
+        _withdraw(_escrowId, escrow, _secret);
+        
+        return true;
+    }
+    
+    /**
+     * @dev Withdraw several escrows; items that fail validation are skipped
+     * @return results results[i] is true if _escrowIds[i] was withdrawn
+     */
+    function batchWithdrawWithSecret(
+        bytes32[] calldata _escrowIds,
+        bytes32[] calldata _secrets
+    ) external returns (bool[] memory results) {
+        require(_escrowIds.length == _secrets.length, "Length mismatch");
+        
+        results = new bool[](_escrowIds.length);
+        for (uint256 i = 0; i < _escrowIds.length; ++i) {
+            Escrow storage escrow = escrows[_escrowIds[i]];
+            string memory err = _withdrawError(escrow, _secrets[i]);
+            
+            if (bytes(err).length == 0) {
+                _withdraw(_escrowIds[i], escrow, _secrets[i]);
+                results[i] = true;
+            }
+            
+            emit HTLCBatchResult(_escrowIds[i], results[i], err);
+        }
+    }
+    
+    function refundAfterTimeout(bytes32 _escrowId) external returns (bool) {
+        Escrow storage escrow = escrows[_escrowId];
+        string memory err = _refundError(escrow);
+        require(bytes(err).length == 0, err);
+        
+        _refund(escrow);
+        
+        return true;
+    }
+    
+    /**
+     * @dev Refund several expired escrows; items that fail validation are skipped
+     * @return results results[i] is true if _escrowIds[i] was refunded
+     */
+    function batchRefundAfterTimeout(bytes32[] calldata _escrowIds) external returns (bool[] memory results) {
+        results = new bool[](_escrowIds.length);
+        for (uint256 i = 0; i < _escrowIds.length; ++i) {
+            Escrow storage escrow = escrows[_escrowIds[i]];
+            string memory err = _refundError(escrow);
+            
+            if (bytes(err).length == 0) {
+                _refund(escrow);
+                results[i] = true;
+            }
+            
+            emit HTLCBatchResult(_escrowIds[i], results[i], err);
+        }
+    }
+    
+    function _escrowId(address _recipient, bytes32 _hashlock, uint256 _timelock) internal view returns (bytes32) {
+        return keccak256(abi.encodePacked(
             msg.sender,
             _recipient,
             _hashlock,
             _timelock,
             block.timestamp
         ));
+    }
+    
+    // Validation is split from the state change so the batch functions can skip
+    // a failing item instead of reverting; an empty string means the item is valid.
+    function _createError(
+        bytes32 _id,
+        address _recipient,
+        address _resolver,
+        bytes32 _hashlock,
+        uint256 _timelock,
+        uint256 _resolverFeeRate,
+        uint256 _amount
+    ) internal view returns (string memory) {
+        if (_recipient == address(0)) return "Invalid recipient";
+        if (_resolver == address(0)) return "Invalid resolver";
+        if (!authorizedResolvers[_resolver]) return "Resolver not authorized";
+        if (_amount == 0) return "Amount must be > 0";
+        if (_timelock <= block.timestamp + 30 minutes) return "Timelock too short";
+        if (_timelock - block.timestamp > type(uint32).max) return "Timelock too long";
+        if (_hashlock == bytes32(0)) return "Invalid hashlock";
+        if (_resolverFeeRate > 500) return "Resolver fee too high";
+        if (escrows[_id].initiator != address(0)) return "Escrow already exists";
+        return "";
+    }
+    
+    function _withdrawError(Escrow storage escrow, bytes32 _secret) internal view returns (string memory) {
+        if (escrow.initiator == address(0)) return "Escrow not found";
+        if (escrow.withdrawn) return "Already withdrawn";
+        if (escrow.refunded) return "Already refunded";
+        if (block.timestamp >= escrow.timelocks.cancellationStart()) return "Escrow expired";
+        if (keccak256(abi.encodePacked(_secret)) != escrow.hashlock) return "Invalid secret";
+        if (msg.sender != escrow.recipient && msg.sender != escrow.resolver) return "Unauthorized withdrawal";
+        return "";
+    }
+    
+    function _refundError(Escrow storage escrow) internal view returns (string memory) {
+        if (escrow.initiator == address(0)) return "Escrow not found";
+        if (escrow.withdrawn) return "Already withdrawn";
+        if (escrow.refunded) return "Already refunded";
+        if (block.timestamp < escrow.timelocks.cancellationStart()) return "Timelock not expired";
+        if (msg.sender != escrow.initiator) return "Only initiator can refund";
+        return "";
+    }
+    
+    function _createEscrow(
+        bytes32 _id,
+        address _recipient,
+        address _resolver,
+        bytes32 _hashlock,
+        uint256 _timelock,
+        uint256 _resolverFeeRate,
+        uint256 _amount
+    ) internal {
+        uint256 resolverFee = (_amount * _resolverFeeRate) / 10000;
+        uint256 netAmount = _amount - resolverFee;
         
-        require(escrows[escrowId].initiator == address(0), "Escrow already exists");
-        
-        uint256 resolverFee = (msg.value * _resolverFeeRate) / 10000;
-        uint256 netAmount = msg.value - resolverFee;
-        
-        escrows[escrowId] = Escrow({
+        escrows[_id] = Escrow({
             initiator: msg.sender,
             recipient: _recipient,
             resolver: _resolver,
             amount: netAmount,
             hashlock: _hashlock,
-            timelock: _timelock,
+            timelocks: BridgeTimelocksLib.untilExpiry(block.timestamp, _timelock),
             withdrawn: false,
             refunded: false
         });
@@ -110,63 +282,38 @@ contract SimpleHTLC {
         }
         
         emit HTLCEscrowCreated(
-            escrowId,
+            _id,
             msg.sender,
             _recipient,
             netAmount,
             _hashlock,
             _timelock
         );
-        
-        return escrowId;
     }
     
-    function withdrawWithSecret(bytes32 _escrowId, bytes32 _secret) external returns (bool) {
-        Escrow storage escrow = escrows[_escrowId];
-        
-        require(escrow.initiator != address(0), "Escrow not found");
-        require(!escrow.withdrawn, "Already withdrawn");
-        require(!escrow.refunded, "Already refunded");
-        require(block.timestamp < escrow.timelock, "Escrow expired");
-        
-        bytes32 computedHash = keccak256(abi.encodePacked(_secret));
-        require(computedHash == escrow.hashlock, "Invalid secret");
-        
-        require(
-            msg.sender == escrow.recipient || msg.sender == escrow.resolver,
-            "Unauthorized withdrawal"
-        );
-        
+    function _withdraw(bytes32 _id, Escrow storage escrow, bytes32 _secret) internal {
         escrow.withdrawn = true;
         
         payable(escrow.recipient).transfer(escrow.amount);
         
-        emit HTLCSecretRevealed(_escrowId, _secret);
-        emit HTLCWithdrawn(_escrowId, escrow.recipient, escrow.amount);
-        
-        return true;
+        emit HTLCSecretRevealed(_id, _secret);
+        emit HTLCWithdrawn(_id, escrow.recipient, escrow.amount);
     }
     
-    function refundAfterTimeout(bytes32 _escrowId) external returns (bool) {
-        Escrow storage escrow = escrows[_escrowId];
-        
-        require(escrow.initiator != address(0), "Escrow not found");
-        require(!escrow.withdrawn, "Already withdrawn");
-        require(!escrow.refunded, "Already refunded");
-        require(block.timestamp >= escrow.timelock, "Timelock not expired");
-        require(msg.sender == escrow.initiator, "Only initiator can refund");
-        
+    function _refund(Escrow storage escrow) internal {
         escrow.refunded = true;
         
         payable(escrow.initiator).transfer(escrow.amount);
-        
-        return true;
     }
     
     function getEscrow(bytes32 _escrowId) external view returns (Escrow memory) {
         return escrows[_escrowId];
     }
     
+    function getExpiry(bytes32 _escrowId) external view returns (uint256) {
+        return escrows[_escrowId].timelocks.cancellationStart();
+    }
+    
     function getOfficial1inchContracts() external pure returns (address settlement, address routerV5) {
         return (ONEINCH_SETTLEMENT, ONEINCH_ROUTER_V5);
     }
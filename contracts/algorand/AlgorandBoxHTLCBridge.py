@@ -0,0 +1,204 @@
+"""
+AlgorandBoxHTLCBridge.py
+Algorand HTLC bridge with one box per HTLC - unlimited concurrent HTLCs per app
+
+📦 BOX STORAGE:
+- Box key: 32-byte htlcId (the Ethereum-side HTLC/order id)
+- Box value (112 bytes): initiator | recipient | hashlock | amount | timelock
+- create, claim and refund each touch exactly one box
+- No opt-in, no global HTLC slots, no per-account limit
+- ARC-28 HTLCCreated / HTLCClaimed / HTLCRefunded logs (see HTLCEvents.py)
+
+💰 MINIMUM BALANCE:
+- Each box locks 2500 + 400 * (32 + 112) = 60100 microAlgos in the app account
+- The initiator funds it with the HTLC payment and gets it back on claim/refund
+"""
+
+from pyteal import *
+
+from HTLCEvents import log_htlc_created, log_htlc_claimed, log_htlc_refunded
+
+# Box value layout (big-endian uint64s)
+INITIATOR_OFFSET = 0
+RECIPIENT_OFFSET = 32
+HASHLOCK_OFFSET = 64
+AMOUNT_OFFSET = 96
+TIMELOCK_OFFSET = 104
+BOX_SIZE = 112
+
+HTLC_ID_LENGTH = 32
+BOX_MBR = 2500 + 400 * (HTLC_ID_LENGTH + BOX_SIZE)
+
+
+class AlgorandBoxHTLCBridge:
+    """
+    Algorand Box HTLC Bridge Contract
+
+    Calls (NoOp):
+    - create_htlc(htlcId, hashlock, timelock, recipient), grouped after a payment
+      from the sender to the app account of amount + BOX_MBR
+    - claim_htlc(htlcId, secret): anyone, before timelock; pays the recipient
+    - refund_htlc(htlcId): anyone, from timelock on; pays the initiator
+
+    Claim and refund delete the box. Inner transactions carry no fee, so the
+    caller pays them through fee pooling (claim: 3x, refund: 2x the min fee).
+    """
+
+    def get_approval_program(self):
+        """Approval program for the contract"""
+
+        htlc_id = Txn.application_args[1]
+
+        def handle_creation():
+            """Handle contract creation"""
+            return Return(Int(1))
+
+        def handle_create_htlc():
+            """Lock the grouped payment (minus the box deposit) under a new box"""
+            payment = Gtxn[Txn.group_index() - Int(1)]
+            amount_var = ScratchVar(TealType.uint64)
+
+            return Seq([
+                Assert(Txn.application_args.length() == Int(5)),
+                Assert(Len(htlc_id) == Int(HTLC_ID_LENGTH)),
+                Assert(Len(Txn.application_args[2]) == Int(32)),
+                Assert(Len(Txn.application_args[4]) == Int(32)),
+                Assert(Btoi(Txn.application_args[3]) > Global.latest_timestamp()),
+
+                # Funding payment right before this call
+                Assert(Txn.group_index() > Int(0)),
+                Assert(payment.type_enum() == TxnType.Payment),
+                Assert(payment.sender() == Txn.sender()),
+                Assert(payment.receiver() == Global.current_application_address()),
+                Assert(payment.close_remainder_to() == Global.zero_address()),
+                Assert(payment.amount() > Int(BOX_MBR)),
+                amount_var.store(payment.amount() - Int(BOX_MBR)),
+
+                # box_create returns 0 when the htlcId is already live
+                Assert(App.box_create(htlc_id, Int(BOX_SIZE))),
+                App.box_replace(htlc_id, Int(0), Concat(
+                    Txn.sender(),
+                    Txn.application_args[4],
+                    Txn.application_args[2],
+                    Itob(amount_var.load()),
+                    Itob(Btoi(Txn.application_args[3]))
+                )),
+                log_htlc_created(htlc_id, Txn.sender(), Txn.application_args[4], Txn.application_args[2],
+                                 amount_var.load(), Btoi(Txn.application_args[3])),
+
+                Return(Int(1))
+            ])
+
+        def handle_claim_htlc():
+            """Release the amount to the recipient with the preimage"""
+            htlc = App.box_get(htlc_id)
+
+            return Seq([
+                Assert(Txn.application_args.length() == Int(3)),
+                htlc,
+                Assert(htlc.hasValue()),
+                Assert(Global.latest_timestamp() < ExtractUint64(htlc.value(), Int(TIMELOCK_OFFSET))),
+                Assert(Sha256(Txn.application_args[2]) == Extract(htlc.value(), Int(HASHLOCK_OFFSET), Int(32))),
+
+                Pop(App.box_delete(htlc_id)),
+                log_htlc_claimed(htlc_id, Extract(htlc.value(), Int(RECIPIENT_OFFSET), Int(32)),
+                                 Txn.application_args[2], ExtractUint64(htlc.value(), Int(AMOUNT_OFFSET))),
+
+                InnerTxnBuilder.Begin(),
+                InnerTxnBuilder.SetFields({
+                    TxnField.type_enum: TxnType.Payment,
+                    TxnField.amount: ExtractUint64(htlc.value(), Int(AMOUNT_OFFSET)),
+                    TxnField.receiver: Extract(htlc.value(), Int(RECIPIENT_OFFSET), Int(32)),
+                    TxnField.fee: Int(0)
+                }),
+                # Box deposit goes back to whoever funded it
+                InnerTxnBuilder.Next(),
+                InnerTxnBuilder.SetFields({
+                    TxnField.type_enum: TxnType.Payment,
+                    TxnField.amount: Int(BOX_MBR),
+                    TxnField.receiver: Extract(htlc.value(), Int(INITIATOR_OFFSET), Int(32)),
+                    TxnField.fee: Int(0)
+                }),
+                InnerTxnBuilder.Submit(),
+
+                Return(Int(1))
+            ])
+
+        def handle_refund_htlc():
+            """Return amount and box deposit to the initiator after the timelock"""
+            htlc = App.box_get(htlc_id)
+
+            return Seq([
+                Assert(Txn.application_args.length() == Int(2)),
+                htlc,
+                Assert(htlc.hasValue()),
+                Assert(Global.latest_timestamp() >= ExtractUint64(htlc.value(), Int(TIMELOCK_OFFSET))),
+
+                Pop(App.box_delete(htlc_id)),
+                log_htlc_refunded(htlc_id, Extract(htlc.value(), Int(INITIATOR_OFFSET), Int(32)),
+                                  ExtractUint64(htlc.value(), Int(AMOUNT_OFFSET))),
+
+                InnerTxnBuilder.Begin(),
+                InnerTxnBuilder.SetFields({
+                    TxnField.type_enum: TxnType.Payment,
+                    TxnField.amount: ExtractUint64(htlc.value(), Int(AMOUNT_OFFSET)) + Int(BOX_MBR),
+                    TxnField.receiver: Extract(htlc.value(), Int(INITIATOR_OFFSET), Int(32)),
+                    TxnField.fee: Int(0)
+                }),
+                InnerTxnBuilder.Submit(),
+
+                Return(Int(1))
+            ])
+
+        # Main program logic
+        program = Cond(
+            [Txn.application_id() == Int(0), handle_creation()],
+            [Txn.on_completion() != OnComplete.NoOp, Return(Int(0))],
+            [Txn.application_args[0] == Bytes("create_htlc"), handle_create_htlc()],
+            [Txn.application_args[0] == Bytes("claim_htlc"), handle_claim_htlc()],
+            [Txn.application_args[0] == Bytes("refund_htlc"), handle_refund_htlc()]
+        )
+
+        return program
+
+    def get_clear_state_program(self):
+        """Clear state program"""
+        return Return(Int(1))
+
+
+# Standalone function to compile the contract
+def compile_box_htlc_bridge():
+    """Compile the box HTLC bridge contract (boxes need TEAL v8+)"""
+    bridge = AlgorandBoxHTLCBridge()
+
+    approval_teal = compileTeal(bridge.get_approval_program(), mode=Mode.Application, version=10)
+    clear_teal = compileTeal(bridge.get_clear_state_program(), mode=Mode.Application, version=10)
+
+    return approval_teal, clear_teal
+
+
+# Export compiled contract
+if __name__ == "__main__":
+    print("🔧 COMPILING ALGORAND BOX HTLC BRIDGE")
+    print("=====================================")
+
+    try:
+        approval_teal, clear_teal = compile_box_htlc_bridge()
+
+        print("✅ COMPILATION SUCCESSFUL!")
+        print("========================")
+        print(f"Approval Program Length: {len(approval_teal)} bytes")
+        print(f"Clear Program Length: {len(clear_teal)} bytes")
+
+        print("\n📝 APPROVAL PROGRAM TEAL:")
+        print("=" * 50)
+        print(approval_teal)
+
+        print("\n📝 CLEAR PROGRAM TEAL:")
+        print("=" * 50)
+        print(clear_teal)
+
+    except Exception as e:
+        print(f"❌ COMPILATION FAILED: {e}")
+        import traceback
+        traceback.print_exc()
@@ -3,6 +3,8 @@
 
 from pyteal import *
 
+from HTLCEvents import log_htlc_created, log_htlc_claimed, log_htlc_refunded
+
 def htlc_bridge_contract():
     """
     Algorand HTLC Bridge Contract for cross-chain atomic swaps with Ethereum
@@ -13,6 +15,7 @@ def htlc_bridge_contract():
     - Timelock enforcement
     - Cross-chain parameter storage
     - Relayer authorization
+    - ARC-28 event logs keyed by sha256(htlc_id) (see HTLCEvents.py)
     """
     
     # Global state keys
@@ -86,6 +89,7 @@ def htlc_bridge_contract():
             App.localPut(Txn.sender(), eth_address_key, eth_address),
             App.localPut(Txn.sender(), withdrawn_key, Int(0)),
             App.localPut(Txn.sender(), refunded_key, Int(0)),
+            log_htlc_created(Sha256(htlc_id), initiator, recipient, hashlock, amount, timelock),
             
             # Transfer ALGO to contract
             InnerTxnBuilder.Begin(),
@@ -121,6 +125,8 @@ def htlc_bridge_contract():
             
             # Mark as withdrawn
             App.localPut(Txn.sender(), withdrawn_key, Int(1)),
+            log_htlc_claimed(Sha256(htlc_id), App.localGet(Txn.sender(), recipient_key), secret,
+                             App.localGet(Txn.sender(), amount_key)),
             
             # Transfer ALGO to recipient
             InnerTxnBuilder.Begin(),
@@ -152,6 +158,8 @@ def htlc_bridge_contract():
             
             # Mark as refunded
             App.localPut(Txn.sender(), refunded_key, Int(1)),
+            log_htlc_refunded(Sha256(htlc_id), App.localGet(Txn.sender(), initiator_key),
+                              App.localGet(Txn.sender(), amount_key)),
             
             # Transfer ALGO back to initiator
             InnerTxnBuilder.Begin(),
@@ -0,0 +1,93 @@
+"""
+AlgorandHTLCLogicSig.py
+Stateless HTLC: one logic-signature contract account per swap
+
+🔏 TEMPLATE PARAMETERS (baked into the program, so each swap has its own address):
+- TMPL_HASHLOCK   sha256 of the secret (32 bytes)
+- TMPL_RCV        recipient, paid on claim
+- TMPL_OWN        refund address, paid after the timeout
+- TMPL_TIMEOUT    timeout round (logic signatures cannot read the clock)
+- TMPL_FEE        highest fee the escrow will pay for its own close-out
+
+🔓 SPENDING RULES (single payment, amount 0, closes the whole balance):
+- Claim: close to TMPL_RCV, arg 0 hashes to TMPL_HASHLOCK, LastValid < TMPL_TIMEOUT
+- Refund: close to TMPL_OWN, FirstValid >= TMPL_TIMEOUT
+
+No app, no app state and no box: independent swaps never touch shared state,
+and claim/refund cost one payment fee. The escrow address is the program
+hash, so the watcher recognizes a funding payment by rebuilding the program
+from the parameters in its note (scripts/algorandLogicSigHTLC.cjs).
+"""
+
+from pyteal import *
+
+
+class AlgorandHTLCLogicSig:
+    """
+    Algorand HTLC Logic Signature template
+
+    TMPL_RCV and TMPL_OWN must differ: the close-to address picks the branch.
+    """
+
+    def get_program(self):
+        """Signature-mode program with TMPL_ placeholders"""
+
+        hashlock = Tmpl.Bytes("TMPL_HASHLOCK")
+        recipient = Tmpl.Addr("TMPL_RCV")
+        owner = Tmpl.Addr("TMPL_OWN")
+        timeout = Tmpl.Int("TMPL_TIMEOUT")
+        max_fee = Tmpl.Int("TMPL_FEE")
+
+        # Only a bounded-fee close-out payment, never a rekey
+        close_out = And(
+            Txn.type_enum() == TxnType.Payment,
+            Txn.fee() <= max_fee,
+            Txn.rekey_to() == Global.zero_address(),
+            Txn.amount() == Int(0),
+            Txn.receiver() == Txn.close_remainder_to()
+        )
+
+        claim = And(
+            Sha256(Arg(0)) == hashlock,
+            Txn.last_valid() < timeout
+        )
+
+        refund = And(
+            Txn.close_remainder_to() == owner,
+            Txn.first_valid() >= timeout
+        )
+
+        return Seq([
+            Assert(close_out),
+            If(Txn.close_remainder_to() == recipient)
+            .Then(Return(claim))
+            .Else(Return(refund))
+        ])
+
+
+# Standalone function to compile the template
+def compile_htlc_logicsig():
+    """Compile the logic-signature template (placeholders are filled per swap)"""
+    return compileTeal(AlgorandHTLCLogicSig().get_program(), mode=Mode.Signature, version=8)
+
+
+# Export compiled template
+if __name__ == "__main__":
+    print("🔧 COMPILING ALGORAND HTLC LOGIC SIGNATURE TEMPLATE")
+    print("===================================================")
+
+    try:
+        template_teal = compile_htlc_logicsig()
+
+        print("✅ COMPILATION SUCCESSFUL!")
+        print("========================")
+        print(f"Template Length: {len(template_teal)} bytes")
+
+        print("\n📝 LOGIC SIGNATURE TEMPLATE TEAL:")
+        print("=" * 50)
+        print(template_teal)
+
+    except Exception as e:
+        print(f"❌ COMPILATION FAILED: {e}")
+        import traceback
+        traceback.print_exc()
@@ -8,6 +8,8 @@ Enhanced Algorand HTLC bridge with partial fill support
 - Balance tracking per fill
 - Cross-chain state sync
 - Dutch auction price discovery
+- ARC-28 event logs keyed by the hashlock (see HTLCEvents.py)
+- Multi-resolver batch fills paid to the recipient (see PartialFillBatch.py)
 
 🌉 CROSS-CHAIN ENHANCEMENTS:
 - ETH ↔ Algorand atomic swaps
@@ -23,6 +25,8 @@ import time
 from typing import Optional, Dict, Any
 
 from pyteal import *
+from HTLCEvents import log_htlc_created, log_htlc_claimed, log_htlc_refunded, log_htlc_partially_filled
+from PartialFillBatch import BATCH_FILL, MAX_BATCH_FILLS, handle_batch_fill
 from algosdk import account, mnemonic
 from algosdk.v2client import algod
 from algosdk.future.transaction import *
@@ -86,6 +90,9 @@ class AlgorandPartialFillBridge:
                 App.globalPut(maker, maker_arg),
                 App.globalPut(partial_fills_enabled, partial_enabled),
                 
+                log_htlc_created(hashlock_arg, maker_arg, recipient_arg, hashlock_arg,
+                                 App.globalGet(remaining_amount), timelock_arg),
+                
                 Return(Int(1))
             ])
         
@@ -116,6 +123,9 @@ class AlgorandPartialFillBridge:
                     App.globalPut(executed, Int(1))
                 ),
                 
+                log_htlc_partially_filled(hashlock_stored, Txn.sender(), secret_arg,
+                                          fill_amount_arg, remaining_current - fill_amount_arg),
+                
                 Return(Int(1))
             ])
         
@@ -127,6 +137,7 @@ class AlgorandPartialFillBridge:
                 Assert(Txn.sender() == App.globalGet(maker)),
                 
                 App.globalPut(refunded, Int(1)),
+                log_htlc_refunded(App.globalGet(hashlock), App.globalGet(maker), App.globalGet(remaining_amount)),
                 
                 Return(Int(1))
             ])
@@ -144,6 +155,8 @@ class AlgorandPartialFillBridge:
                 Assert(hashlock_stored == secret_hash),
                 
                 App.globalPut(executed, Int(1)),
+                log_htlc_claimed(hashlock_stored, App.globalGet(recipient), secret_arg,
+                                 App.globalGet(remaining_amount)),
                 
                 Return(Int(1))
             ])
@@ -153,6 +166,9 @@ class AlgorandPartialFillBridge:
             [Txn.application_id() == Int(0), handle_creation()],
             [Txn.application_args[0] == Bytes("create_htlc"), handle_htlc_creation()],
             [Txn.application_args[0] == Bytes("partial_fill"), handle_partial_fill()],
+            [Txn.application_args[0] == Bytes(BATCH_FILL),
+             handle_batch_fill(hashlock, timelock, recipient, partial_fills_enabled,
+                               total_filled, remaining_amount, executed, refunded)],
             [Txn.application_args[0] == Bytes("withdraw"), handle_withdrawal()],
             [Txn.application_args[0] == Bytes("public_claim"), handle_public_claim()]
         )
@@ -258,6 +274,58 @@ class AlgorandPartialFillBridge:
         confirmed_txn = wait_for_confirmation(self.algod_client, tx_id, 5)
         print(f"✅ Partial fill executed successfully")
         return confirmed_txn
+
+    def execute_batch_fill(self, fills, recipient, submitter_private_key, resolver_private_keys=None):
+        """Settle several resolvers' fills in one app call, paid to the recipient
+
+        fills: list of (resolver_address, fill_amount, secret), at most
+        MAX_BATCH_FILLS entries. Every resolver other than the submitter signs a
+        zero-amount payment to itself in the same group (resolver_private_keys:
+        address -> key); each fill record points at its resolver's transaction.
+        """
+        if not 0 < len(fills) <= MAX_BATCH_FILLS:
+            raise ValueError(f"batch_fill takes 1 to {MAX_BATCH_FILLS} fills, got {len(fills)}")
+
+        submitter = account.address_from_private_key(submitter_private_key)
+        resolver_private_keys = resolver_private_keys or {}
+        companions = [resolver for resolver in dict.fromkeys(resolver for resolver, _, _ in fills) if resolver != submitter]
+        missing = [resolver for resolver in companions if resolver not in resolver_private_keys]
+        if missing:
+            raise ValueError(f"no signing key for resolvers {missing}")
+        signer_index = {resolver: i for i, resolver in enumerate(companions)}
+        signer_index[submitter] = len(companions)  # the app call itself
+
+        params = self.algod_client.suggested_params()
+        params.flat_fee = True
+        params.fee = 0
+        txns = [PaymentTxn(sender=resolver, sp=params, receiver=resolver, amt=0) for resolver in companions]
+
+        call_params = self.algod_client.suggested_params()
+        call_params.flat_fee = True
+        call_params.fee = (2 + len(companions)) * 1000  # app call + inner payment + companions
+
+        app_args = [BATCH_FILL] + [
+            signer_index[resolver].to_bytes(1, 'big') + fill_amount.to_bytes(8, 'big') + secret
+            for resolver, fill_amount, secret in fills
+        ]
+        txns.append(ApplicationCallTxn(
+            sender=submitter,
+            sp=call_params,
+            index=self.app_id,
+            on_complete=OnComplete.NoOp,
+            app_args=app_args,
+            accounts=[recipient]
+        ))
+
+        if len(txns) > 1:
+            assign_group_id(txns)
+        signed_txns = [txn.sign(resolver_private_keys[txn.sender]) for txn in txns[:-1]]
+        signed_txns.append(txns[-1].sign(submitter_private_key))
+        tx_id = self.algod_client.send_transactions(signed_txns)
+
+        confirmed_txn = wait_for_confirmation(self.algod_client, tx_id, 5)
+        print(f"✅ Batch fill of {len(fills)} fills executed successfully")
+        return confirmed_txn
     
     def get_contract_state(self):
         """Get contract state"""
@@ -8,6 +8,8 @@ Fixed Algorand HTLC bridge with partial fill support - PyTeal compilation errors
 - Balance tracking per fill
 - Cross-chain state sync
 - Dutch auction price discovery
+- ARC-28 event logs keyed by the hashlock (see HTLCEvents.py)
+- Multi-resolver batch fills paid to the recipient (see PartialFillBatch.py)
 
 🌉 CROSS-CHAIN ENHANCEMENTS:
 - ETH ↔ Algorand atomic swaps
@@ -18,6 +20,9 @@ Fixed Algorand HTLC bridge with partial fill support - PyTeal compilation errors
 
 from pyteal import *
 
+from HTLCEvents import log_htlc_created, log_htlc_claimed, log_htlc_refunded, log_htlc_partially_filled
+from PartialFillBatch import BATCH_FILL, handle_batch_fill
+
 class FixedAlgorandPartialFillBridge:
     """
     Fixed Algorand Partial Fill Bridge Contract
@@ -80,6 +85,9 @@ class FixedAlgorandPartialFillBridge:
                 App.globalPut(maker, maker_var.load()),
                 App.globalPut(partial_fills_enabled, partial_enabled_var.load()),
                 
+                log_htlc_created(hashlock_var.load(), maker_var.load(), recipient_var.load(), hashlock_var.load(),
+                                 App.globalGet(remaining_amount), timelock_var.load()),
+                
                 Return(Int(1))
             ])
         
@@ -124,6 +132,9 @@ class FixedAlgorandPartialFillBridge:
                     App.globalPut(executed, Int(1))
                 ),
                 
+                log_htlc_partially_filled(hashlock_stored.load(), Txn.sender(), secret_var.load(),
+                                          fill_amount_var.load(), remaining_current.load() - fill_amount_var.load()),
+                
                 Return(Int(1))
             ])
         
@@ -135,6 +146,7 @@ class FixedAlgorandPartialFillBridge:
                 Assert(Txn.sender() == App.globalGet(maker)),
                 
                 App.globalPut(refunded, Int(1)),
+                log_htlc_refunded(App.globalGet(hashlock), App.globalGet(maker), App.globalGet(remaining_amount)),
                 
                 Return(Int(1))
             ])
@@ -156,6 +168,8 @@ class FixedAlgorandPartialFillBridge:
                 Assert(hashlock_stored.load() == secret_hash.load()),
                 
                 App.globalPut(executed, Int(1)),
+                log_htlc_claimed(hashlock_stored.load(), App.globalGet(recipient), secret_var.load(),
+                                 App.globalGet(remaining_amount)),
                 
                 Return(Int(1))
             ])
@@ -181,6 +195,9 @@ class FixedAlgorandPartialFillBridge:
             [Txn.application_id() == Int(0), handle_creation()],
             [Txn.application_args[0] == Bytes("create_htlc"), handle_htlc_creation()],
             [Txn.application_args[0] == Bytes("partial_fill"), handle_partial_fill()],
+            [Txn.application_args[0] == Bytes(BATCH_FILL),
+             handle_batch_fill(hashlock, timelock, recipient, partial_fills_enabled,
+                               total_filled, remaining_amount, executed, refunded)],
             [Txn.application_args[0] == Bytes("withdraw"), handle_withdrawal()],
             [Txn.application_args[0] == Bytes("public_claim"), handle_public_claim()],
             [Txn.application_args[0] == Bytes("deposit"), handle_deposit()],
@@ -0,0 +1,50 @@
+"""
+HTLCEvents.py
+ARC-28 event logs shared by the Algorand HTLC apps
+
+📣 EVENTS (selector = first 4 bytes of SHA-512/256 of the signature):
+- HTLCCreated(byte[32],address,address,byte[32],uint64,uint64)
+    htlcKey, initiator, recipient, hashlock, amount, timelock      148 bytes
+- HTLCClaimed(byte[32],address,byte[32],uint64)
+    htlcKey, recipient, secret, amount                             108 bytes
+- HTLCRefunded(byte[32],address,uint64)
+    htlcKey, initiator, amount                                      76 bytes
+- HTLCPartiallyFilled(byte[32],address,byte[32],uint64,uint64)
+    htlcKey, resolver, secret, fillAmount, remaining               116 bytes
+
+All fields are static, so every event has a fixed layout. htlcKey is the
+32-byte htlcId for the box app, sha256(HtlcId) for the local-state apps
+(free-form ids) and the hashlock for the single-HTLC partial fill apps.
+
+The relayer-side decoder is scripts/htlcEvents.cjs.
+"""
+
+import hashlib
+
+from pyteal import *
+
+HTLC_CREATED = "HTLCCreated(byte[32],address,address,byte[32],uint64,uint64)"
+HTLC_CLAIMED = "HTLCClaimed(byte[32],address,byte[32],uint64)"
+HTLC_REFUNDED = "HTLCRefunded(byte[32],address,uint64)"
+HTLC_PARTIALLY_FILLED = "HTLCPartiallyFilled(byte[32],address,byte[32],uint64,uint64)"
+
+
+def event_selector(signature):
+    """ARC-28 selector as a PyTeal byte constant"""
+    return Bytes("base16", hashlib.new("sha512_256", signature.encode()).hexdigest()[:8])
+
+
+def log_htlc_created(htlc_key, initiator, recipient, hashlock, amount, timelock):
+    return Log(Concat(event_selector(HTLC_CREATED), htlc_key, initiator, recipient, hashlock, Itob(amount), Itob(timelock)))
+
+
+def log_htlc_claimed(htlc_key, recipient, secret, amount):
+    return Log(Concat(event_selector(HTLC_CLAIMED), htlc_key, recipient, secret, Itob(amount)))
+
+
+def log_htlc_refunded(htlc_key, initiator, amount):
+    return Log(Concat(event_selector(HTLC_REFUNDED), htlc_key, initiator, Itob(amount)))
+
+
+def log_htlc_partially_filled(htlc_key, resolver, secret, fill_amount, remaining):
+    return Log(Concat(event_selector(HTLC_PARTIALLY_FILLED), htlc_key, resolver, secret, Itob(fill_amount), Itob(remaining)))
@@ -0,0 +1,97 @@
+"""
+PartialFillBatch.py
+Multi-resolver batch settlement shared by the Algorand partial fill apps
+
+📦 batch_fill(record, record, ...):
+- One app argument per fill: signer group index uint8 (1) | fill amount uint64 (8) | secret (32)
+- The resolver of a fill is the Sender of the group transaction at the signer
+  index, so every fill is attributed to an account that signed the group
+- Every record carries its own secret proof against the stored hashlock
+  (sha256 runs once per distinct secret, repeats are a 32-byte compare)
+- Only while partial fills are enabled and before the stored timelock
+- The batch total leaves as one inner payment to the stored recipient,
+  fee pooled from the outer call
+- total_filled / remaining_amount / executed are written once per call
+- One HTLCPartiallyFilled log per fill (see HTLCEvents.py)
+
+Per-call limits (AVM v6):
+- 8 fills: 8 × 116-byte logs fit the 1024-byte log limit
+- The recipient must be in the call's foreign accounts
+Bigger batches are split over several calls in one atomic group by
+scripts/algorandBatchFill.cjs.
+"""
+
+from pyteal import *
+
+from HTLCEvents import log_htlc_partially_filled
+
+BATCH_FILL = "batch_fill"
+FILL_RECORD_LENGTH = 41
+MAX_BATCH_FILLS = 8
+
+
+def handle_batch_fill(hashlock, timelock, recipient, partial_fills_enabled,
+                      total_filled, remaining_amount, executed, refunded):
+    """Settle several resolvers' fills in one app call"""
+    index = ScratchVar(TealType.uint64)
+    record = ScratchVar(TealType.bytes)
+    fill_amount = ScratchVar(TealType.uint64)
+    batch_total = ScratchVar(TealType.uint64)
+    remaining_current = ScratchVar(TealType.uint64)
+    hashlock_stored = ScratchVar(TealType.bytes)
+    verified_secret = ScratchVar(TealType.bytes)
+
+    resolver = Gtxn[Btoi(Extract(record.load(), Int(0), Int(1)))].sender()
+    secret = Extract(record.load(), Int(9), Int(32))
+
+    return Seq([
+        Assert(Txn.application_args.length() > Int(1)),
+        Assert(Txn.application_args.length() <= Int(MAX_BATCH_FILLS + 1)),
+        Assert(App.globalGet(partial_fills_enabled) == Int(1)),
+        Assert(App.globalGet(executed) == Int(0)),
+        Assert(App.globalGet(refunded) == Int(0)),
+        Assert(Global.latest_timestamp() < App.globalGet(timelock)),
+
+        hashlock_stored.store(App.globalGet(hashlock)),
+        remaining_current.store(App.globalGet(remaining_amount)),
+        batch_total.store(Int(0)),
+        verified_secret.store(Bytes("")),
+
+        For(index.store(Int(1)), index.load() < Txn.application_args.length(), index.store(index.load() + Int(1))).Do(Seq([
+            record.store(Txn.application_args[index.load()]),
+            Assert(Len(record.load()) == Int(FILL_RECORD_LENGTH)),
+
+            # Per-fill secret proof
+            If(secret != verified_secret.load(), Seq([
+                Assert(Sha256(secret) == hashlock_stored.load()),
+                verified_secret.store(secret)
+            ])),
+
+            fill_amount.store(ExtractUint64(record.load(), Int(1))),
+            Assert(fill_amount.load() > Int(0)),
+            batch_total.store(batch_total.load() + fill_amount.load()),
+            Assert(batch_total.load() <= remaining_current.load()),
+
+            log_htlc_partially_filled(hashlock_stored.load(), resolver, secret,
+                                      fill_amount.load(), remaining_current.load() - batch_total.load())
+        ])),
+
+        # Funds only ever go to the recipient fixed at create_htlc
+        InnerTxnBuilder.Begin(),
+        InnerTxnBuilder.SetFields({
+            TxnField.type_enum: TxnType.Payment,
+            TxnField.receiver: App.globalGet(recipient),
+            TxnField.amount: batch_total.load(),
+            TxnField.fee: Int(0)
+        }),
+        InnerTxnBuilder.Submit(),
+
+        # Aggregates once per call
+        App.globalPut(total_filled, App.globalGet(total_filled) + batch_total.load()),
+        App.globalPut(remaining_amount, remaining_current.load() - batch_total.load()),
+        If(remaining_current.load() == batch_total.load(),
+            App.globalPut(executed, Int(1))
+        ),
+
+        Return(Int(1))
+    ])
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.0;
+
+/**
+ * Pre-clone Official1inchEscrowFactory (one full contract per escrow, plain CREATE)
+ * Kept only as the gas baseline for scripts/compareEscrowFactoryGas.cjs
+ *
+ * Official 1inch-compatible EscrowFactory
+ * Based on 1inch cross-chain-swap BaseEscrowFactory patterns
+ * Implements deterministic escrow deployment for atomic swaps
+ */
+contract LegacyOfficial1inchEscrowFactory {
+    // Storage for deployed escrows
+    mapping(bytes32 => address) public escrows;
+    
+    // Events matching 1inch patterns
+    event EscrowCreated(bytes32 indexed orderHash, address indexed escrow, address indexed token, uint256 amount);
+    event EscrowResolved(address indexed escrow, bytes32 secret);
+    
+    /**
+     * Create a new escrow for cross-chain atomic swap
+     * Compatible with 1inch EscrowFactory interface
+     */
+    function createEscrow(
+        address token,
+        uint256 amount, 
+        bytes32 orderHash,
+        uint256 deadline,
+        bytes calldata /* resolverCalldata */
+    ) external payable returns (address escrow) {
+        require(escrows[orderHash] == address(0), "Escrow already exists");
+        require(token == address(0), "Only ETH supported for demo");
+        require(msg.value == amount, "Incorrect ETH amount");
+        
+        // Deploy escrow using regular CREATE (not CREATE2 to avoid complexity)
+        // This matches the 1inch pattern of deploying proxy contracts
+        escrow = address(new LegacyOfficial1inchEscrow{value: msg.value}(
+            msg.sender, 
+            token, 
+            amount, 
+            deadline, 
+            orderHash
+        ));
+        
+        // Store the escrow mapping
+        escrows[orderHash] = escrow;
+        
+        emit EscrowCreated(orderHash, escrow, token, amount);
+        return escrow;
+    }
+    
+    /**
+     * Get escrow address for order hash (1inch compatible)
+     */
+    function getEscrow(bytes32 orderHash) external view returns (address) {
+        return escrows[orderHash];
+    }
+    
+    /**
+     * Check if resolver is valid (1inch compatible)
+     */
+    function isValidResolver(address /* resolver */) external pure returns (bool) {
+        return true; // Simplified for demo
+    }
+    
+    /**
+     * Address computation for source escrow (1inch pattern)
+     */
+    function addressOfEscrowSrc(bytes32 orderHash) external view returns (address) {
+        return escrows[orderHash];
+    }
+}
+
+/**
+ * Individual escrow contract for atomic swaps
+ */
+contract LegacyOfficial1inchEscrow {
+    address public immutable creator;
+    address public immutable token;
+    uint256 public immutable amount;
+    uint256 public immutable deadline;
+    bytes32 public immutable orderHash;
+    bool public resolved;
+    
+    event EscrowResolved(bytes32 secret, address resolver);
+    
+    constructor(
+        address _creator, 
+        address _token, 
+        uint256 _amount, 
+        uint256 _deadline,
+        bytes32 _orderHash
+    ) payable {
+        creator = _creator;
+        token = _token;
+        amount = _amount;
+        deadline = _deadline;
+        orderHash = _orderHash;
+        
+        // Verify we received the correct ETH amount
+        require(msg.value == _amount, "Incorrect ETH amount in constructor");
+    }
+    
+    /**
+     * Resolve escrow with secret (1inch compatible)
+     */
+    function resolve(bytes32 secret) external {
+        require(!resolved, "Already resolved");
+        require(block.timestamp < deadline, "Escrow expired");
+        
+        resolved = true;
+        
+        // Transfer funds to resolver
+        if (token == address(0)) {
+            (bool success, ) = msg.sender.call{value: amount}("");
+            require(success, "ETH transfer failed");
+        }
+        
+        emit EscrowResolved(secret, msg.sender);
+    }
+    
+    /**
+     * Refund after deadline (only creator)
+     */
+    function refund() external {
+        require(msg.sender == creator, "Only creator can refund");
+        require(block.timestamp >= deadline, "Not yet expired");
+        require(!resolved, "Already resolved");
+        
+        resolved = true;
+        
+        if (token == address(0)) {
+            (bool success, ) = creator.call{value: amount}("");
+            require(success, "ETH refund failed");
+        }
+    }
+    
+    /**
+     * Get escrow info
+     */
+    function getInfo() external view returns (
+        address _creator,
+        address _token,
+        uint256 _amount,
+        uint256 _deadline,
+        bytes32 _orderHash,
+        bool _resolved
+    ) {
+        return (creator, token, amount, deadline, orderHash, resolved);
+    }
+    
+    receive() external payable {}
+}
\ No newline at end of file
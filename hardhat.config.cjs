@@ -4,8 +4,9 @@ require("dotenv").config();
 /** @type import('hardhat/config').HardhatUserConfig */
 module.exports = {
   solidity: {
-    version: "0.8.20",
+    version: "0.8.24",
     settings: {
+      evmVersion: "cancun", // transient storage (ReentrancyGuardTransient)
       optimizer: {
         enabled: true,
         runs: 200
@@ -27,7 +27,8 @@ export class MultiPartySwapArchitecture {
       "function createHTLCEscrow(address _recipient, address _resolver, bytes32 _hashlock, uint256 _timelock, uint256 _resolverFeeRate) external payable returns (bytes32 escrowId)",
       "function withdrawWithSecret(bytes32 _escrowId, bytes32 _secret) external returns (bool)",
       "function refundAfterTimeout(bytes32 _escrowId) external returns (bool)",
-      "function getEscrow(bytes32 _escrowId) external view returns (tuple(address initiator, address recipient, address resolver, uint256 amount, bytes32 hashlock, uint256 timelock, bool withdrawn, bool refunded))",
+      "function getEscrow(bytes32 _escrowId) external view returns (tuple(address initiator, address recipient, address resolver, uint256 amount, bytes32 hashlock, uint256 timelocks, bool withdrawn, bool refunded))",
+      "function getExpiry(bytes32 _escrowId) external view returns (uint256)",
       "function setResolverAuthorization(address _resolver, bool _authorized) external",
       "function isResolverAuthorized(address _resolver) external view returns (bool)",
       "function getOfficial1inchContracts() external pure returns (address settlement, address routerV5)"
@@ -1,5 +1,8 @@
 import { ethers } from 'ethers'
 
+// Escrows are CREATE2 clones that keep no parameters: resolve()/refund() take them back in
+const ESCROW_IMMUTABLES_TUPLE = 'tuple(bytes32 orderHash, address creator, address token, uint256 amount, uint256 deadline)'
+
 /**
  * 🏭 OFFICIAL 1INCH ESCROW FACTORY INTEGRATION
  * 
@@ -34,17 +37,16 @@ export class Official1inchEscrowIntegration {
       "function isValidResolver(address resolver) external view returns (bool)",
       "event EscrowCreated(bytes32 indexed orderHash, address indexed escrow, address indexed token, uint256 amount)",
       "event EscrowResolved(address indexed escrow, bytes32 secret)",
-      "event EscrowRefunded(address indexed escrow)"
+      "event EscrowRefunded(address indexed escrow)",
+      `event EscrowDeployed(bytes32 indexed orderHash, address indexed escrow, ${ESCROW_IMMUTABLES_TUPLE} immutables)`
     ]
     
     // Official 1inch Escrow contract ABI
     this.escrowABI = [
-      "function resolve(bytes32 secret) external",
-      "function refund() external",
-      "function getInfo() external view returns (address token, uint256 amount, address resolver, uint256 deadline, bool resolved, bool refunded)",
-      "function orderHash() external view returns (bytes32)",
-      "function hashlock() external view returns (bytes32)",
-      "function timelock() external view returns (uint256)"
+      `function resolve(bytes32 secret, ${ESCROW_IMMUTABLES_TUPLE} immutables) external`,
+      `function refund(${ESCROW_IMMUTABLES_TUPLE} immutables) external`,
+      "function resolved() external view returns (bool)",
+      "function refunded() external view returns (bool)"
     ]
     
     this.escrowFactory = null
@@ -237,20 +239,25 @@ export class Official1inchEscrowIntegration {
       console.log('✅ Transaction confirmed!')
       console.log(`📦 Block: ${receipt.blockNumber}`)
       
-      // Get escrow address from logs
+      // Get escrow address and immutables from logs
       let escrowAddress = null
+      let immutables = null
       for (const log of receipt.logs) {
         try {
           const parsedLog = this.escrowFactory.interface.parseLog(log)
           if (parsedLog.name === 'EscrowCreated') {
             escrowAddress = parsedLog.args.escrow
             console.log(`🏠 Escrow Address: ${escrowAddress}`)
-            break
+          } else if (parsedLog.name === 'EscrowDeployed') {
+            const { creator, amount: lockedAmount, deadline: lockedDeadline } = parsedLog.args.immutables
+            immutables = { orderHash, creator, token, amount: lockedAmount, deadline: lockedDeadline }
           }
         } catch (e) {
           // Ignore unparseable logs
         }
       }
+      // Factories without EscrowDeployed: the caller is the creator
+      immutables = immutables || { orderHash, creator: this.ethSigner.address, token, amount, deadline }
       
       const escrowInfo = {
         escrowAddress,
@@ -261,6 +268,7 @@ export class Official1inchEscrowIntegration {
         amount: amount.toString(),
         deadline,
         hashlock,
+        immutables,
         official1inch: true,
         factory: this.contracts.escrowFactory
       }
@@ -303,16 +311,12 @@ export class Official1inchEscrowIntegration {
       // Create escrow contract instance
       const escrowContract = new ethers.Contract(
         escrowInfo.escrowAddress,
-        [
-          "function resolve(bytes32 secret) external",
-          "function resolved() external view returns (bool)",
-          "function deadline() external view returns (uint256)"
-        ],
+        this.escrowABI,
         this.ethSigner
       )
       
       // Resolve the escrow directly
-      const txResponse = await escrowContract.resolve(secret, {
+      const txResponse = await escrowContract.resolve(secret, escrowInfo.immutables, {
         gasLimit: 300000
       })
       
@@ -352,15 +356,16 @@ export class Official1inchEscrowIntegration {
         this.ethProvider
       )
       
-      const info = await escrowContract.getInfo()
+      // Parameters come from the immutables; only the settlement flags live on-chain
+      const [resolved, refunded] = await Promise.all([escrowContract.resolved(), escrowContract.refunded()])
       return {
         ...escrowInfo,
-        token: info.token,
-        amount: info.amount.toString(),
-        resolver: info.resolver,
-        deadline: info.deadline,
-        resolved: info.resolved,
-        refunded: info.refunded
+        token: escrowInfo.immutables.token,
+        amount: escrowInfo.immutables.amount.toString(),
+        creator: escrowInfo.immutables.creator,
+        deadline: escrowInfo.immutables.deadline,
+        resolved,
+        refunded
       }
     } else {
       return escrowInfo
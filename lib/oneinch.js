@@ -1,9 +1,13 @@
 import axios from 'axios'
 
+// Price responses are reused for this long before hitting the API again
+const PRICE_CACHE_TTL_MS = 10000
+
 class OneInchAPI {
   constructor(apiKey) {
     this.apiKey = apiKey
     this.baseURL = 'https://api.1inch.dev'
+    this.priceCache = new Map() // `${chainId}:${tokenAddress}` -> { value, expiresAt, pending }
     this.client = axios.create({
       baseURL: this.baseURL,
       headers: {
@@ -70,20 +74,31 @@ class OneInchAPI {
     }
   }
 
-  // Price discovery
+  // Price discovery (TTL-cached; concurrent callers share one in-flight request)
   async getTokenPrice(tokenAddress, chainId = 1) {
-    try {
-      const response = await this.client.get('/price', {
-        params: { 
-          tokenAddress,
-          chainId 
-        }
-      })
+    const key = `${chainId}:${tokenAddress.toLowerCase()}`
+    const cached = this.priceCache.get(key)
+    if (cached) {
+      if (cached.pending) return cached.pending
+      if (cached.expiresAt > Date.now()) return cached.value
+    }
+
+    const pending = this.client.get('/price', {
+      params: { 
+        tokenAddress,
+        chainId 
+      }
+    }).then(response => {
+      this.priceCache.set(key, { value: response.data, expiresAt: Date.now() + PRICE_CACHE_TTL_MS })
       return response.data
-    } catch (error) {
+    }).catch(error => {
+      this.priceCache.delete(key)
       console.error('Price discovery error:', error)
       throw error
-    }
+    })
+
+    this.priceCache.set(key, { pending })
+    return pending
   }
 }
 
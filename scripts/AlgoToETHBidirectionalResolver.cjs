@@ -12,6 +12,7 @@
 const { ethers } = require('hardhat');
 const algosdk = require('algosdk');
 const fs = require('fs');
+const { decodeTransactionEvents } = require('./htlcEvents.cjs');
 
 class AlgoToETHBidirectionalResolver {
     constructor() {
@@ -246,16 +247,25 @@ class AlgoToETHBidirectionalResolver {
     }
     
     async extractAlgorandHTLCDetails(algoTxn) {
-        // Extract details from Algorand HTLC transaction
-        const amount = algoTxn.txn.amt || 500; // Default to 0.0005 ALGO if not found
-        const algoAmount = amount / 1000000;
+        // HTLC parameters come from the app's HTLCCreated log, never from positional args
+        const created = decodeTransactionEvents(algoTxn).find(event => event.name === 'HTLCCreated');
+        if (!created) {
+            throw new Error('No HTLCCreated event in transaction');
+        }
+        
+        // The Ethereum target is not part of the event: it travels in the note
+        const note = algoTxn.txn.note ? Buffer.from(algoTxn.txn.note).toString() : '';
+        const ethTarget = (note.match(/0x[a-fA-F0-9]{40}/) || [])[0];
+        if (!ethTarget) {
+            throw new Error('No Ethereum target in transaction note');
+        }
         
-        // Mock extraction - in real implementation, decode from app args
         return {
-            algoAmount: algoAmount,
-            ethTarget: '0x' + '1'.repeat(40), // Extract from transaction notes/args
-            hashlock: '0x' + 'a'.repeat(64), // Extract from app args
-            timelock: Math.floor(Date.now() / 1000) + 3600, // 1 hour from now
+            algoAmount: Number(created.amount) / 1000000,
+            ethTarget: ethTarget,
+            hashlock: created.hashlock,
+            timelock: Number(created.timelock),
+            htlcKey: created.htlcKey,
             algorandTxId: algoTxn.txn.tx || 'unknown'
         };
     }
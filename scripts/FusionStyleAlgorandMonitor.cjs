@@ -14,6 +14,7 @@
 const { ethers } = require('hardhat');
 const algosdk = require('algosdk');
 const fs = require('fs');
+const { DutchAuctionScheduler, CURVES } = require('./dutchAuctionScheduler.cjs');
 
 class FusionStyleAlgorandMonitor {
     constructor() {
@@ -40,7 +41,7 @@ class FusionStyleAlgorandMonitor {
                 initialRateBump: 0,         // No premium (1inch default)
                 linearDecay: true,          // Simple linear decay
                 checkInterval: 5000,        // Check every 5s
-                gasDecayRate: 0.25          // 25% decay per minute (1inch style)
+                settleAtProgress: 0.8       // Settle when the curve reaches its 80% price
             },
             
             // 🤖 Resolver competition
@@ -93,6 +94,10 @@ class FusionStyleAlgorandMonitor {
         this.resolverCompetition = new Map();   // bytes32 auctionId -> ResolverBid[]
         this.profitCalculations = new Map();    // bytes32 orderId -> ProfitAnalysis
         
+        // Settlement is armed for the block where the Enhanced1inchStyleBridge curve hits our reservation
+        this.bidScheduler = new DutchAuctionScheduler(this.ethProvider);
+        this.bidScheduler.on('missed', ({ key }) => console.log(`⏰ Auction ${key} closed before settlement`));
+        
         console.log('🔗 FUSION MONITOR INITIALIZED');
         console.log(`   📍 Resolver ETH: ${this.ethWallet.address}`);
         console.log(`   📍 Resolver ALGO: ${this.algoAccount.addr}`);
@@ -341,12 +346,12 @@ class FusionStyleAlgorandMonitor {
         console.log('✅ Executing winning settlements');
         console.log('===============================\n');
         
-        // Auction management loop (1inch style)
+        // Auction bookkeeping only; settlement timing comes from bidScheduler
         setInterval(async () => {
             for (const [auctionId, auction] of this.activeAuctions) {
                 await this.updateAuctionState(auctionId, auction);
             }
-        }, 1000); // Update every second
+        }, this.config.auction.checkInterval);
     }
     
     /**
@@ -361,27 +366,14 @@ class FusionStyleAlgorandMonitor {
             if (auction.status === 'active') {
                 console.log(`⏰ Auction ${auctionId} expired`);
                 auction.status = 'expired';
+                this.bidScheduler.cancel(auctionId);
                 this.activeAuctions.delete(auctionId);
             }
             return;
         }
         
-        // Calculate current price (1inch Fusion decay pattern)
-        const decayProgress = elapsed / auction.config.duration;
-        const gasDecay = decayProgress * this.config.auction.gasDecayRate;
-        const currentGasPrice = auction.currentGasPrice * (1 - gasDecay);
-        
-        if (currentGasPrice < this.config.resolvers.minGasPrice) {
-            auction.currentGasPrice = this.config.resolvers.minGasPrice;
-        } else {
-            auction.currentGasPrice = currentGasPrice;
-        }
-        
-        // Check if we should execute (1inch style threshold)
-        if (decayProgress > 0.8 && auction.status === 'active') {
-            console.log(`🔥 Auction ${auctionId} approaching deadline - executing!`);
-            await this.executeFusionSettlement(auctionId, auction);
-        }
+        // Exact integer mirror of Enhanced1inchStyleBridge.getCurrentAuctionPrice
+        auction.currentGasPrice = CURVES.enhanced1inchStyleBridge.priceAt(this.auctionCurveParams(auction), now);
     }
     
     /**
@@ -409,10 +401,28 @@ class FusionStyleAlgorandMonitor {
         console.log(`   📊 Expected Profit: ${bid.profit.toFixed(6)} ETH`);
         console.log('   ✅ Bid submitted');
         
-        // Start settlement timer (1inch pattern)
-        setTimeout(async () => {
-            await this.executeFusionSettlement(auctionId, auction);
-        }, 30000); // Execute after 30 seconds
+        // Arm settlement for the block where the auction price reaches our reservation
+        const curve = CURVES.enhanced1inchStyleBridge;
+        const range = curve.INITIAL_GAS_PRICE - curve.MIN_GAS_PRICE;
+        const reservation = curve.INITIAL_GAS_PRICE - range * BigInt(Math.round(this.config.auction.settleAtProgress * 1000)) / 1000n;
+        
+        const plan = await this.bidScheduler.schedule(
+            auctionId,
+            'enhanced1inchStyleBridge',
+            this.auctionCurveParams(auction),
+            reservation,
+            (settlePlan) => {
+                auction.currentGasPrice = settlePlan.expectedPrice;
+                return this.executeFusionSettlement(auctionId, auction);
+            }
+        );
+        if (plan) {
+            console.log(`   ⏱️ Settlement armed for block ${plan.targetBlock} at ${ethers.formatUnits(plan.expectedPrice, 'gwei')} gwei`);
+        }
+    }
+    
+    auctionCurveParams(auction) {
+        return { startTime: auction.config.startTime, duration: auction.config.duration };
     }
     
     /**
@@ -420,6 +430,9 @@ class FusionStyleAlgorandMonitor {
      * Execute winning bid using 1inch Fusion settlement pattern
      */
     async executeFusionSettlement(auctionId, auction) {
+        if (auction.status !== 'active') return;
+        auction.status = 'settling';
+        
         console.log('🏆 EXECUTING FUSION SETTLEMENT...');
         console.log('==================================');
         
@@ -14,6 +14,11 @@ const { Server } = require('socket.io');
 const cors = require('cors');
 const { ethers } = require('ethers');
 const algosdk = require('algosdk');
+const { getPriceOracle } = require('./priceOracleCache.cjs');
+const { PartialFillAllocator } = require('./partialFillAllocator.cjs');
+const { WalletPoolExecutor } = require('./walletPoolExecutor.cjs');
+const { SecretTree } = require('./secretTree.cjs');
+const { PartialFillHistoryIndex } = require('./partialFillHistoryIndex.cjs');
 require('dotenv').config();
 
 class PartialFillRelayerService {
@@ -33,15 +38,27 @@ class PartialFillRelayerService {
         this.ethProvider = new ethers.JsonRpcProvider(`https://sepolia.infura.io/v3/${process.env.INFURA_PROJECT_ID}`);
         this.ethWallet = new ethers.Wallet(process.env.PRIVATE_KEY, this.ethProvider);
         
+        // Fills are signed by whichever resolver lane is least loaded
+        this.walletPool = new WalletPoolExecutor(
+            this.ethProvider,
+            WalletPoolExecutor.loadSigners(this.ethProvider, ethers.Wallet, { primaryKey: process.env.PRIVATE_KEY })
+        );
+        
         // Contract instances
         this.partialFillBridge = null;
         this.algoClient = null;
         
+        // Streaming ALGO/ETH price cache (TWAP + spread), read synchronously when pricing fills
+        this.priceOracle = getPriceOracle();
+        
         // Enhanced order tracking for partial fills
         this.activeOrders = new Map();          // All active orders
-        this.partialFillHistory = new Map();    // Fill history per order
+        this.partialFillHistory = new Map();    // Fill history per order (seen live by this process)
+        this.fillIndex = new PartialFillHistoryIndex();  // Full on-chain history rebuilt from events
         this.myFills = new Map();               // Fills executed by this resolver
         this.competitionData = new Map();       // Track competitor activity
+        this.inFlightFills = new Set();         // Orders with a fill tx pending
+        this.secretTrees = new Map();           // orderId -> SecretTree for multi-secret orders we hold secrets for
         
         // 🧩 Partial Fill Strategy Configuration
         this.strategy = {
@@ -67,6 +84,15 @@ class PartialFillRelayerService {
             liquidityPremium: 0.001                            // 0.1% liquidity premium
         };
         
+        // Fill sizes are chosen jointly across all open orders against wallet inventory
+        this.gasLimitPerFill = 300000n;
+        this.inventoryRefreshInterval = 15000;
+        this.allocator = new PartialFillAllocator({
+            priceOf: (asset) => asset === 'ETH' ? 1 : this.priceOracle.getPrice('ALGO/ETH').bid,
+            maxFills: this.strategy.maxConcurrentFills,
+            minMargin: this.strategy.minProfitMargin
+        });
+        
         this.setupMiddleware();
         this.setupRoutes();
         this.setupWebSocket();
@@ -85,12 +111,14 @@ class PartialFillRelayerService {
                 status: 'healthy', 
                 timestamp: new Date().toISOString(),
                 relayerAddress: this.ethWallet.address,
+                walletPool: this.walletPool.stats(),
                 partialFillStats: {
                     activeOrders: this.activeOrders.size,
                     totalFills: this.myFills.size,
                     averageFillSize: this.calculateAverageFillSize(),
                     successRate: this.calculateSuccessRate()
                 },
+                price: this.priceOracle.getPrice('ALGO/ETH'),
                 strategy: this.strategy
             });
         });
@@ -108,8 +136,22 @@ class PartialFillRelayerService {
         // Get order fill history
         this.app.get('/api/orders/:orderId/fills', (req, res) => {
             const orderId = req.params.orderId;
-            const fills = this.partialFillHistory.get(orderId) || [];
-            res.json({ success: true, orderId, fills });
+            const offset = parseInt(req.query.offset || '0', 10);
+            const limit = Math.min(parseInt(req.query.limit || '50', 10), 500);
+            const { total, fills } = this.fillIndex.getOrderFills(orderId, { offset, limit });
+            res.json({
+                success: true,
+                orderId,
+                total,
+                offset,
+                fills: fills.map(fill => ({
+                    ...fill,
+                    fillAmount: fill.fillAmount?.toString(),
+                    remainingAmount: fill.remainingAmount?.toString(),
+                    algorandAmount: fill.algorandAmount?.toString(),
+                    resolverFee: fill.resolverFee?.toString()
+                }))
+            });
         });
 
         // Advanced analytics endpoint
@@ -153,9 +195,11 @@ class PartialFillRelayerService {
                 "event LimitOrderCreated(bytes32 indexed orderId, address indexed maker, address makerToken, address takerToken, uint256 makerAmount, uint256 takerAmount, uint256 deadline, string algorandAddress, bytes32 hashlock, uint256 timelock, bool partialFillsEnabled, uint256 minFillAmount)",
                 "event PartialOrderFilled(bytes32 indexed orderId, address indexed resolver, uint256 fillAmount, uint256 remainingAmount, uint256 algorandAmount, uint256 resolverFee, uint256 fillIndex, bool isFullyFilled)",
                 "event OrderFullyFilled(bytes32 indexed orderId, address indexed finalResolver, uint256 totalFilled, uint256 totalResolverFees, uint256 fillCount)",
+                "event MultipleFillsEnabled(bytes32 indexed orderId, bytes32 secretsRoot, uint256 partsAmount)",
                 "function fillLimitOrder(bytes32 orderId, uint256 fillAmount, bytes32 secret, uint256 algorandAmount) external",
-                "function getOrderSummary(bytes32) external view returns (uint256, uint256, uint256, uint256, bool, address[])",
-                "function getOrderFills(bytes32) external view returns (tuple(bytes32,address,uint256,uint256,bytes32,uint256,uint256)[])"
+                "function fillLimitOrderWithProof(bytes32 orderId, uint256 fillAmount, bytes32 secret, uint256 algorandAmount, bytes32[] proof) external",
+                "event PartialFillSecretRevealed(bytes32 indexed orderId, uint256 indexed fillIndex, bytes32 secret)",
+                "function getOrderSummary(bytes32) external view returns (uint256, uint256, uint256, uint256, bool, uint256)"
             ];
             
             const contractAddress = process.env.PARTIAL_FILL_BRIDGE_ADDRESS || process.env.LIMIT_ORDER_BRIDGE_ADDRESS;
@@ -179,6 +223,14 @@ class PartialFillRelayerService {
     async startMonitoring() {
         console.log('📡 Starting partial fill monitoring...');
         
+        // Fill history comes from events (the bridge keeps only running totals)
+        this.fillIndex.attach(this.partialFillBridge);
+        if (process.env.PARTIAL_FILL_INDEX_FROM_BLOCK) {
+            const head = await this.ethProvider.getBlockNumber();
+            await this.fillIndex.backfill(this.partialFillBridge, parseInt(process.env.PARTIAL_FILL_INDEX_FROM_BLOCK, 10), head);
+            console.log(`📚 Fill history backfilled to block ${head}`);
+        }
+        
         // Monitor for new orders with partial fill capability
         this.partialFillBridge.on('LimitOrderCreated', async (orderId, maker, makerToken, takerToken, makerAmount, takerAmount, deadline, algorandAddress, hashlock, timelock, partialFillsEnabled, minFillAmount, event) => {
             console.log(`🎯 New order detected: ${orderId}`);
@@ -211,12 +263,18 @@ class PartialFillRelayerService {
             // Notify frontend
             this.io.emit('newPartialFillOrder', orderData);
             
-            // Analyze immediately for competitive advantage
-            if (partialFillsEnabled) {
-                setTimeout(() => this.analyzePartialFillOpportunity(orderId), 2000);
-            } else {
-                setTimeout(() => this.evaluateFullFillOrder(orderId), 5000);
+            // Hand to the allocator; full-fill-only orders compete for the same inventory
+            this.allocator.upsertOrder(PartialFillAllocator.fromPartialFillBridge(orderId, orderData));
+        });
+        
+        // Orders split into parts with one secret each (submitLimitOrderWithSecretTree)
+        this.partialFillBridge.on('MultipleFillsEnabled', (orderId, secretsRoot, partsAmount) => {
+            const order = this.activeOrders.get(orderId);
+            if (order) {
+                order.secretsRoot = secretsRoot;
+                order.partsAmount = Number(partsAmount);
             }
+            console.log(`🌳 Order ${orderId} uses ${partsAmount} secret parts`);
         });
         
         // Monitor partial fill executions
@@ -238,7 +296,7 @@ class PartialFillRelayerService {
                 timestamp: new Date().toISOString(),
                 blockNumber: event.blockNumber,
                 transactionHash: event.transactionHash,
-                isMyFill: resolver.toLowerCase() === this.ethWallet.address.toLowerCase()
+                isMyFill: this.walletPool.hasAddress(resolver)
             };
             
             // Update tracking
@@ -247,9 +305,17 @@ class PartialFillRelayerService {
             // Notify frontend
             this.io.emit('partialFillExecuted', fillData);
             
-            // Analyze remaining opportunity if not fully filled
-            if (!isFullyFilled && remainingAmount > 0) {
-                setTimeout(() => this.analyzePartialFillOpportunity(orderId), 10000);
+            // Re-size against the new remaining amount (incremental re-solve)
+            if (isFullyFilled || remainingAmount === 0n) {
+                this.allocator.removeOrder(orderId);
+            } else {
+                const order = this.activeOrders.get(orderId);
+                if (order) {
+                    this.allocator.upsertOrder(PartialFillAllocator.fromPartialFillBridge(orderId, order, {
+                        remainingAmount,
+                        fillCount: fillIndex + 1n
+                    }));
+                }
             }
         });
         
@@ -271,6 +337,7 @@ class PartialFillRelayerService {
                 // Move to history
                 this.activeOrders.delete(orderId);
             }
+            this.allocator.removeOrder(orderId);
             
             // Notify frontend
             this.io.emit('orderFullyCompleted', {
@@ -283,85 +350,53 @@ class PartialFillRelayerService {
         });
     }
 
-    async analyzePartialFillOpportunity(orderId) {
-        const order = this.activeOrders.get(orderId);
-        if (!order || !order.partialFillsEnabled) return;
-        
-        console.log(`🧮 Analyzing partial fill opportunity: ${orderId}`);
-        
-        try {
-            // Get current order state
-            const [totalAmount, filledAmount, remainingAmount, fillCount, fullyFilled, resolvers] = 
-                await this.partialFillBridge.getOrderSummary(orderId);
-            
-            if (fullyFilled || remainingAmount === 0n) {
-                console.log(`❌ Order ${orderId} already fully filled`);
-                return;
-            }
-            
-            // Calculate optimal fill amount
-            const optimalFillAmount = this.calculateOptimalFillAmount(order, remainingAmount);
-            
-            if (optimalFillAmount === 0n) {
-                console.log(`📉 No profitable fill opportunity for ${orderId}`);
-                return;
-            }
-            
-            // Calculate profitability
-            const profitability = await this.calculatePartialFillProfitability(order, optimalFillAmount);
+    /**
+     * Execute the allocator's plan for orders whose planned fill changed.
+     * Orders with a fill already in flight are skipped; their event triggers a re-solve.
+     */
+    async executeAllocation(changedOrderIds) {
+        for (const orderId of changedOrderIds) {
+            const fill = this.allocator.allocation.get(orderId);
+            const order = this.activeOrders.get(orderId);
+            if (!fill || !order || order.status !== 'pending' || this.inFlightFills.has(orderId)) continue;
             
-            if (!profitability.isProfitable) {
-                console.log(`📉 Partial fill not profitable: ${profitability.profitMargin}%`);
-                return;
+            try {
+                const profitability = await this.calculatePartialFillProfitability(order, fill.fillAmount);
+                if (!profitability.isProfitable) {
+                    console.log(`📉 Planned fill no longer profitable: ${orderId} (${profitability.profitMargin}%)`);
+                    continue;
+                }
+                
+                console.log(`💰 Allocated fill for ${orderId}:`);
+                console.log(`  - Fill Amount: ${ethers.formatEther(fill.fillAmount)} ETH`);
+                console.log(`  - ALGO Delivered: ${ethers.formatUnits(fill.spendAmount, 6)} ALGO`);
+                console.log(`  - Expected Profit: ${profitability.expectedProfit} ETH`);
+                
+                this.inFlightFills.add(orderId);
+                await this.executePartialFill(orderId, fill.fillAmount, profitability, fill.spendAmount);
+            } catch (error) {
+                console.error(`❌ Error executing allocated fill for ${orderId}:`, error.message);
+            } finally {
+                this.inFlightFills.delete(orderId);
             }
-            
-            console.log(`💰 Profitable partial fill identified:`);
-            console.log(`  - Fill Amount: ${ethers.formatEther(optimalFillAmount)} ETH`);
-            console.log(`  - Expected Profit: ${profitability.expectedProfit} ETH`);
-            console.log(`  - Profit Margin: ${profitability.profitMargin}%`);
-            
-            // Execute the partial fill
-            await this.executePartialFill(orderId, optimalFillAmount, profitability);
-            
-        } catch (error) {
-            console.error(`❌ Error analyzing partial fill opportunity:`, error);
         }
     }
 
-    calculateOptimalFillAmount(order, remainingAmount) {
-        const remainingAmountBN = BigInt(remainingAmount.toString());
-        const minFillAmountBN = BigInt(order.minFillAmount);
-        
-        // Can't fill less than minimum
-        if (remainingAmountBN < minFillAmountBN) {
-            return 0n;
-        }
-        
-        // Calculate based on strategy
-        const maxCapitalBN = ethers.parseEther(this.strategy.maxCapitalPerOrder.toString().split('.')[1] ? 
-            this.strategy.maxCapitalPerOrder.toString() : 
-            this.strategy.maxCapitalPerOrder.toString() + '.0');
-        
-        const preferredFillBN = remainingAmountBN * BigInt(Math.floor(this.strategy.preferredFillRatio * 10000)) / 10000n;
-        const maxFillBN = remainingAmountBN * BigInt(Math.floor(this.strategy.maxFillRatio * 10000)) / 10000n;
-        
-        // Choose the smallest of: preferred, max strategy, max capital, remaining
-        let optimalFill = preferredFillBN;
-        if (optimalFill > maxFillBN) optimalFill = maxFillBN;
-        if (optimalFill > maxCapitalBN) optimalFill = maxCapitalBN;
-        if (optimalFill > remainingAmountBN) optimalFill = remainingAmountBN;
-        
-        // Ensure it's at least the minimum
-        if (optimalFill < minFillAmountBN) {
-            optimalFill = minFillAmountBN;
-        }
-        
-        // Final check against remaining
-        if (optimalFill > remainingAmountBN) {
-            optimalFill = remainingAmountBN;
+    async refreshInventory() {
+        try {
+            // ETH for gas is whatever the pool lanes have not already committed
+            const feeData = await this.ethProvider.getFeeData();
+            const ethAvailable = this.walletPool.lanes.reduce((sum, lane) => sum + (lane.available > 0n ? lane.available : 0n), 0n);
+            this.allocator.setInventory('ETH', ethAvailable);
+            this.allocator.setGasCost((feeData.gasPrice || 0n) * this.gasLimitPerFill);
+            
+            if (process.env.ALGORAND_ACCOUNT_ADDRESS) {
+                const account = await this.algoClient.accountInformation(process.env.ALGORAND_ACCOUNT_ADDRESS).do();
+                this.allocator.setInventory('ALGO', BigInt(account.amount) - BigInt(account['min-balance'] || 0));
+            }
+        } catch (error) {
+            console.error('❌ Inventory refresh failed:', error.message);
         }
-        
-        return optimalFill;
     }
 
     async calculatePartialFillProfitability(order, fillAmount) {
@@ -370,25 +405,26 @@ class PartialFillRelayerService {
         const totalTakerAmount = BigInt(order.takerAmount);
         const expectedAlgoAmount = (totalTakerAmount * fillAmount) / totalMakerAmount;
         
-        // Get current exchange rate (simplified - in production use real price feeds)
-        const algoToETHRate = 0.001; // 1 ALGO = 0.001 ETH
-        const ethToAlgoRate = 1 / algoToETHRate; // 1 ETH = 1000 ALGO
+        // Value the ALGO leg at the cached TWAP bid (spread-adjusted, no network I/O)
+        const price = this.priceOracle.getPrice('ALGO/ETH');
+        const algoToETHRate = price.bid;
         
         const fillAmountInETH = parseFloat(ethers.formatEther(fillAmount));
         const expectedETHValue = parseFloat(ethers.formatUnits(expectedAlgoAmount, 6)) * algoToETHRate;
         
         // Calculate gas costs
-        const gasPrice = await this.ethProvider.getGasPrice();
+        const { gasPrice } = await this.ethProvider.getFeeData();
         const gasLimit = 300000n; // Estimated gas for partial fill
         const gasCost = gasPrice * gasLimit;
         const gasCostInETH = parseFloat(ethers.formatEther(gasCost));
         
-        // Calculate profit
-        const grossProfit = expectedETHValue - fillAmountInETH;
+        // Calculate profit: we receive the ETH fill and deliver the ALGO leg
+        const grossProfit = fillAmountInETH - expectedETHValue;
         const netProfit = grossProfit - gasCostInETH;
         const profitMargin = (netProfit / fillAmountInETH) * 100;
         
-        const isProfitable = netProfit > 0 && profitMargin >= (this.strategy.minProfitMargin * 100);
+        // Stale prices (all feeds down) never justify committing capital
+        const isProfitable = !price.stale && netProfit > 0 && profitMargin >= (this.strategy.minProfitMargin * 100);
         
         return {
             fillAmountInETH,
@@ -398,62 +434,66 @@ class PartialFillRelayerService {
             profitMargin: profitMargin.toFixed(2),
             gasCostInETH: gasCostInETH.toFixed(6),
             isProfitable,
+            algoToETHRate,
+            priceSpread: price.spread,
+            priceStale: Boolean(price.stale),
             expectedProfit: netProfit.toFixed(6),
             expectedAlgoAmount: ethers.formatUnits(expectedAlgoAmount, 6)
         };
     }
 
-    async executePartialFill(orderId, fillAmount, profitability) {
+    async executePartialFill(orderId, fillAmount, profitability, algorandAmount) {
         try {
             console.log(`🚀 Executing partial fill: ${orderId}`);
             console.log(`💰 Fill amount: ${ethers.formatEther(fillAmount)} ETH`);
             
             const order = this.activeOrders.get(orderId);
             
-            // Generate secret for HTLC
-            const secret = ethers.randomBytes(32);
-            const secretHash = ethers.keccak256(secret);
-            
-            // Verify hashlock matches (in production, derive from order)
-            const expectedHashlock = order.hashlock;
+            // Multi-secret orders: reveal only the secret of the part this fill reaches
+            const fillArgs = order.partsAmount ? this.secretFillArgs(orderId, order, fillAmount) : null;
             
-            // Calculate ALGO amount
-            const algorandAmount = Math.floor(parseFloat(profitability.expectedAlgoAmount) * 1e6); // Convert to microAlgos
-            
-            // Execute partial fill
-            const tx = await this.partialFillBridge.fillLimitOrder(
-                orderId,
-                fillAmount,
-                secret,
-                algorandAmount
-            );
-            
-            console.log(`📜 Partial fill transaction sent: ${tx.hash}`);
+            // Generate secret for HTLC
+            const secret = fillArgs ? fillArgs.secret : ethers.randomBytes(32);
+            
+            // ALGO amount (microAlgos) as sized by the allocator, rounded up to the order's rate
+            algorandAmount = algorandAmount ?? BigInt(Math.ceil(parseFloat(profitability.expectedAlgoAmount) * 1e6));
+            
+            // Execute partial fill on a pool lane
+            const { tx, receipt, lane } = await this.walletPool.submit(orderId, (signer, overrides) => fillArgs
+                ? this.partialFillBridge.connect(signer).fillLimitOrderWithProof(
+                    orderId,
+                    fillAmount,
+                    fillArgs.secret,
+                    algorandAmount,
+                    fillArgs.proof,
+                    overrides
+                )
+                : this.partialFillBridge.connect(signer).fillLimitOrder(
+                    orderId,
+                    fillAmount,
+                    secret,
+                    algorandAmount,
+                    overrides
+                ), { gasLimit: this.gasLimitPerFill });
+            this.walletPool.endSwap(orderId);
             
             // Track the fill
             this.myFills.set(tx.hash, {
                 orderId,
                 fillAmount: fillAmount.toString(),
-                algorandAmount,
+                algorandAmount: algorandAmount.toString(),
                 secret: ethers.hexlify(secret),
+                secretIndex: fillArgs ? fillArgs.index : null,
                 profitability,
+                resolver: lane,
                 timestamp: new Date().toISOString(),
-                status: 'pending'
+                status: 'confirmed',
+                blockNumber: receipt.blockNumber
             });
-            
-            // Wait for confirmation
-            const receipt = await tx.wait();
-            console.log(`✅ Partial fill confirmed: ${receipt.transactionHash}`);
-            
-            // Update tracking
-            const fill = this.myFills.get(tx.hash);
-            if (fill) {
-                fill.status = 'confirmed';
-                fill.blockNumber = receipt.blockNumber;
-            }
+            console.log(`✅ Partial fill confirmed: ${tx.hash} (lane ${lane})`);
             
             return {
-                transactionHash: receipt.transactionHash,
+                transactionHash: tx.hash,
                 fillAmount: ethers.formatEther(fillAmount),
                 profitability
             };
@@ -464,28 +504,43 @@ class PartialFillRelayerService {
         }
     }
 
-    // Analytics and utility methods
-    analyzePartialFillOpportunities() {
-        const opportunities = [];
-        
-        for (const [orderId, order] of this.activeOrders) {
-            if (order.partialFillsEnabled && order.status === 'pending') {
-                const remainingAmount = BigInt(order.remainingAmount || order.makerAmount);
-                const optimalFill = this.calculateOptimalFillAmount(order, remainingAmount);
-                
-                if (optimalFill > 0n) {
-                    opportunities.push({
-                        orderId,
-                        order,
-                        optimalFillAmount: ethers.formatEther(optimalFill),
-                        remainingAmount: ethers.formatEther(remainingAmount),
-                        estimatedProfit: 'Calculating...'
-                    });
-                }
-            }
+    /**
+     * Register the secrets of a multi-secret order (e.g. one this relayer submitted for a user)
+     */
+    registerSecretTree(orderId, tree) {
+        this.secretTrees.set(orderId, tree instanceof SecretTree ? tree : SecretTree.fromJSON(tree));
+    }
+    
+    secretFillArgs(orderId, order, fillAmount) {
+        const tree = this.secretTrees.get(orderId);
+        if (!tree) throw new Error(`No secret tree registered for ${orderId}`);
+        if (order.secretsRoot && tree.root !== order.secretsRoot.toLowerCase()) {
+            throw new Error(`Secret tree root mismatch for ${orderId}`);
         }
         
-        return opportunities;
+        const total = BigInt(order.makerAmount);
+        const filledBefore = total - BigInt(order.remainingAmount);
+        const args = tree.fillArgs(total, filledBefore, fillAmount);
+        if (!args) {
+            const minFill = SecretTree.minFillToNextPart(total, filledBefore, tree.partsAmount);
+            throw new Error(`Fill stays inside the current part; needs at least ${ethers.formatEther(minFill)} ETH`);
+        }
+        return args;
+    }
+    
+    // Analytics and utility methods
+    analyzePartialFillOpportunities() {
+        return this.allocator.plan().map(fill => {
+            const order = this.activeOrders.get(fill.orderId);
+            return {
+                orderId: fill.orderId,
+                order,
+                optimalFillAmount: ethers.formatEther(fill.fillAmount),
+                algorandAmount: ethers.formatUnits(fill.spendAmount, 6),
+                remainingAmount: ethers.formatEther(order?.remainingAmount || 0),
+                estimatedProfit: fill.profitEth.toFixed(6)
+            };
+        });
     }
 
     updatePartialFillTracking(fillData) {
@@ -570,21 +625,18 @@ class PartialFillRelayerService {
         };
     }
 
-    async evaluateFullFillOrder(orderId) {
-        // Handle non-partial fill orders (original logic)
-        const order = this.activeOrders.get(orderId);
-        if (!order || order.partialFillsEnabled) return;
-        
-        console.log(`🎯 Evaluating full fill order: ${orderId}`);
-        // Implementation similar to original relayer...
-    }
-
     async start() {
         const initialized = await this.initialize();
         if (!initialized) {
             process.exit(1);
         }
         
+        this.allocator.on('allocation', ({ changed }) => this.executeAllocation(changed));
+        await this.walletPool.init();
+        this.walletPool.start();
+        await this.refreshInventory();
+        setInterval(() => this.refreshInventory(), this.inventoryRefreshInterval);
+        
         await this.startMonitoring();
         
         this.server.listen(this.port, () => {
@@ -0,0 +1,219 @@
+#!/usr/bin/env node
+
+/**
+ * 🧺 ALGORAND MULTI-RESOLVER BATCH FILL
+ *
+ * Client side of `batch_fill` on the Algorand partial fill apps
+ * (contracts/algorand/PartialFillBatch.py):
+ * ✅ Fill record codec: signer group index (1) | amount uint64 (8) | secret (32)
+ * ✅ Every resolver other than the submitter signs a zero-amount companion
+ *    payment in the group; fills are attributed to the signer of that txn
+ * ✅ Packs fills into app calls of up to 8 (the 1024-byte log limit)
+ * ✅ Payouts go to the recipient stored at create_htlc, never to the caller
+ * ✅ Companions and calls go out as one atomic group, fees pooled into the calls
+ * ✅ Checks secrets, the remaining amount, the timelock and that partial
+ *    fills are enabled before anything is signed
+ *
+ * One app call settles up to 8 fills instead of 8 app calls; a group of 16
+ * transactions (companions included) settles the rest in one atomic submission.
+ *
+ * Configuration (env):
+ *   ALGORAND_PARTIAL_FILL_APP_ID   application id of the partial fill bridge
+ */
+
+const crypto = require('crypto');
+const { decodeAlgorandAddress, encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+
+const BATCH_FILL_METHOD = 'batch_fill';
+const FILL_RECORD_LENGTH = 41;
+const MAX_BATCH_FILLS = 8;      // 8 × 116-byte HTLCPartiallyFilled logs ≤ 1024 bytes
+const MAX_GROUP_SIZE = 16;
+const MIN_TXN_FEE = 1000;
+
+const toBytes = (hex, length, name) => {
+    const bytes = Buffer.from(String(hex).replace(/^0x/, ''), 'hex');
+    if (bytes.length !== length) throw new Error(`${name} must be ${length} bytes`);
+    return bytes;
+};
+
+function encodeFillRecord({ signer, amount, secret }) {
+    if (!Number.isInteger(signer) || signer < 0 || signer >= MAX_GROUP_SIZE) throw new Error(`signer must be a group index below ${MAX_GROUP_SIZE}`);
+    const value = BigInt(amount);
+    if (value <= 0n) throw new Error('fill amount must be positive');
+    const word = Buffer.alloc(8);
+    word.writeBigUInt64BE(value);
+    return Buffer.concat([Buffer.from([signer]), word, toBytes(secret, 32, 'secret')]);
+}
+
+function decodeFillRecord(record) {
+    const bytes = Buffer.from(record);
+    if (bytes.length !== FILL_RECORD_LENGTH) throw new Error(`fill record must be ${FILL_RECORD_LENGTH} bytes, got ${bytes.length}`);
+    return {
+        signer: bytes[0],
+        amount: bytes.readBigUInt64BE(1),
+        secret: '0x' + bytes.subarray(9, 41).toString('hex')
+    };
+}
+
+/**
+ * App call arguments and foreign accounts for one batch_fill call
+ *
+ * @param fills     Array<{resolver, amount, secret}>
+ * @param signers   Map resolver → index of a group txn it signs
+ * @param recipient stored recipient; the payout receiver must be a foreign account
+ */
+function batchFillCall(fills, { signers, recipient }) {
+    if (fills.length === 0 || fills.length > MAX_BATCH_FILLS) throw new Error(`batch_fill takes 1 to ${MAX_BATCH_FILLS} fills, got ${fills.length}`);
+    return {
+        appArgs: [new Uint8Array(Buffer.from(BATCH_FILL_METHOD)), ...fills.map(fill => {
+            if (!signers.has(fill.resolver)) throw new Error(`${fill.resolver} signs nothing in the group`);
+            return new Uint8Array(encodeFillRecord({ ...fill, signer: signers.get(fill.resolver) }));
+        })],
+        accounts: [recipient]
+    };
+}
+
+/**
+ * Split fills into batch_fill calls, in order, behind one companion per resolver
+ *
+ * Group layout: companions (one zero-amount self-payment per resolver other
+ * than the submitter, fee 0), then the calls. The submitter's fills point at
+ * the first call.
+ *
+ * @param {Array<{resolver, amount, secret}>} fills
+ * @param {object} [options]
+ *   submitter   address sending the app calls
+ *   remaining   remaining_amount of the app; the batch may not exceed it
+ *   hashlock    stored hashlock; every secret must hash to it
+ * @returns {{ companions, signers, calls: Array<{ fills, total, remainingAfter, fee }>, total, fee }}
+ */
+function planBatchFills(fills, { submitter, remaining, hashlock } = {}) {
+    if (!fills.length) throw new Error('no fills to settle');
+    const expected = hashlock === undefined ? null : toBytes(hashlock, 32, 'hashlock');
+
+    const calls = [];
+    for (const fill of fills) {
+        encodeFillRecord({ ...fill, signer: 0 });
+        decodeAlgorandAddress(fill.resolver);
+        if (expected && !crypto.createHash('sha256').update(toBytes(fill.secret, 32, 'secret')).digest().equals(expected)) {
+            throw new Error(`secret for ${fill.resolver} does not match the hashlock`);
+        }
+        if (!calls.length || calls[calls.length - 1].fills.length === MAX_BATCH_FILLS) calls.push({ fills: [] });
+        calls[calls.length - 1].fills.push(fill);
+    }
+
+    const companions = [...new Set(fills.map(fill => fill.resolver))].filter(resolver => resolver !== submitter);
+    const groupSize = companions.length + calls.length;
+    if (groupSize > MAX_GROUP_SIZE) {
+        throw new Error(`${fills.length} fills need ${calls.length} app calls and ${companions.length} companions, a group holds ${MAX_GROUP_SIZE}`);
+    }
+    const signers = new Map(companions.map((resolver, i) => [resolver, i]));
+    if (submitter !== undefined) signers.set(submitter, companions.length);
+
+    let total = 0n;
+    for (const [i, call] of calls.entries()) {
+        call.total = call.fills.reduce((sum, fill) => sum + BigInt(fill.amount), 0n);
+        total += call.total;
+        call.fee = (2 + (i === 0 ? companions.length : 0)) * MIN_TXN_FEE; // call + inner payment (+ companions)
+        if (remaining !== undefined) call.remainingAfter = BigInt(remaining) - total;
+    }
+    if (remaining !== undefined && total > BigInt(remaining)) throw new Error(`batch of ${total} exceeds remaining ${remaining}`);
+
+    return { companions, signers, calls, total, fee: calls.reduce((sum, call) => sum + call.fee, 0) };
+}
+
+class BatchFillClient {
+    /**
+     * @param {object} algodClient algosdk.Algodv2
+     * @param {number} appId       partial fill bridge application id
+     * @param {object} account     { addr, sk } that submits and pays fees
+     */
+    constructor(algodClient, appId, account) {
+        this.algosdk = require('algosdk');
+        this.algodClient = algodClient;
+        this.appId = Number(appId);
+        this.account = account;
+    }
+
+    /**
+     * hashlock / recipient / timelock / remaining_amount / total_filled /
+     * executed / partial_fills_enabled from global state
+     */
+    async state() {
+        const app = await this.algodClient.getApplicationByID(this.appId).do();
+        const state = {};
+        for (const { key, value } of app.params['global-state'] || []) {
+            const name = Buffer.from(key, 'base64').toString();
+            state[name] = value.type === 1 ? '0x' + Buffer.from(value.bytes, 'base64').toString('hex') : BigInt(value.uint);
+        }
+        return {
+            hashlock: state.hashlock,
+            recipient: state.recipient && encodeAlgorandAddress(state.recipient),
+            timelock: state.timelock ?? 0n,
+            remaining: state.remaining_amount ?? 0n,
+            totalFilled: state.total_filled ?? 0n,
+            executed: state.executed === 1n,
+            partialFillsEnabled: state.partial_fills_enabled === 1n
+        };
+    }
+
+    /**
+     * Settle `fills` in as few app calls as the limits allow, atomically
+     *
+     * @param fills             Array<{resolver, amount, secret}>
+     * @param resolverAccounts  { addr, sk } of every resolver other than the submitter
+     */
+    async settle(fills, resolverAccounts = []) {
+        const { hashlock, recipient, timelock, remaining, executed, partialFillsEnabled } = await this.state();
+        if (executed) throw new Error('partial fill HTLC is already fully executed');
+        if (!partialFillsEnabled) throw new Error('partial fills are not enabled on this HTLC');
+        if (BigInt(Math.floor(Date.now() / 1000)) >= timelock) throw new Error('partial fill HTLC has expired');
+        const plan = planBatchFills(fills, { submitter: this.account.addr, remaining, hashlock });
+
+        const keys = new Map(resolverAccounts.map(({ addr, sk }) => [addr, sk]));
+        const missing = plan.companions.filter(resolver => !keys.has(resolver));
+        if (missing.length) throw new Error(`no signing key for resolvers ${missing.join(', ')}`);
+
+        const suggestedParams = await this.algodClient.getTransactionParams().do();
+        const txns = [
+            ...plan.companions.map(resolver => this.algosdk.makePaymentTxnWithSuggestedParamsFromObject({
+                from: resolver,
+                to: resolver,
+                amount: 0,
+                suggestedParams: { ...suggestedParams, flatFee: true, fee: 0 }
+            })),
+            ...plan.calls.map(call => this.algosdk.makeApplicationNoOpTxnFromObject({
+                from: this.account.addr,
+                suggestedParams: { ...suggestedParams, flatFee: true, fee: call.fee },
+                appIndex: this.appId,
+                ...batchFillCall(call.fills, { signers: plan.signers, recipient })
+            }))
+        ];
+        if (txns.length > 1) this.algosdk.assignGroupID(txns);
+
+        const signed = txns.map((txn, i) => txn.signTxn(i < plan.companions.length ? keys.get(plan.companions[i]) : this.account.sk));
+        const { txId } = await this.algodClient.sendRawTransaction(signed).do();
+        const confirmed = await this.algosdk.waitForConfirmation(this.algodClient, txId, 4);
+        return { txId, round: confirmed['confirmed-round'], calls: plan.calls.length, total: plan.total, fee: plan.fee };
+    }
+}
+
+if (require.main === module) {
+    console.log('🧺 ALGORAND BATCH FILL');
+    console.log('======================');
+    console.log(`   Record: ${FILL_RECORD_LENGTH} bytes (signer index | amount | secret)`);
+    console.log(`   Per app call: ${MAX_BATCH_FILLS} fills paid to the recipient, fee 2 × ${MIN_TXN_FEE}`);
+    console.log(`   Per group: ${MAX_GROUP_SIZE} txns, one companion per extra resolver (fee pooled into the calls)`);
+}
+
+module.exports = {
+    BATCH_FILL_METHOD,
+    FILL_RECORD_LENGTH,
+    MAX_BATCH_FILLS,
+    MAX_GROUP_SIZE,
+    BatchFillClient,
+    encodeFillRecord,
+    decodeFillRecord,
+    batchFillCall,
+    planBatchFills
+};
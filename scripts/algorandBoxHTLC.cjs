@@ -0,0 +1,208 @@
+#!/usr/bin/env node
+
+/**
+ * 📦 ALGORAND BOX HTLC CLIENT
+ *
+ * Client side of contracts/algorand/AlgorandBoxHTLCBridge (one box per HTLC):
+ * ✅ Box key = 32-byte htlcId, so the Ethereum HTLC/order id is the Algorand id
+ * ✅ Box value codec (initiator | recipient | hashlock | amount | timelock)
+ * ✅ create = [payment, app call] group; claim/refund = one app call, fees pooled
+ * ✅ Reads one HTLC with a single box lookup, no account scan or opt-in
+ *
+ * Configuration (env):
+ *   ALGORAND_BOX_HTLC_APP_ID   application id of the deployed box bridge
+ */
+
+const { decodeAlgorandAddress, encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+
+const HTLC_ID_LENGTH = 32;
+const BOX_LAYOUT = {
+    initiator: { offset: 0, length: 32 },
+    recipient: { offset: 32, length: 32 },
+    hashlock: { offset: 64, length: 32 },
+    amount: { offset: 96, length: 8 },
+    timelock: { offset: 104, length: 8 }
+};
+const BOX_SIZE = 112;
+const BOX_MBR = 2500 + 400 * (HTLC_ID_LENGTH + BOX_SIZE); // microAlgos locked per live HTLC
+const APP_MIN_BALANCE = 100000; // app account must exist before its first box
+const MIN_TXN_FEE = 1000;
+const FEES = { create: MIN_TXN_FEE, claim: 3 * MIN_TXN_FEE, refund: 2 * MIN_TXN_FEE }; // app call incl. inner payments
+
+const toBytes = (hex, length, name) => {
+    const bytes = Buffer.from(String(hex).replace(/^0x/, ''), 'hex');
+    if (bytes.length !== length) throw new Error(`${name} must be ${length} bytes`);
+    return bytes;
+};
+
+const publicKeyOf = (address) => toBytes(decodeAlgorandAddress(address).publicKey, 32, 'address');
+
+function htlcBoxName(htlcId) {
+    return new Uint8Array(toBytes(htlcId, HTLC_ID_LENGTH, 'htlcId'));
+}
+
+function uint64(value) {
+    const bytes = Buffer.alloc(8);
+    bytes.writeBigUInt64BE(BigInt(value));
+    return bytes;
+}
+
+function encodeHtlcBox({ initiator, recipient, hashlock, amount, timelock }) {
+    return Buffer.concat([publicKeyOf(initiator), publicKeyOf(recipient), toBytes(hashlock, 32, 'hashlock'), uint64(amount), uint64(timelock)]);
+}
+
+function decodeHtlcBox(value) {
+    const box = Buffer.from(value);
+    if (box.length !== BOX_SIZE) throw new Error(`HTLC box must be ${BOX_SIZE} bytes, got ${box.length}`);
+    const field = (name) => box.subarray(BOX_LAYOUT[name].offset, BOX_LAYOUT[name].offset + BOX_LAYOUT[name].length);
+    return {
+        initiator: encodeAlgorandAddress('0x' + field('initiator').toString('hex')),
+        recipient: encodeAlgorandAddress('0x' + field('recipient').toString('hex')),
+        hashlock: '0x' + field('hashlock').toString('hex'),
+        amount: field('amount').readBigUInt64BE(),
+        timelock: Number(field('timelock').readBigUInt64BE())
+    };
+}
+
+/**
+ * App call arguments and box references (appIndex 0 = the called app)
+ */
+function createHtlcCall({ htlcId, hashlock, timelock, recipient }) {
+    return {
+        appArgs: [
+            new Uint8Array(Buffer.from('create_htlc')),
+            htlcBoxName(htlcId),
+            new Uint8Array(toBytes(hashlock, 32, 'hashlock')),
+            new Uint8Array(uint64(timelock)),
+            new Uint8Array(publicKeyOf(recipient))
+        ],
+        boxes: [{ appIndex: 0, name: htlcBoxName(htlcId) }]
+    };
+}
+
+function claimHtlcCall(htlcId, secret) {
+    return {
+        appArgs: [
+            new Uint8Array(Buffer.from('claim_htlc')),
+            htlcBoxName(htlcId),
+            new Uint8Array(toBytes(secret, 32, 'secret'))
+        ],
+        boxes: [{ appIndex: 0, name: htlcBoxName(htlcId) }]
+    };
+}
+
+function refundHtlcCall(htlcId) {
+    return {
+        appArgs: [new Uint8Array(Buffer.from('refund_htlc')), htlcBoxName(htlcId)],
+        boxes: [{ appIndex: 0, name: htlcBoxName(htlcId) }]
+    };
+}
+
+/**
+ * Payment that funds an HTLC: the locked amount plus the box deposit
+ */
+function fundingAmount(amount) {
+    return BigInt(amount) + BigInt(BOX_MBR);
+}
+
+class BoxHTLCClient {
+    /**
+     * @param {object} algodClient algosdk.Algodv2
+     * @param {number} appId       AlgorandBoxHTLCBridge application id
+     * @param {object} account     { addr, sk } that signs and pays fees
+     */
+    constructor(algodClient, appId, account) {
+        this.algosdk = require('algosdk');
+        this.algodClient = algodClient;
+        this.appId = Number(appId);
+        this.account = account;
+        this.appAddress = this.algosdk.getApplicationAddress(this.appId);
+    }
+
+    async params(fee) {
+        const suggestedParams = await this.algodClient.getTransactionParams().do();
+        return { ...suggestedParams, flatFee: true, fee };
+    }
+
+    async send(txns) {
+        const signed = txns.map(txn => txn.signTxn(this.account.sk));
+        const { txId } = await this.algodClient.sendRawTransaction(signed).do();
+        const confirmed = await this.algosdk.waitForConfirmation(this.algodClient, txId, 4);
+        return { txId, round: confirmed['confirmed-round'] };
+    }
+
+    async appCall(call, fee) {
+        const txn = this.algosdk.makeApplicationNoOpTxnFromObject({
+            from: this.account.addr,
+            suggestedParams: await this.params(fee),
+            appIndex: this.appId,
+            ...call
+        });
+        return this.send([txn]);
+    }
+
+    /**
+     * Lock `amount` microAlgos for `recipient` under `htlcId`
+     */
+    async create({ htlcId, hashlock, timelock, recipient, amount }) {
+        const payment = this.algosdk.makePaymentTxnWithSuggestedParamsFromObject({
+            from: this.account.addr,
+            to: this.appAddress,
+            amount: fundingAmount(amount),
+            suggestedParams: await this.params(MIN_TXN_FEE)
+        });
+        const call = this.algosdk.makeApplicationNoOpTxnFromObject({
+            from: this.account.addr,
+            suggestedParams: await this.params(FEES.create),
+            appIndex: this.appId,
+            ...createHtlcCall({ htlcId, hashlock, timelock, recipient })
+        });
+        this.algosdk.assignGroupID([payment, call]);
+        return this.send([payment, call]);
+    }
+
+    async claim(htlcId, secret) {
+        return this.appCall(claimHtlcCall(htlcId, secret), FEES.claim);
+    }
+
+    async refund(htlcId) {
+        return this.appCall(refundHtlcCall(htlcId), FEES.refund);
+    }
+
+    /**
+     * Live HTLC by id, or null once claimed/refunded (the box is deleted)
+     */
+    async get(htlcId) {
+        try {
+            const box = await this.algodClient.getApplicationBoxByName(this.appId, htlcBoxName(htlcId)).do();
+            return decodeHtlcBox(box.value);
+        } catch (error) {
+            if (error.status === 404 || /not found|no such box/i.test(error.message)) return null;
+            throw error;
+        }
+    }
+}
+
+if (require.main === module) {
+    console.log('📦 ALGORAND BOX HTLC');
+    console.log('====================');
+    console.log(`   Box: ${HTLC_ID_LENGTH}-byte key, ${BOX_SIZE}-byte value`);
+    console.log(`   Deposit per live HTLC: ${BOX_MBR} microAlgos (refunded on claim/refund)`);
+    console.log(`   Fees: create ${FEES.create + MIN_TXN_FEE}, claim ${FEES.claim}, refund ${FEES.refund} microAlgos`);
+}
+
+module.exports = {
+    BOX_LAYOUT,
+    BOX_SIZE,
+    BOX_MBR,
+    APP_MIN_BALANCE,
+    FEES,
+    BoxHTLCClient,
+    htlcBoxName,
+    encodeHtlcBox,
+    decodeHtlcBox,
+    createHtlcCall,
+    claimHtlcCall,
+    refundHtlcCall,
+    fundingAmount
+};
@@ -0,0 +1,290 @@
+#!/usr/bin/env node
+
+/**
+ * 🔏 ALGORAND LOGIC-SIGNATURE HTLC CLIENT
+ *
+ * Stateless HTLC mode (contracts/algorand/AlgorandHTLCLogicSig): one contract account per swap
+ * ✅ Hashlock, timeout round, recipient and refund address baked into the program
+ * ✅ create = one payment to the escrow address, note carries the template parameters
+ * ✅ claim/refund = one payment signed by the program, closing the whole balance
+ * ✅ No app state shared between swaps, no box deposit, payment-only fees
+ * ✅ Watcher helpers: recognize a funding payment, read the secret from a claim
+ *
+ * Logic signatures cannot read the clock, so the Ethereum timelock is converted
+ * to a timeout round from the latest block time and ROUND_SECONDS per round.
+ *
+ * Configuration (env):
+ *   ALGORAND_HTLC_MODE   'logicsig' for this mode, anything else keeps the app HTLC
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { decodeAlgorandAddress, encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+
+const TEMPLATE_PATH = path.join(__dirname, '../contracts/algorand/AlgorandHTLCLogicSig.teal');
+const TEMPLATE_PARAMS = ['TMPL_HASHLOCK', 'TMPL_RCV', 'TMPL_OWN', 'TMPL_TIMEOUT', 'TMPL_FEE'];
+const NOTE_PREFIX = 'htlc-lsig:';
+const MIN_TXN_FEE = 1000;
+const MIN_ACCOUNT_BALANCE = 100000; // a new escrow account must receive at least this much
+const ROUND_SECONDS = 2.8;
+
+const toHex32 = (value, name) => {
+    const hex = String(value).replace(/^0x/, '').toLowerCase();
+    if (!/^[0-9a-f]{64}$/.test(hex)) throw new Error(`${name} must be 32 bytes`);
+    return '0x' + hex;
+};
+
+const checkAddress = (address, name) => {
+    const { publicKey } = decodeAlgorandAddress(String(address));
+    if (encodeAlgorandAddress(publicKey) !== address) throw new Error(`${name} has a bad checksum: ${address}`);
+    return address;
+};
+
+const toBuffer = (value) => typeof value === 'string' ? Buffer.from(value, 'base64') : Buffer.from(value);
+
+/**
+ * Canonical swap parameters; everything the program and the spends depend on
+ */
+function normalizeParams({ hashlock, recipient, refundTo, timeoutRound, maxFee = MIN_TXN_FEE, htlcId }) {
+    const params = {
+        hashlock: toHex32(hashlock, 'hashlock'),
+        recipient: checkAddress(recipient, 'recipient'),
+        refundTo: checkAddress(refundTo, 'refundTo'),
+        timeoutRound: Number(timeoutRound),
+        maxFee: Number(maxFee)
+    };
+    if (params.recipient === params.refundTo) throw new Error('recipient and refundTo must differ');
+    if (!Number.isSafeInteger(params.timeoutRound) || params.timeoutRound <= 0) throw new Error('timeoutRound must be a positive round');
+    if (!Number.isSafeInteger(params.maxFee) || params.maxFee < MIN_TXN_FEE) throw new Error(`maxFee must be at least ${MIN_TXN_FEE}`);
+    if (htlcId !== undefined) params.htlcId = toHex32(htlcId, 'htlcId');
+    return params;
+}
+
+/**
+ * Per-swap TEAL: the template with every TMPL_ placeholder replaced
+ */
+function fillHtlcTemplate(swap, template = fs.readFileSync(TEMPLATE_PATH, 'utf8')) {
+    const params = normalizeParams(swap);
+    const values = {
+        TMPL_HASHLOCK: params.hashlock,
+        TMPL_RCV: params.recipient,
+        TMPL_OWN: params.refundTo,
+        TMPL_TIMEOUT: String(params.timeoutRound),
+        TMPL_FEE: String(params.maxFee)
+    };
+    return template.replace(/\bTMPL_[A-Z]+\b/g, (name) => {
+        if (!(name in values)) throw new Error(`Unknown template parameter ${name}`);
+        return values[name];
+    });
+}
+
+/**
+ * Estimated round for `timelock` (unix seconds), from a recent round and its block time
+ */
+function timelockToRound(timelock, { round, timestamp }, roundSeconds = ROUND_SECONDS) {
+    const seconds = Number(timelock) - Number(timestamp);
+    if (seconds <= 0) throw new Error('timelock already passed');
+    return Number(round) + Math.floor(seconds / roundSeconds);
+}
+
+/**
+ * Funding payment note: lets a watcher rebuild the program and check the escrow address
+ */
+function encodeHtlcNote(swap) {
+    return new Uint8Array(Buffer.from(NOTE_PREFIX + JSON.stringify(normalizeParams(swap))));
+}
+
+function decodeHtlcNote(note) {
+    if (!note) return null;
+    const text = toBuffer(note).toString('utf8');
+    if (!text.startsWith(NOTE_PREFIX)) return null;
+    try {
+        return normalizeParams(JSON.parse(text.slice(NOTE_PREFIX.length)));
+    } catch {
+        return null;
+    }
+}
+
+/**
+ * Payment fields of a confirmed transaction, algod block (txn.snd...) or indexer (sender...) shape
+ */
+function paymentFields(txn) {
+    if (txn.txn) {
+        const body = txn.txn;
+        const address = (value) => value ? encodeAlgorandAddress('0x' + Buffer.from(value).toString('hex')) : null;
+        return {
+            sender: address(body.snd),
+            receiver: address(body.rcv),
+            closeTo: address(body.close),
+            amount: Number(body.amt || 0),
+            note: body.note,
+            args: (txn.lsig && txn.lsig.arg) || []
+        };
+    }
+    const payment = txn['payment-transaction'] || {};
+    const logicsig = txn.signature && txn.signature.logicsig;
+    return {
+        sender: txn.sender,
+        receiver: payment.receiver || null,
+        closeTo: payment['close-remainder-to'] || null,
+        amount: Number(payment.amount || 0),
+        note: txn.note,
+        args: (logicsig && logicsig.args) || []
+    };
+}
+
+/**
+ * A close-out signed by the escrow of `swap` → { type: 'claim', secret } | { type: 'refund' }, else null
+ */
+function classifyLogicSigSpend(txn, swap) {
+    const params = normalizeParams(swap);
+    const fields = paymentFields(txn);
+    if (fields.closeTo === params.recipient && fields.args.length > 0) {
+        const secret = toBuffer(fields.args[0]);
+        const hash = '0x' + crypto.createHash('sha256').update(secret).digest('hex');
+        if (hash === params.hashlock) return { type: 'claim', secret: '0x' + secret.toString('hex') };
+    }
+    if (fields.closeTo === params.refundTo) return { type: 'refund' };
+    return null;
+}
+
+/**
+ * Validity window of a spend: claims must end before the timeout, refunds start at it
+ */
+function spendWindow(type, { firstRound, lastRound }, timeoutRound) {
+    if (type === 'claim') {
+        const last = Math.min(lastRound, timeoutRound - 1);
+        if (firstRound > last) throw new Error(`HTLC expired at round ${timeoutRound}`);
+        return { firstRound, lastRound: last };
+    }
+    if (firstRound < timeoutRound) throw new Error(`Refund opens at round ${timeoutRound}, now ${firstRound}`);
+    return { firstRound, lastRound };
+}
+
+class LogicSigHTLCClient {
+    /**
+     * @param {object} algodClient algosdk.Algodv2 (also compiles the per-swap TEAL)
+     * @param {object} account     { addr, sk } that funds HTLCs and submits spends
+     */
+    constructor(algodClient, account) {
+        this.algosdk = require('algosdk');
+        this.algodClient = algodClient;
+        this.account = account;
+        this.programs = new Map(); // TEAL source → { program, address }
+    }
+
+    /**
+     * Compiled program and escrow address of one swap
+     */
+    async build(swap) {
+        const teal = fillHtlcTemplate(swap);
+        if (!this.programs.has(teal)) {
+            const compiled = await this.algodClient.compile(teal).do();
+            this.programs.set(teal, { program: new Uint8Array(Buffer.from(compiled.result, 'base64')), address: compiled.hash });
+        }
+        return this.programs.get(teal);
+    }
+
+    async timeoutRoundFor(timelock) {
+        const status = await this.algodClient.status().do();
+        const round = status['last-round'];
+        const block = await this.algodClient.block(round).do();
+        return timelockToRound(timelock, { round, timestamp: block.block.ts });
+    }
+
+    /**
+     * Fund a new escrow: `amount` reaches the recipient, the extra maxFee pays the close-out
+     */
+    async create({ htlcId, hashlock, timelock, recipient, amount, refundTo = this.account.addr }) {
+        const swap = normalizeParams({ htlcId, hashlock, recipient, refundTo, timeoutRound: await this.timeoutRoundFor(timelock) });
+        const funding = BigInt(amount) + BigInt(swap.maxFee);
+        if (funding < BigInt(MIN_ACCOUNT_BALANCE)) throw new Error(`HTLC must lock at least ${MIN_ACCOUNT_BALANCE - swap.maxFee} microAlgos`);
+
+        const { address } = await this.build(swap);
+        const suggestedParams = await this.algodClient.getTransactionParams().do();
+        const payment = this.algosdk.makePaymentTxnWithSuggestedParamsFromObject({
+            from: this.account.addr,
+            to: address,
+            amount: funding,
+            note: encodeHtlcNote(swap),
+            suggestedParams
+        });
+        const { txId } = await this.algodClient.sendRawTransaction(payment.signTxn(this.account.sk)).do();
+        const confirmed = await this.algosdk.waitForConfirmation(this.algodClient, txId, 4);
+        return { txId, round: confirmed['confirmed-round'], address, swap };
+    }
+
+    async spend(swap, type, args) {
+        const params = normalizeParams(swap);
+        const { program } = await this.build(params);
+        const lsig = new this.algosdk.LogicSigAccount(program, args);
+        const suggestedParams = await this.algodClient.getTransactionParams().do();
+        const to = type === 'claim' ? params.recipient : params.refundTo;
+        const txn = this.algosdk.makePaymentTxnWithSuggestedParamsFromObject({
+            from: lsig.address(),
+            to,
+            amount: 0,
+            closeRemainderTo: to,
+            suggestedParams: { ...suggestedParams, ...spendWindow(type, suggestedParams, params.timeoutRound), flatFee: true, fee: MIN_TXN_FEE }
+        });
+        const signed = this.algosdk.signLogicSigTransactionObject(txn, lsig);
+        const { txId } = await this.algodClient.sendRawTransaction(signed.blob).do();
+        const confirmed = await this.algosdk.waitForConfirmation(this.algodClient, txId, 4);
+        return { txId, round: confirmed['confirmed-round'] };
+    }
+
+    async claim(swap, secret) {
+        return this.spend(swap, 'claim', [new Uint8Array(Buffer.from(toHex32(secret, 'secret').slice(2), 'hex'))]);
+    }
+
+    async refund(swap) {
+        return this.spend(swap, 'refund', []);
+    }
+
+    /**
+     * Escrow balance in microAlgos, or null once claimed/refunded (the account is closed)
+     */
+    async get(swap) {
+        const { address } = await this.build(swap);
+        const info = await this.algodClient.accountInformation(address).do();
+        return Number(info.amount) > 0 ? BigInt(info.amount) : null;
+    }
+
+    /**
+     * Watcher check: a payment whose note describes a swap and whose receiver is that swap's escrow
+     */
+    async recognizeFunding(txn) {
+        const fields = paymentFields(txn);
+        const swap = decodeHtlcNote(fields.note);
+        if (!swap) return null;
+        const { address } = await this.build(swap);
+        if (fields.receiver !== address) return null;
+        return { swap, address, amount: BigInt(fields.amount) - BigInt(swap.maxFee) };
+    }
+}
+
+if (require.main === module) {
+    console.log('🔏 ALGORAND LOGIC-SIGNATURE HTLC');
+    console.log('================================');
+    console.log(`   Template: ${path.relative(process.cwd(), TEMPLATE_PATH)} (${TEMPLATE_PARAMS.join(', ')})`);
+    console.log(`   Fees: create ${MIN_TXN_FEE}, claim ${MIN_TXN_FEE}, refund ${MIN_TXN_FEE} microAlgos, no deposit`);
+    console.log(`   Timeout: unix timelock → round, estimated at ${ROUND_SECONDS}s per round`);
+}
+
+module.exports = {
+    TEMPLATE_PATH,
+    TEMPLATE_PARAMS,
+    NOTE_PREFIX,
+    MIN_ACCOUNT_BALANCE,
+    ROUND_SECONDS,
+    LogicSigHTLCClient,
+    normalizeParams,
+    fillHtlcTemplate,
+    timelockToRound,
+    encodeHtlcNote,
+    decodeHtlcNote,
+    paymentFields,
+    classifyLogicSigSpend,
+    spendWindow
+};
@@ -9,6 +9,7 @@
 
 const { ethers } = require('ethers');
 const crypto = require('crypto');
+const { SettlementBatcher } = require('./settlementBatcher.cjs');
 
 class AlgorandRelayerService {
     constructor() {
@@ -38,6 +39,8 @@ class AlgorandRelayerService {
             'function placeBid(bytes32 _auctionId, uint256 _gasPrice) external',
             'function executeHTLCWithSecret(bytes32 _htlcId, bytes32 _secret, bytes32 _auctionId) external',
             'function refundHTLC(bytes32 _htlcId) external',
+            'function batchExecuteHTLCWithSecret(bytes32[] _htlcIds, bytes32[] _secrets, bytes32[] _auctionIds) external returns (bool[] results)',
+            'function batchRefundHTLC(bytes32[] _htlcIds) external returns (bool[] results)',
             'function getHTLC(bytes32 _htlcId) external view returns (tuple(address initiator, address recipient, address token, uint256 amount, bytes32 hashlock, uint256 timelock, uint256 algorandChainId, string algorandAddress, string algorandToken, uint256 algorandAmount, bool withdrawn, bool refunded, bool executed, uint256 createdAt))',
             'function getDutchAuction(bytes32 _auctionId) external view returns (tuple(bytes32 auctionId, bytes32 htlcId, uint256 startPrice, uint256 currentPrice, uint256 startTime, uint256 endTime, address winningRelayer, uint256 winningGasPrice, bool filled, bool expired))',
             'function getCurrentAuctionPrice(bytes32 _auctionId) external view returns (uint256)',
@@ -48,10 +51,39 @@ class AlgorandRelayerService {
             'event AuctionWon(bytes32 indexed auctionId, address indexed relayer, uint256 gasPrice)',
             'event SecretRevealed(bytes32 indexed htlcId, bytes32 secret)',
             'event HTLCWithdrawn(bytes32 indexed htlcId, address recipient)',
-            'event HTLCRefunded(bytes32 indexed htlcId, address initiator)'
+            'event HTLCRefunded(bytes32 indexed htlcId, address initiator)',
+            'event HTLCBatchResult(bytes32 indexed htlcId, bool success, bytes4 reason)',
+            'error HTLCNotFound()',
+            'error HTLCAlreadyExecuted()',
+            'error HTLCAlreadyRefunded()',
+            'error HTLCExpired()',
+            'error HTLCNotExpired()',
+            'error InvalidSecret()',
+            'error NotAuctionWinner()',
+            'error AuctionMismatch()',
+            'error NotAuthorizedRelayer()',
+            'error AuctionNotFound()',
+            'error AuctionAlreadyFilled()',
+            'error AuctionEnded()',
+            'error GasPriceTooLow()',
+            'error GasPriceTooHigh()'
         ];
         
         this.htlcBridge = null;
+        
+        // Claims and refunds are settled in batches (one transaction per backlog chunk)
+        this.executeBatcher = new SettlementBatcher({
+            name: 'execute',
+            submit: (items) => this.submitBatch('batchExecuteHTLCWithSecret', [
+                items.map(item => item.id),
+                items.map(item => item.args.secret),
+                items.map(item => item.args.auctionId)
+            ])
+        });
+        this.refundBatcher = new SettlementBatcher({
+            name: 'refund',
+            submit: (items) => this.submitBatch('batchRefundHTLC', [items.map(item => item.id)])
+        });
     }
 
     async initialize() {
@@ -281,12 +313,15 @@ class AlgorandRelayerService {
      */
     async executeHTLCWithSecret(htlcId, secret, auctionId) {
         try {
-            console.log(`🔓 Executing HTLC with secret: ${htlcId}`);
+            console.log(`🔓 Queueing HTLC execution with secret: ${htlcId}`);
             
-            const tx = await this.htlcBridge.executeHTLCWithSecret(htlcId, secret, auctionId);
-            await tx.wait();
+            const result = await this.executeBatcher.add(htlcId, { secret, auctionId });
+            if (!result.success) {
+                console.error(`❌ HTLC ${htlcId} skipped: ${result.reason}`);
+                return;
+            }
             
-            console.log(`✅ HTLC executed successfully: ${tx.hash}`);
+            console.log(`✅ HTLC executed successfully: ${result.txHash}`);
             console.log(`💰 Funds transferred to recipient`);
             console.log(`💸 Relayer fee earned`);
             
@@ -299,6 +334,31 @@ class AlgorandRelayerService {
         }
     }
 
+    /**
+     * Send one batch call and map its HTLCBatchResult events back to the items
+     */
+    async submitBatch(method, args) {
+        const tx = await this.htlcBridge[method](...args);
+        const receipt = await tx.wait();
+        if (receipt.status !== 1) throw new Error(`${method} reverted: ${tx.hash}`);
+        
+        console.log(`📦 ${method}: ${args[0].length} item(s) in ${tx.hash}`);
+        return {
+            results: SettlementBatcher.resultsFromReceipt(this.htlcBridge.interface, receipt, 'HTLCBatchResult'),
+            txHash: tx.hash
+        };
+    }
+    
+    /**
+     * Refund expired HTLCs (e.g. the backlog left after an outage) in batches
+     */
+    async refundExpiredHTLCs(htlcIds) {
+        const results = await Promise.all(htlcIds.map(htlcId => this.refundBatcher.add(htlcId)));
+        const refunded = results.filter(result => result.success).length;
+        console.log(`💰 Refunded ${refunded}/${htlcIds.length} expired HTLCs`);
+        return results;
+    }
+
     /**
      * Step 7: Monitor for refunds
      */
@@ -0,0 +1,192 @@
+#!/usr/bin/env node
+
+/**
+ * 📈 PIECEWISE-LINEAR AUCTION CURVE
+ *
+ * Off-chain twin of contracts/AuctionCurveLib.sol (1inch Fusion AuctionCalculator model):
+ * ✅ encode/decode of the packed one-word curve (gas bump, initial bump, up to 4 points)
+ * ✅ BigInt evaluation with the contract's integer arithmetic, bit for bit
+ * ✅ Same validation rules as AuctionCurveLib.validationError
+ * ✅ Conversion from 1inch auctionDetails bytes (SDK / CrossChainTestLib format)
+ * ✅ Bisection for the first second the price reaches a reservation (curves never rise)
+ *
+ * Curves are set with EnhancedCrossChainResolver.setAuctionCurve,
+ * AlgorandHTLCBridge.startDutchAuctionWithCurve and Enhanced1inchStyleBridge.startCurveAuction.
+ */
+
+const BASE_POINTS = 10_000_000n;
+const MAX_POINTS = 4;
+
+const toBigInt = (value) => typeof value === 'bigint' ? value : BigInt(value);
+const field = (curve, shift, bits) => (curve >> BigInt(shift)) & ((1n << BigInt(bits)) - 1n);
+
+function fits(value, bits, name) {
+    const v = toBigInt(value);
+    if (v < 0n || v >= 1n << BigInt(bits)) throw new Error(`${name} does not fit in uint${bits}`);
+    return v;
+}
+
+/**
+ * @param {object} spec { gasBumpEstimate, gasPriceEstimate, initialRateBump, points: [{ rateBump, timeDelta }] }
+ * @returns {bigint} packed curve word
+ */
+function encodeCurve({ gasBumpEstimate = 0, gasPriceEstimate = 0, initialRateBump, points = [] }) {
+    if (points.length > MAX_POINTS) throw new Error(`At most ${MAX_POINTS} curve points`);
+    let curve = fits(gasBumpEstimate, 24, 'gasBumpEstimate') << 232n
+        | fits(gasPriceEstimate, 32, 'gasPriceEstimate') << 200n
+        | fits(initialRateBump, 24, 'initialRateBump') << 176n
+        | BigInt(points.length) << 168n;
+    points.forEach((point, i) => {
+        const packed = fits(point.rateBump, 24, 'rateBump') << 16n | fits(point.timeDelta, 16, 'timeDelta');
+        curve |= packed << BigInt(128 - 40 * i);
+    });
+    return curve;
+}
+
+function decodeCurve(value) {
+    const curve = toBigInt(value);
+    const count = Number(field(curve, 168, 8));
+    const points = [];
+    for (let i = 0; i < Math.min(count, MAX_POINTS); i++) {
+        const point = field(curve, 128 - 40 * i, 40);
+        points.push({ rateBump: point >> 16n, timeDelta: point & 0xffffn });
+    }
+    return {
+        gasBumpEstimate: field(curve, 232, 24),
+        gasPriceEstimate: field(curve, 200, 32),
+        initialRateBump: field(curve, 176, 24),
+        pointsCount: count,
+        points
+    };
+}
+
+/**
+ * AuctionCurveLib.validationError: '' when usable for an auction of `duration` seconds.
+ */
+function validationError(value, duration) {
+    const curve = toBigInt(value);
+    const { gasBumpEstimate, gasPriceEstimate, initialRateBump, pointsCount, points } = decodeCurve(curve);
+    if (pointsCount > MAX_POINTS) return 'Too many curve points';
+    if ((curve & ((1n << BigInt(168 - 40 * pointsCount)) - 1n)) !== 0n) return 'Unused curve bits set';
+    if (gasBumpEstimate !== 0n && gasPriceEstimate === 0n) return 'Missing gas price estimate';
+
+    let previousBump = initialRateBump;
+    let elapsed = 0n;
+    for (const point of points) {
+        if (point.rateBump > previousBump) return 'Curve must not increase';
+        elapsed += point.timeDelta;
+        previousBump = point.rateBump;
+    }
+    if (elapsed >= toBigInt(duration)) return 'Curve points exceed duration';
+    return '';
+}
+
+function auctionBump(value, startTime, finishTime, timestamp) {
+    const { initialRateBump, points } = decodeCurve(value);
+    const start = toBigInt(startTime);
+    const finish = toBigInt(finishTime);
+    const t = toBigInt(timestamp);
+    if (t <= start) return initialRateBump;
+    if (t >= finish) return 0n;
+
+    let currentRateBump = initialRateBump;
+    let currentPointTime = start;
+    for (const { rateBump, timeDelta } of points) {
+        const nextPointTime = currentPointTime + timeDelta;
+        if (t <= nextPointTime) {
+            return ((t - currentPointTime) * rateBump + (nextPointTime - t) * currentRateBump)
+                / (nextPointTime - currentPointTime);
+        }
+        currentRateBump = rateBump;
+        currentPointTime = nextPointTime;
+    }
+    return (finish - t) * currentRateBump / (finish - currentPointTime);
+}
+
+function rateBump(value, startTime, finishTime, timestamp, baseFee = 0n) {
+    const { gasBumpEstimate, gasPriceEstimate } = decodeCurve(value);
+    const bump = auctionBump(value, startTime, finishTime, timestamp);
+    const gasBump = gasPriceEstimate === 0n ? 0n : gasBumpEstimate * toBigInt(baseFee) / gasPriceEstimate / 1_000_000n;
+    return bump > gasBump ? bump - gasBump : 0n;
+}
+
+function priceAt(value, basePrice, startTime, finishTime, timestamp, baseFee = 0n) {
+    return toBigInt(basePrice) * (BASE_POINTS + rateBump(value, startTime, finishTime, timestamp, baseFee)) / BASE_POINTS;
+}
+
+/**
+ * First timestamp in [startTime, finishTime] with price <= reservation, or null.
+ * Valid curves never rise, so the price is monotone and bisection is exact.
+ */
+function firstTimeAtOrBelow(value, basePrice, startTime, finishTime, reservation, baseFee = 0n) {
+    const r = toBigInt(reservation);
+    let lo = toBigInt(startTime);
+    let hi = toBigInt(finishTime);
+    const price = (t) => priceAt(value, basePrice, startTime, finishTime, t, baseFee);
+    if (price(hi) > r) return null;
+    while (lo < hi) {
+        const mid = (lo + hi) / 2n;
+        if (price(mid) <= r) hi = mid;
+        else lo = mid + 1n;
+    }
+    return lo;
+}
+
+/**
+ * 1inch auctionDetails bytes → { curve, startTime, duration }.
+ * Layout: gasBumpEstimate u24 | gasPriceEstimate u32 | startTime u32 | duration u24 |
+ *         initialRateBump u24 | (rateBump u24 | timeDelta u16)*
+ */
+function fromAuctionDetails(hex) {
+    const bytes = Buffer.from(String(hex).replace(/^0x/, ''), 'hex');
+    if (bytes.length < 17 || (bytes.length - 17) % 5 !== 0) throw new Error('Malformed auctionDetails');
+    const read = (offset, length) => BigInt('0x' + (bytes.subarray(offset, offset + length).toString('hex') || '0'));
+    const points = [];
+    for (let offset = 17; offset < bytes.length; offset += 5) {
+        points.push({ rateBump: read(offset, 3), timeDelta: read(offset + 3, 2) });
+    }
+    return {
+        curve: encodeCurve({
+            gasBumpEstimate: read(0, 3),
+            gasPriceEstimate: read(3, 4),
+            initialRateBump: read(14, 3),
+            points
+        }),
+        startTime: read(7, 4),
+        duration: read(11, 3)
+    };
+}
+
+const toHex = (curve) => '0x' + toBigInt(curve).toString(16).padStart(64, '0');
+
+if (require.main === module) {
+    // Offline demo: +5% → +2% after 60s → +0.5% after 120s → 0 at 180s, over a base price of 900
+    const curve = encodeCurve({
+        initialRateBump: 500_000,
+        points: [{ rateBump: 200_000, timeDelta: 60 }, { rateBump: 50_000, timeDelta: 60 }]
+    });
+    const start = 1_700_000_000n;
+    const finish = start + 180n;
+
+    console.log('📈 AUCTION CURVE (offline)');
+    console.log('==========================');
+    console.log(`📦 Packed: ${toHex(curve)}`);
+    for (const dt of [0n, 30n, 60n, 90n, 120n, 150n, 180n]) {
+        console.log(`   +${dt}s: ${priceAt(curve, 900_000_000n, start, finish, start + dt)}`);
+    }
+    console.log(`🎯 First second at or below 910M: +${firstTimeAtOrBelow(curve, 900_000_000n, start, finish, 910_000_000n) - start}s`);
+}
+
+module.exports = {
+    BASE_POINTS,
+    MAX_POINTS,
+    encodeCurve,
+    decodeCurve,
+    validationError,
+    auctionBump,
+    rateBump,
+    priceAt,
+    firstTimeAtOrBelow,
+    fromAuctionDetails,
+    toHex
+};
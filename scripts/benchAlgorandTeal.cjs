@@ -0,0 +1,350 @@
+#!/usr/bin/env node
+
+/**
+ * 📏 ALGORAND TEAL COST BENCHMARK
+ *
+ * Runs every method of the Algorand HTLC programs through the offline TEAL
+ * interpreter (tealInterpreter.cjs) and reports, per method:
+ * ✅ Opcode cost against the 700 per-call budget (and app calls needed to pool it)
+ * ✅ Minimum fee, inner transactions included
+ * ✅ Logs and the global/local/box state delta
+ * ✅ Comparison with the committed snapshot: cost, fee, outcome or state
+ *    changes fail the run until the snapshot is updated on purpose
+ *
+ * PyTeal sources are compiled when pyteal is installed and skipped otherwise.
+ *
+ * Run:    node scripts/benchAlgorandTeal.cjs
+ * Update: node scripts/benchAlgorandTeal.cjs --update
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { execFileSync } = require('child_process');
+const { encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const { APP_BUDGET, LOGIC_SIG_BUDGET, TealMachine, assembleTeal, createLedger, addressBytes, applicationAddress, callFee } = require('./tealInterpreter.cjs');
+const { fillHtlcTemplate } = require('./algorandLogicSigHTLC.cjs');
+const { encodeFillRecord } = require('./algorandBatchFill.cjs');
+
+const ROOT = path.join(__dirname, '..');
+const ALGORAND_DIR = path.join(ROOT, 'contracts/algorand');
+const SNAPSHOT_PATH = path.join(__dirname, 'snapshots/algorandTealCosts.json');
+
+// Deterministic actors and swap parameters
+const account = (byte) => encodeAlgorandAddress('0x' + byte.repeat(32));
+const CREATOR = account('c1');
+const ALICE = account('a1');   // initiator / maker
+const BOB = account('b0');     // recipient
+const RESOLVER = account('d5');
+const RESOLVER_2 = account('e6');
+const APP_ID = 1001;
+const NOW = 1767225600;
+const AMOUNT = 2500000;
+const SECRET = Buffer.alloc(32, 0x5e);
+const HASHLOCK = crypto.createHash('sha256').update(SECRET).digest();
+const HTLC_ID = Buffer.alloc(32, 0xab);
+const TIMELOCK = NOW + 7200;
+const LATE = TIMELOCK + 1;
+
+const uint64 = (value) => {
+    const word = Buffer.alloc(8);
+    word.writeBigUInt64BE(BigInt(value));
+    return word;
+};
+const args = (...items) => items.map(item => typeof item === 'string' ? Buffer.from(item) : typeof item === 'number' ? uint64(item) : item);
+
+const deploy = { label: 'deploy', sender: CREATOR, create: true, args: args('init') };
+const optIn = (sender) => ({ label: 'opt_in', sender, onCompletion: 'OptIn', args: args('opt_in') });
+
+/**
+ * Local-state HTLC apps (one HTLC per opted-in account).
+ * createArgs: arguments after the method name; claim/refund/status/update: method aliases
+ */
+function localStateRuns({ create, createArgs, claim, refund, status = [], update = [], optInArgs = true }) {
+    const setup = (createMethod) => [
+        { ...deploy, record: false },
+        { ...optIn(ALICE), args: optInArgs ? args('opt_in') : [], record: false },
+        { label: createMethod, sender: ALICE, args: args(createMethod, ...createArgs), record: false }
+    ];
+    const runs = [[
+        { ...deploy, args: optInArgs ? deploy.args : [] },
+        { ...optIn(ALICE), args: optInArgs ? args('opt_in') : [] },
+        { label: create[0], sender: ALICE, args: args(create[0], ...createArgs) }
+    ]];
+    for (const method of create.slice(1)) {
+        runs.push([...setup(create[0]).slice(0, 2), { label: method, sender: ALICE, args: args(method, ...createArgs) }]);
+    }
+    for (const method of claim) runs.push([...setup(create[0]), { label: method, sender: ALICE, args: args(method, HTLC_ID, SECRET) }]);
+    for (const method of refund) runs.push([...setup(create[0]), { label: method, sender: ALICE, time: LATE, args: args(method, HTLC_ID) }]);
+    for (const method of status) runs.push([...setup(create[0]), { label: method, sender: ALICE, args: args(method, HTLC_ID) }]);
+    for (const method of update) runs.push([{ ...deploy, record: false }, { label: method, sender: CREATOR, args: args(method, 'MaxTimelock', uint64(172800)) }]);
+    return runs;
+}
+
+const legacyCreateArgs = [HTLC_ID, addressBytes(ALICE), addressBytes(BOB), AMOUNT, HASHLOCK, TIMELOCK, '0x0000000000000000000000000000000000000000'];
+
+function boxRuns() {
+    const funding = { TypeEnum: 'pay', Sender: ALICE, Receiver: null, Amount: AMOUNT + 60100 };
+    const create = { label: 'create_htlc', sender: ALICE, groupIndex: 1, group: [funding], args: args('create_htlc', HTLC_ID, HASHLOCK, TIMELOCK, addressBytes(BOB)) };
+    return [
+        [{ ...deploy, args: [] }, create, { label: 'claim_htlc', sender: RESOLVER, args: args('claim_htlc', HTLC_ID, SECRET) }],
+        [{ ...deploy, args: [], record: false }, { ...create, record: false }, { label: 'refund_htlc', sender: RESOLVER, time: LATE, args: args('refund_htlc', HTLC_ID) }]
+    ];
+}
+
+function partialFillRuns({ deposit }) {
+    // RESOLVER sends the call (group index 1); RESOLVER_2 signs a companion payment at index 0
+    const companion = { TypeEnum: 'pay', Sender: RESOLVER_2, Receiver: RESOLVER_2, Amount: 0, Fee: 0 };
+    const batchFills = [1, 0, 1, 0].map(signer => encodeFillRecord({ signer, amount: AMOUNT / 5, secret: SECRET.toString('hex') }));
+    const create = { label: 'create_htlc', sender: ALICE, args: args('create_htlc', HASHLOCK, TIMELOCK, addressBytes(BOB), addressBytes(ALICE), 1) };
+    const setup = [{ ...deploy, args: [], record: false }, { ...create, record: false }];
+    if (deposit) setup.push({ label: 'deposit', sender: ALICE, args: args('deposit', AMOUNT), record: false });
+    return [
+        [{ ...deploy, args: [] }, create, ...(deposit ? [{ label: 'deposit', sender: ALICE, args: args('deposit', AMOUNT) }] : [])],
+        [...setup, { label: 'partial_fill', sender: RESOLVER, args: args('partial_fill', AMOUNT / 5, SECRET) }],
+        [...setup, { label: 'batch_fill', sender: RESOLVER, groupIndex: 1, group: [companion], args: args('batch_fill', ...batchFills) }],
+        [...setup, { label: 'public_claim', sender: RESOLVER, args: args('public_claim', SECRET) }],
+        [...setup, { label: 'withdraw', sender: ALICE, args: args('withdraw') }]
+    ];
+}
+
+function logicSigRuns() {
+    const spend = (to, extra) => ({ mode: 'signature', sender: null, txn: { TypeEnum: 'pay', Amount: 0, Receiver: to, CloseRemainderTo: to, Fee: 1000, ...extra } });
+    return [
+        [{ label: 'claim', ...spend(BOB, { FirstValid: 1000, LastValid: 1999 }), lsigArgs: [SECRET] }],
+        [{ label: 'refund', ...spend(ALICE, { FirstValid: 2000, LastValid: 3000 }) }]
+    ];
+}
+
+const PROGRAMS = [
+    {
+        name: 'AlgorandHTLCBridge',
+        teal: 'AlgorandHTLCBridge.teal',
+        runs: () => localStateRuns({ create: ['create_htlc'], createArgs: legacyCreateArgs, claim: ['withdraw'], refund: ['refund'], status: ['status'], update: ['update'] })
+    },
+    {
+        name: 'AlgorandHTLCBridgeFixed',
+        teal: 'contracts/algorand/AlgorandHTLCBridgeFixed.teal',
+        runs: () => localStateRuns({
+            create: ['create_htlc', 'create'], createArgs: legacyCreateArgs,
+            claim: ['withdraw', 'withdraw_htlc', 'claim_htlc'], refund: ['refund', 'refund_htlc'],
+            status: ['status', 'get_htlc_status'], update: ['update', 'update_contract']
+        })
+    },
+    {
+        name: 'AlgorandHTLCBridge_EthToAlgo',
+        teal: 'contracts/algorand/AlgorandHTLCBridge_EthToAlgo.teal',
+        runs: () => localStateRuns({ create: ['create_htlc'], createArgs: [HTLC_ID, addressBytes(BOB), AMOUNT, HASHLOCK, TIMELOCK], claim: ['claim_htlc'], refund: ['refund_htlc'], optInArgs: false })
+    },
+    {
+        name: 'AlgorandHTLCBridge_EthToAlgo_Minimal',
+        teal: 'contracts/algorand/AlgorandHTLCBridge_EthToAlgo_Minimal.teal',
+        // No create method: the HTLC is written into local state by the setup
+        local: { [ALICE]: { HtlcId: HTLC_ID, Hashlock: HASHLOCK, Recipient: addressBytes(BOB), Amount: AMOUNT, Withdrawn: 0 } },
+        runs: () => [[{ label: 'claim_htlc', sender: ALICE, args: args('claim_htlc', HTLC_ID, SECRET) }]]
+    },
+    { name: 'AlgorandBoxHTLCBridge', teal: 'contracts/algorand/AlgorandBoxHTLCBridge.teal', runs: boxRuns },
+    {
+        name: 'AlgorandHTLCLogicSig',
+        teal: 'contracts/algorand/AlgorandHTLCLogicSig.teal',
+        template: { hashlock: '0x' + HASHLOCK.toString('hex'), recipient: BOB, refundTo: ALICE, timeoutRound: 2000, maxFee: 1000 },
+        runs: logicSigRuns
+    },
+    {
+        name: 'AlgorandHTLCBridge.py',
+        pyteal: { module: 'AlgorandHTLCBridge', expr: 'compileTeal(htlc_bridge_contract(), mode=Mode.Application, version=6)' },
+        runs: () => localStateRuns({ create: ['create_htlc'], createArgs: legacyCreateArgs, claim: ['withdraw'], refund: ['refund'], status: ['status'], update: ['update'] })
+    },
+    { name: 'AlgorandBoxHTLCBridge.py', pyteal: { module: 'AlgorandBoxHTLCBridge', expr: 'compile_box_htlc_bridge()[0]' }, runs: boxRuns },
+    {
+        name: 'AlgorandPartialFillBridge.py',
+        pyteal: { module: 'AlgorandPartialFillBridge', expr: 'compileTeal(AlgorandPartialFillBridge(None, None, None).get_approval_program(), mode=Mode.Application, version=6)' },
+        runs: () => partialFillRuns({ deposit: false })
+    },
+    {
+        name: 'FixedAlgorandPartialFillBridge.py',
+        pyteal: { module: 'FixedAlgorandPartialFillBridge', expr: 'compile_partial_fill_bridge()[0]' },
+        runs: () => partialFillRuns({ deposit: true })
+    }
+];
+
+/**
+ * TEAL source of a program, or { skipped } when it cannot be produced here
+ */
+function loadSource(program) {
+    if (program.teal) {
+        const source = fs.readFileSync(path.join(ROOT, program.teal), 'utf8');
+        return { source: program.template ? fillHtlcTemplate(program.template, source) : source };
+    }
+    const script = [
+        'import sys',
+        `sys.path.insert(0, ${JSON.stringify(ALGORAND_DIR)})`,
+        'from pyteal import *',
+        `from ${program.pyteal.module} import *`,
+        `print(${program.pyteal.expr})`
+    ].join('\n');
+    try {
+        const env = { ...process.env, PYTHONDONTWRITEBYTECODE: '1' };
+        return { source: execFileSync('python3', ['-c', script], { encoding: 'utf8', env, stdio: ['ignore', 'pipe', 'pipe'] }) };
+    } catch (error) {
+        const stderr = String(error.stderr || error.message);
+        if (/No module named 'pyteal'/.test(stderr)) return { skipped: 'pyteal not installed' };
+        return { skipped: `compile failed: ${stderr.trim().split('\n').pop()}` };
+    }
+}
+
+function seedLedger(program) {
+    const ledger = createLedger();
+    for (const [address, values] of Object.entries(program.local || {})) {
+        const local = new Map();
+        for (const [key, value] of Object.entries(values)) {
+            local.set(Buffer.from(key).toString('hex'), typeof value === 'number' ? BigInt(value) : value);
+        }
+        ledger.local.set(addressBytes(address).toString('hex'), local);
+    }
+    return ledger;
+}
+
+function measure(result, mode, groupSize) {
+    const budget = mode === 'signature' ? LOGIC_SIG_BUDGET : APP_BUDGET;
+    return {
+        result: result.approved ? 'approved' : `rejected: ${result.error || 'returned 0'}`,
+        cost: result.cost,
+        pooledCalls: mode === 'signature' ? 0 : Math.max(1, Math.ceil(result.cost / budget)),
+        fee: callFee(result, groupSize),
+        innerTxns: result.innerTxns.length,
+        logs: result.logs.length,
+        logBytes: result.logs.reduce((total, entry) => total + entry.length, 0),
+        delta: result.delta
+    };
+}
+
+/**
+ * Run every program → { [program]: { skipped } | { [method]: measurement } }
+ */
+function runBenchmarks(programs = PROGRAMS) {
+    const report = {};
+    for (const program of programs) {
+        const loaded = loadSource(program);
+        if (loaded.skipped) {
+            report[program.name] = { skipped: loaded.skipped };
+            continue;
+        }
+        const machine = new TealMachine(assembleTeal(loaded.source));
+        const appAddress = applicationAddress(APP_ID);
+        const methods = {};
+        for (const run of program.runs()) {
+            const ledger = seedLedger(program);
+            for (const step of run) {
+                const mode = step.mode || 'application';
+                const groupIndex = step.groupIndex || 0;
+                const txn = mode === 'signature' ? step.txn : {
+                    Sender: step.sender,
+                    ApplicationID: step.create ? 0 : APP_ID,
+                    OnCompletion: step.onCompletion || 'NoOp',
+                    ApplicationArgs: step.args || [],
+                    GroupIndex: groupIndex
+                };
+                const group = (step.group || []).map(entry => ({ ...entry, Receiver: entry.Receiver || appAddress }));
+                const result = machine.run({
+                    mode, txn, group, ledger,
+                    args: step.lsigArgs,
+                    appId: APP_ID,
+                    creator: CREATOR,
+                    timestamp: step.time || NOW,
+                    round: 1000,
+                    budget: mode === 'signature' ? LOGIC_SIG_BUDGET : Infinity // measure past 700, report pooling instead
+                });
+                if (step.record !== false && !(step.label in methods)) methods[step.label] = measure(result, mode, group.length + 1);
+            }
+        }
+        report[program.name] = methods;
+    }
+    return report;
+}
+
+/**
+ * Differences against a snapshot. Regressions: higher cost or fee, a changed
+ * outcome or state delta, a method that disappeared. Skipped programs are not compared.
+ */
+function compareSnapshots(previous, current) {
+    const regressions = [];
+    const improvements = [];
+    for (const [program, methods] of Object.entries(current)) {
+        const before = previous[program];
+        if (methods.skipped || !before || before.skipped) continue;
+        for (const [method, now] of Object.entries(methods)) {
+            const was = before[method];
+            const key = `${program} ${method}`;
+            if (!was) {
+                improvements.push(`${key}: new (${now.cost} opcodes)`);
+                continue;
+            }
+            if (now.result !== was.result) regressions.push(`${key}: ${was.result} → ${now.result}`);
+            if (now.cost > was.cost) regressions.push(`${key}: cost ${was.cost} → ${now.cost}`);
+            else if (now.cost < was.cost) improvements.push(`${key}: cost ${was.cost} → ${now.cost}`);
+            if (now.fee > was.fee) regressions.push(`${key}: fee ${was.fee} → ${now.fee}`);
+            else if (now.fee < was.fee) improvements.push(`${key}: fee ${was.fee} → ${now.fee}`);
+            if (JSON.stringify(now.delta) !== JSON.stringify(was.delta)) regressions.push(`${key}: state delta changed`);
+        }
+        for (const method of Object.keys(before)) {
+            if (!(method in methods)) regressions.push(`${program} ${method}: no longer benchmarked`);
+        }
+    }
+    return { regressions, improvements };
+}
+
+function deltaSummary(delta) {
+    const count = (changes) => Object.keys(changes).length;
+    const local = Object.values(delta.local).reduce((total, changes) => total + count(changes), 0);
+    return `g${count(delta.global)} l${local} box${count(delta.boxes)}`;
+}
+
+function printReport(report) {
+    for (const [program, methods] of Object.entries(report)) {
+        console.log(`\n📦 ${program}`);
+        if (methods.skipped) {
+            console.log(`   ⏭️  skipped: ${methods.skipped}`);
+            continue;
+        }
+        console.log('   method             cost  pool   fee  itxn  logs  Δstate          result');
+        for (const [method, m] of Object.entries(methods)) {
+            const pool = m.pooledCalls === 0 ? 'lsig' : `${m.pooledCalls}x`;
+            const flag = m.pooledCalls > 1 ? '⚠️' : '';
+            console.log(`   ${method.padEnd(17)} ${String(m.cost).padStart(5)}  ${pool.padStart(4)} ${String(m.fee).padStart(5)}  ${String(m.innerTxns).padStart(4)}  ${String(m.logs).padStart(4)}  ${deltaSummary(m.delta).padEnd(14)}  ${m.result}${flag}`);
+        }
+    }
+}
+
+if (require.main === module) {
+    const update = process.argv.includes('--update');
+    console.log('📏 ALGORAND TEAL COST BENCHMARK');
+    console.log('===============================');
+    console.log(`   Budget: ${APP_BUDGET} per app call (pooled across a group), ${LOGIC_SIG_BUDGET} per logic signature`);
+
+    const report = runBenchmarks();
+    printReport(report);
+
+    const previous = fs.existsSync(SNAPSHOT_PATH) ? JSON.parse(fs.readFileSync(SNAPSHOT_PATH, 'utf8')) : {};
+    if (update) {
+        // Keep the last known numbers of programs that could not be compiled here
+        const merged = { ...previous };
+        for (const [program, methods] of Object.entries(report)) {
+            if (!methods.skipped || !(program in previous)) merged[program] = methods;
+        }
+        fs.mkdirSync(path.dirname(SNAPSHOT_PATH), { recursive: true });
+        fs.writeFileSync(SNAPSHOT_PATH, JSON.stringify(merged, null, 2) + '\n');
+        console.log(`\n📝 Snapshot written to ${path.relative(ROOT, SNAPSHOT_PATH)}`);
+        process.exit(0);
+    }
+
+    const { regressions, improvements } = compareSnapshots(previous, report);
+    console.log('\n===============================');
+    improvements.forEach(line => console.log(`📉 ${line}`));
+    regressions.forEach(line => console.log(`❌ ${line}`));
+    if (regressions.length === 0) console.log('✅ No regressions against the snapshot');
+    else console.log('   Run with --update to accept these changes');
+    process.exit(regressions.length === 0 ? 0 : 1);
+}
+
+module.exports = { PROGRAMS, SNAPSHOT_PATH, runBenchmarks, compareSnapshots };
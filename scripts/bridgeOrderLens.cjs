@@ -0,0 +1,150 @@
+#!/usr/bin/env node
+
+/**
+ * 🔭 BRIDGE ORDER LENS CLIENT
+ *
+ * Relayer-side twin of contracts/BridgeOrderLens.sol:
+ * ✅ Decodes the one-word order status (status, flags, fill count, expiry, amounts, bid count)
+ * ✅ Chunks id lists so each eth_call stays well under the node's gas cap
+ * ✅ Batched best bids (EnhancedLimitOrderBridge) and revealed secrets
+ *
+ * One eth_call per chunk replaces one getter call per order on restart
+ * reconciliation and dashboard refreshes.
+ */
+
+const STATUS = ['unknown', 'open', 'partiallyFilled', 'filled', 'cancelled', 'expired'];
+const BRIDGE_KIND = { limitOrder: 0, enhancedLimitOrder: 1, partialFill: 2, crossChainHTLC: 3 };
+const FLAG_SECRET_REVEALED = 1;
+const FLAG_MULTI_SECRET = 2;
+const NO_BID = (1n << 256n) - 1n;
+const DEFAULT_CHUNK_SIZE = 200;
+
+const UINT8 = 0xffn;
+const UINT32 = 0xffffffffn;
+const UINT96 = (1n << 96n) - 1n;
+
+const LENS_ABI = [
+    'function getOrders(address bridge, uint8 kind, bytes32[] ids) external view returns (uint256[] words)',
+    'function getBestBids(address bridge, bytes32[] ids) external view returns (tuple(address resolver, uint256 inputAmount, uint256 outputAmount, uint256 timestamp, bool active, uint256 gasEstimate, uint256 totalCost)[] bestBids, uint256[] bestIndexes)',
+    'function getRevealedSecrets(address bridge, bytes32[] ids) external view returns (bytes32[] secrets)'
+];
+
+const toBigInt = (value) => typeof value === 'bigint' ? value : BigInt(value);
+const saturate = (value, max) => value > max ? max : value;
+
+/**
+ * BridgeOrderLens status word → plain object (amounts as BigInt)
+ */
+function decodeStatusWord(value) {
+    const word = toBigInt(value);
+    const flags = Number((word >> 8n) & UINT8);
+    return {
+        status: STATUS[Number(word & UINT8)] || 'unknown',
+        secretRevealed: (flags & FLAG_SECRET_REVEALED) !== 0,
+        multiSecret: (flags & FLAG_MULTI_SECRET) !== 0,
+        fillCount: Number((word >> 16n) & UINT8),
+        expiry: Number((word >> 24n) & UINT32),
+        remaining: (word >> 56n) & UINT96,
+        total: (word >> 152n) & UINT96,
+        bidCount: Number(word >> 248n)
+    };
+}
+
+/**
+ * Inverse of decodeStatusWord, with the contract's saturation (for mocks and tests)
+ */
+function encodeStatusWord({ status = 'open', secretRevealed = false, multiSecret = false, fillCount = 0, expiry = 0, remaining = 0n, total = 0n, bidCount = 0 }) {
+    const index = STATUS.indexOf(status);
+    if (index < 0) throw new Error(`Unknown status: ${status}`);
+    const flags = (secretRevealed ? FLAG_SECRET_REVEALED : 0) | (multiSecret ? FLAG_MULTI_SECRET : 0);
+    return BigInt(index)
+        | BigInt(flags) << 8n
+        | saturate(toBigInt(fillCount), UINT8) << 16n
+        | saturate(toBigInt(expiry), UINT32) << 24n
+        | saturate(toBigInt(remaining), UINT96) << 56n
+        | saturate(toBigInt(total), UINT96) << 152n
+        | saturate(toBigInt(bidCount), UINT8) << 248n;
+}
+
+function chunk(items, size) {
+    const chunks = [];
+    for (let i = 0; i < items.length; i += size) chunks.push(items.slice(i, i + size));
+    return chunks;
+}
+
+class BridgeOrderLensClient {
+    /**
+     * @param {object} lens ethers Contract for BridgeOrderLens (LENS_ABI)
+     * @param {object} options { chunkSize: ids per eth_call }
+     */
+    constructor(lens, options = {}) {
+        this.lens = lens;
+        this.chunkSize = options.chunkSize || DEFAULT_CHUNK_SIZE;
+    }
+
+    /**
+     * @returns {Promise<Map<string, object>>} id → decoded status (unknown ids have status 'unknown')
+     */
+    async getOrders(bridge, kind, ids) {
+        const kindIndex = typeof kind === 'number' ? kind : BRIDGE_KIND[kind];
+        if (kindIndex === undefined) throw new Error(`Unknown bridge kind: ${kind}`);
+        const results = new Map();
+        const chunks = chunk(ids, this.chunkSize);
+        const replies = await Promise.all(chunks.map(part => this.lens.getOrders(bridge, kindIndex, part)));
+        chunks.forEach((part, c) => part.forEach((id, i) => results.set(id, decodeStatusWord(replies[c][i]))));
+        return results;
+    }
+
+    /**
+     * @returns {Promise<Map<string, { bid, index }|null>>} null when the order has no active bid
+     */
+    async getBestBids(bridge, ids) {
+        const results = new Map();
+        const chunks = chunk(ids, this.chunkSize);
+        const replies = await Promise.all(chunks.map(part => this.lens.getBestBids(bridge, part)));
+        chunks.forEach((part, c) => {
+            const [bids, indexes] = replies[c];
+            part.forEach((id, i) => {
+                const index = toBigInt(indexes[i]);
+                results.set(id, index === NO_BID ? null : { bid: bids[i], index: Number(index) });
+            });
+        });
+        return results;
+    }
+
+    /**
+     * @returns {Promise<Map<string, string>>} id → secret, revealed secrets only
+     */
+    async getRevealedSecrets(bridge, ids) {
+        const results = new Map();
+        const chunks = chunk(ids, this.chunkSize);
+        const replies = await Promise.all(chunks.map(part => this.lens.getRevealedSecrets(bridge, part)));
+        chunks.forEach((part, c) => part.forEach((id, i) => {
+            if (toBigInt(replies[c][i]) !== 0n) results.set(id, replies[c][i]);
+        }));
+        return results;
+    }
+}
+
+if (require.main === module) {
+    const word = process.argv[2];
+    const decoded = decodeStatusWord(word || encodeStatusWord({
+        status: 'partiallyFilled', multiSecret: true, fillCount: 3, expiry: 1_700_086_400,
+        remaining: 4n * 10n ** 17n, total: 10n ** 18n, bidCount: 5
+    }));
+    console.log('🔭 ORDER STATUS WORD');
+    console.log('===================');
+    for (const [name, value] of Object.entries(decoded)) {
+        console.log(`   ${name}: ${value}`);
+    }
+}
+
+module.exports = {
+    STATUS,
+    BRIDGE_KIND,
+    NO_BID,
+    LENS_ABI,
+    decodeStatusWord,
+    encodeStatusWord,
+    BridgeOrderLensClient
+};
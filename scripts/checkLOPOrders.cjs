@@ -8,6 +8,7 @@
 
 const { ethers } = require('ethers');
 const fs = require('fs');
+const { BridgeOrderLensClient, LENS_ABI } = require('./bridgeOrderLens.cjs');
 
 async function checkLOPOrders() {
     console.log('🔍 CHECKING LOP ORDERS');
@@ -47,6 +48,13 @@ async function checkLOPOrders() {
             console.log(`📊 Found ${events.length} LimitOrderCreated events\n`);
             
             if (events.length > 0) {
+                // With a BridgeOrderLens deployed, all order states come back in one eth_call
+                const lensAddress = process.env.BRIDGE_ORDER_LENS_ADDRESS;
+                const lens = lensAddress ? new BridgeOrderLensClient(new ethers.Contract(lensAddress, LENS_ABI, provider)) : null;
+                const orderIds = events.map(event => event.args.orderId);
+                const states = lens ? await lens.getOrders(contractAddress, 'enhancedLimitOrder', orderIds) : null;
+                const bestBids = lens ? await lens.getBestBids(contractAddress, orderIds) : null;
+                
                 for (let i = 0; i < events.length; i++) {
                     const event = events[i];
                     const { orderId, maker, makerToken, takerToken, makerAmount, takerAmount, deadline, algorandAddress, hashlock, timelock } = event.args;
@@ -60,6 +68,20 @@ async function checkLOPOrders() {
                     console.log(`   Block: ${event.blockNumber}`);
                     console.log(`   Hashlock: ${hashlock}`);
                     
+                    if (states) {
+                        const state = states.get(orderId);
+                        const best = bestBids.get(orderId);
+                        console.log(`   Status: ${state.status.toUpperCase()} (${state.fillCount} fill(s))`);
+                        console.log(`   Remaining: ${ethers.formatEther(state.remaining)} ETH`);
+                        console.log(`   Expiry: ${new Date(state.expiry * 1000).toISOString()}`);
+                        console.log(`   Bids: ${state.bidCount}`);
+                        if (best) {
+                            console.log(`   Best Bid ${best.index}: ${best.bid.resolver} - ${ethers.formatEther(best.bid.inputAmount)} ETH -> ${ethers.formatEther(best.bid.outputAmount)} ALGO`);
+                        }
+                        console.log('');
+                        continue;
+                    }
+                    
                     // Check order status
                     try {
                         const order = await contract.limitOrders(orderId);
@@ -0,0 +1,183 @@
+#!/usr/bin/env node
+
+/**
+ * 📦 COMPACT LIMIT ORDER ENCODER
+ *
+ * Client side of EnhancedLimitOrderBridge.submitCompactLimitOrder:
+ * ✅ Algorand address ⇄ 32-byte public key + 4-byte checksum (SHA-512/256)
+ * ✅ Packs amounts and terms into the CompactIntent words
+ * ✅ EIP-2098 compact signatures (r, yParity | s)
+ *
+ * The maker signs the usual LimitOrderIntent (same EIP-712 type); only the
+ * transport changes. Calldata drops from 708 to 324 bytes per order.
+ */
+
+const crypto = require('crypto');
+
+const BASE32_ALPHABET = 'ABCDEFGHIJKLMNOPQRSTUVWXYZ234567';
+const ALGORAND_ADDRESS_LENGTH = 58;
+const COMPACT_ALLOW_PARTIAL_FILLS = 1;
+
+const UINT32 = (1n << 32n) - 1n;
+const UINT40 = (1n << 40n) - 1n;
+const UINT96 = (1n << 96n) - 1n;
+const UINT128 = (1n << 128n) - 1n;
+
+const COMPACT_SUBMIT_ABI = [
+    'function submitCompactLimitOrder(tuple(address makerToken, address takerToken, uint256 amounts, uint256 terms, bytes32 salt, bytes32 algorandPublicKey) compact, bytes32 r, bytes32 vs, bytes32 hashlock, uint256 timelock) external payable returns (bytes32)'
+];
+
+const toHex = (buffer) => '0x' + Buffer.from(buffer).toString('hex');
+const fromHex = (hex) => Buffer.from(hex.replace(/^0x/, ''), 'hex');
+
+function fitBits(name, value, max) {
+    const big = BigInt(value);
+    if (big < 0n || big > max) throw new Error(`${name} does not fit the compact layout: ${value}`);
+    return big;
+}
+
+function algorandChecksum(publicKey) {
+    return crypto.createHash('sha512-256').update(publicKey).digest().subarray(28);
+}
+
+/**
+ * Algorand address → { publicKey, checksum } as 0x hex; rejects bad checksums
+ */
+function decodeAlgorandAddress(address) {
+    if (address.length !== ALGORAND_ADDRESS_LENGTH) throw new Error(`Invalid Algorand address length: ${address}`);
+    const raw = Buffer.alloc(36);
+    let bits = 0;
+    let value = 0;
+    let offset = 0;
+    for (const char of address) {
+        const index = BASE32_ALPHABET.indexOf(char);
+        if (index < 0) throw new Error(`Invalid Algorand address character: ${char}`);
+        value = (value << 5 | index) & 0xfff;
+        bits += 5;
+        if (bits >= 8) {
+            bits -= 8;
+            raw[offset++] = value >> bits & 0xff;
+        }
+    }
+    const publicKey = raw.subarray(0, 32);
+    const checksum = raw.subarray(32);
+    if (!algorandChecksum(publicKey).equals(checksum)) throw new Error(`Invalid Algorand address checksum: ${address}`);
+    return { publicKey: toHex(publicKey), checksum: toHex(checksum) };
+}
+
+/**
+ * Same as AlgorandAddressLib.encode; the checksum is computed when omitted
+ */
+function encodeAlgorandAddress(publicKey, checksum) {
+    const key = fromHex(publicKey);
+    const raw = Buffer.concat([key, checksum ? fromHex(checksum) : algorandChecksum(key), Buffer.alloc(1)]);
+    let text = '';
+    for (let i = 0; i < ALGORAND_ADDRESS_LENGTH; i++) {
+        const bit = i * 5;
+        const window = raw[bit >> 3] << 8 | raw[(bit >> 3) + 1];
+        text += BASE32_ALPHABET[window >> (11 - bit % 8) & 31];
+    }
+    return text;
+}
+
+function packAmounts(makerAmount, takerAmount) {
+    return fitBits('makerAmount', makerAmount, UINT128) | fitBits('takerAmount', takerAmount, UINT128) << 128n;
+}
+
+function unpackAmounts(amounts) {
+    const word = BigInt(amounts);
+    return { makerAmount: word & UINT128, takerAmount: word >> 128n };
+}
+
+function packTerms({ deadline, algorandChainId, minPartialFill = 0n, allowPartialFills = false, checksum }) {
+    return fitBits('deadline', deadline, UINT40)
+        | fitBits('algorandChainId', algorandChainId, UINT32) << 40n
+        | fitBits('minPartialFill', minPartialFill, UINT96) << 72n
+        | BigInt(allowPartialFills ? COMPACT_ALLOW_PARTIAL_FILLS : 0) << 168n
+        | BigInt(checksum) << 176n;
+}
+
+function unpackTerms(terms) {
+    const word = BigInt(terms);
+    return {
+        deadline: Number(word & UINT40),
+        algorandChainId: Number(word >> 40n & UINT32),
+        minPartialFill: word >> 72n & UINT96,
+        allowPartialFills: (Number(word >> 168n & 0xffn) & COMPACT_ALLOW_PARTIAL_FILLS) !== 0,
+        checksum: '0x' + (word >> 176n & UINT32).toString(16).padStart(8, '0')
+    };
+}
+
+/**
+ * LimitOrderIntent (as signed) → CompactIntent tuple; the maker must send the transaction
+ */
+function toCompactIntent(intent) {
+    const { publicKey, checksum } = decodeAlgorandAddress(intent.algorandAddress);
+    return {
+        makerToken: intent.makerToken,
+        takerToken: intent.takerToken,
+        amounts: packAmounts(intent.makerAmount, intent.takerAmount),
+        terms: packTerms({ ...intent, checksum }),
+        salt: typeof intent.salt === 'string' ? intent.salt : toHex(intent.salt),
+        algorandPublicKey: publicKey
+    };
+}
+
+/**
+ * Inverse of toCompactIntent, given the maker (for display and tests)
+ */
+function fromCompactIntent(compact, maker) {
+    const terms = unpackTerms(compact.terms);
+    return {
+        maker,
+        makerToken: compact.makerToken,
+        takerToken: compact.takerToken,
+        ...unpackAmounts(compact.amounts),
+        deadline: terms.deadline,
+        algorandChainId: terms.algorandChainId,
+        algorandAddress: encodeAlgorandAddress(compact.algorandPublicKey, terms.checksum),
+        salt: compact.salt,
+        allowPartialFills: terms.allowPartialFills,
+        minPartialFill: terms.minPartialFill
+    };
+}
+
+/**
+ * 65-byte r || s || v signature → EIP-2098 { r, vs }
+ */
+function toCompactSignature(signature) {
+    const raw = fromHex(signature);
+    if (raw.length !== 65) throw new Error('Expected a 65-byte signature');
+    const v = raw[64] < 27 ? raw[64] : raw[64] - 27;
+    const vs = Buffer.from(raw.subarray(32, 64));
+    if (v === 1) vs[0] |= 0x80;
+    return { r: toHex(raw.subarray(0, 32)), vs: toHex(vs) };
+}
+
+if (require.main === module) {
+    const address = process.argv[2] || 'BJDBVZITI7VRHJLMPY4C6BX5UVBHZVNT6PRD3ZZWO2E2HSDYGSF4KO6RR4';
+    const { publicKey, checksum } = decodeAlgorandAddress(address);
+    const legacyBytes = 4 + 32 * 4 + 32 * (11 + 1 + 2) + 32 * (1 + 3);
+    const compactBytes = 4 + 32 * (6 + 2 + 2);
+    console.log('📦 COMPACT LIMIT ORDER');
+    console.log('======================');
+    console.log(`   Algorand address: ${address}`);
+    console.log(`   Public key: ${publicKey}`);
+    console.log(`   Checksum: ${checksum}`);
+    console.log(`   submitLimitOrder calldata: ${legacyBytes} bytes`);
+    console.log(`   submitCompactLimitOrder calldata: ${compactBytes} bytes`);
+}
+
+module.exports = {
+    COMPACT_ALLOW_PARTIAL_FILLS,
+    COMPACT_SUBMIT_ABI,
+    decodeAlgorandAddress,
+    encodeAlgorandAddress,
+    packAmounts,
+    unpackAmounts,
+    packTerms,
+    unpackTerms,
+    toCompactIntent,
+    fromCompactIntent,
+    toCompactSignature
+};
@@ -0,0 +1,116 @@
+#!/usr/bin/env node
+
+/**
+ * ⛽ ESCROW FACTORY GAS COMPARISON
+ *
+ * Deploys the pre-clone factory (contracts/mocks/LegacyOfficial1inchEscrowFactory.sol)
+ * and the clone + CREATE2 Official1inchEscrowFactory on the Hardhat network and
+ * compares gas for factory deployment, createEscrow(), resolve() and refund().
+ * Measured averages and clone-minus-legacy deltas are written to
+ * scripts/snapshots/escrowFactoryGas.json so they can be committed.
+ *
+ * Run: npx hardhat run scripts/compareEscrowFactoryGas.cjs
+ */
+
+const fs = require('fs');
+const path = require('path');
+const { ethers } = require('hardhat');
+const { predictEscrowAddress, findEscrowImmutables } = require('./escrowAddressPredictor.cjs');
+
+const REPORT_PATH = path.join(__dirname, 'snapshots/escrowFactoryGas.json');
+
+async function main() {
+    console.log('⛽ ESCROW FACTORY GAS COMPARISON');
+    console.log('================================');
+
+    const [creator, resolver] = await ethers.getSigners();
+    const amount = ethers.parseEther('0.01');
+    const deadline = (await ethers.provider.getBlock('latest')).timestamp + 3600;
+    const secret = ethers.id('secret');
+
+    const Legacy = await ethers.getContractFactory('LegacyOfficial1inchEscrowFactory');
+    const Clone = await ethers.getContractFactory('Official1inchEscrowFactory');
+    const legacy = await Legacy.deploy();
+    const clone = await Clone.deploy();
+    await Promise.all([legacy.waitForDeployment(), clone.waitForDeployment()]);
+    const legacyDeploy = await legacy.deploymentTransaction().wait();
+    const cloneDeploy = await clone.deploymentTransaction().wait();
+
+    const results = [];
+    const refundable = [];
+    for (let i = 0; i < 3; i++) {
+        const orderHash = ethers.id(`order-${i}`);
+        const immutables = { orderHash, creator: creator.address, token: ethers.ZeroAddress, amount, deadline };
+
+        const legacyCreate = await (await legacy.createEscrow(ethers.ZeroAddress, amount, orderHash, deadline, '0x', { value: amount })).wait();
+        const legacyEscrow = await ethers.getContractAt('LegacyOfficial1inchEscrow', await legacy.getEscrow(orderHash));
+        const legacyResolve = await (await legacyEscrow.connect(resolver).resolve(secret)).wait();
+
+        const predicted = predictEscrowAddress(await clone.getAddress(), await clone.ESCROW_IMPLEMENTATION(), immutables);
+        const cloneCreate = await (await clone.createEscrow(ethers.ZeroAddress, amount, orderHash, deadline, '0x', { value: amount })).wait();
+        const deployed = await clone.getEscrow(orderHash);
+        const cloneEscrow = await ethers.getContractAt('Official1inchEscrow', deployed);
+        // Resolvers rebuild the immutables from the factory's EscrowDeployed log
+        const logged = await findEscrowImmutables(clone, orderHash);
+        const cloneResolve = await (await cloneEscrow.connect(resolver).resolve(secret, logged)).wait();
+
+        // A second escrow per factory is left unresolved and refunded after the deadline
+        const refundHash = ethers.id(`refund-${i}`);
+        await (await legacy.createEscrow(ethers.ZeroAddress, amount, refundHash, deadline, '0x', { value: amount })).wait();
+        await (await clone.createEscrow(ethers.ZeroAddress, amount, refundHash, deadline, '0x', { value: amount })).wait();
+        refundable.push(refundHash);
+
+        results.push({
+            legacyCreate: legacyCreate.gasUsed,
+            cloneCreate: cloneCreate.gasUsed,
+            legacyResolve: legacyResolve.gasUsed,
+            cloneResolve: cloneResolve.gasUsed,
+            predicted: predicted === deployed && logged.deadline === BigInt(deadline)
+        });
+    }
+
+    // Pre-funded path: relayer sends ETH to the predicted address, createEscrow carries no value
+    const orderHash = ethers.id('order-prefunded');
+    const immutables = { orderHash, creator: creator.address, token: ethers.ZeroAddress, amount, deadline };
+    const predicted = predictEscrowAddress(await clone.getAddress(), await clone.ESCROW_IMPLEMENTATION(), immutables);
+    await (await resolver.sendTransaction({ to: predicted, value: amount })).wait();
+    const prefunded = await (await clone.createEscrow(ethers.ZeroAddress, amount, orderHash, deadline, '0x')).wait();
+
+    await ethers.provider.send('evm_increaseTime', [3600]);
+    await ethers.provider.send('evm_mine', []);
+    for (const [i, refundHash] of refundable.entries()) {
+        const legacyEscrow = await ethers.getContractAt('LegacyOfficial1inchEscrow', await legacy.getEscrow(refundHash));
+        const cloneEscrow = await ethers.getContractAt('Official1inchEscrow', await clone.getEscrow(refundHash));
+        const logged = await findEscrowImmutables(clone, refundHash);
+        results[i].legacyRefund = (await (await legacyEscrow.refund()).wait()).gasUsed;
+        results[i].cloneRefund = (await (await cloneEscrow.refund(logged)).wait()).gasUsed;
+    }
+
+    const avg = (key) => results.reduce((sum, r) => sum + r[key], 0n) / BigInt(results.length);
+    const saving = (before, after) => `${(Number(before - after) * 100 / Number(before)).toFixed(1)}%`;
+
+    console.log(`deploy        legacy: ${legacyDeploy.gasUsed}  clone: ${cloneDeploy.gasUsed}`);
+    console.log(`createEscrow  legacy: ${avg('legacyCreate')}  clone: ${avg('cloneCreate')}  (-${saving(avg('legacyCreate'), avg('cloneCreate'))})`);
+    console.log(`resolve       legacy: ${avg('legacyResolve')}  clone: ${avg('cloneResolve')}`);
+    console.log(`refund        legacy: ${avg('legacyRefund')}  clone: ${avg('cloneRefund')}`);
+    console.log(`createEscrow  pre-funded clone: ${prefunded.gasUsed}`);
+    console.log(`Off-chain address prediction: ${results.every(r => r.predicted) ? '✅ matches' : '❌ mismatch'}`);
+
+    // delta is clone minus legacy: negative is a saving
+    const entry = (legacyGas, cloneGas) => ({ legacy: Number(legacyGas), clone: Number(cloneGas), delta: Number(cloneGas - legacyGas) });
+    const report = {
+        deploy: entry(legacyDeploy.gasUsed, cloneDeploy.gasUsed),
+        createEscrow: { ...entry(avg('legacyCreate'), avg('cloneCreate')), clonePrefunded: Number(prefunded.gasUsed) },
+        resolve: entry(avg('legacyResolve'), avg('cloneResolve')),
+        refund: entry(avg('legacyRefund'), avg('cloneRefund')),
+        addressPrediction: results.every(r => r.predicted)
+    };
+    fs.mkdirSync(path.dirname(REPORT_PATH), { recursive: true });
+    fs.writeFileSync(REPORT_PATH, JSON.stringify(report, null, 2) + '\n');
+    console.log(`📝 Written to ${path.relative(process.cwd(), REPORT_PATH)}`);
+}
+
+main().catch(error => {
+    console.error('❌ Gas comparison failed:', error);
+    process.exit(1);
+});
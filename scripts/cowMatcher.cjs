@@ -0,0 +1,254 @@
+#!/usr/bin/env node
+
+/**
+ * 🤝 COINCIDENCE-OF-WANTS MATCHER
+ *
+ * Nets ETH → ALGO intents against ALGO → ETH intents before anything is escrowed:
+ * ✅ Exact BigInt limit checks (wei and microAlgos, no floats)
+ * ✅ Best ask meets best bid first; clears at the reference price clamped into
+ *    both limits (midpoint without one), so nobody gets less than they signed for
+ * ✅ Honours allowPartialFills / minPartialFill on both sides
+ * ✅ Matched pair = 2 maker-to-maker HTLCs on the ETH seller's hashlock;
+ *    only the residual goes through resolvers (2 HTLCs each, resolver inventory)
+ *
+ * Prices are microAlgos per wei, kept as { num, den } fractions.
+ */
+
+const DIRECTION = { ETH_TO_ALGO: 'ETH_TO_ALGO', ALGO_TO_ETH: 'ALGO_TO_ETH' };
+const DEFAULT_MAX_WAIT_SECONDS = 60;
+
+const toBigInt = (value) => typeof value === 'bigint' ? value : BigInt(value);
+const ceilDiv = (a, b) => (a + b - 1n) / b;
+
+/**
+ * Normalise a LimitOrderIntent-shaped object: makerAmount is what the maker sells,
+ * takerAmount the minimum it buys (wei for ETH, microAlgos for ALGO).
+ */
+function fromLimitOrderIntent(id, direction, intent, extra = {}) {
+    return {
+        id,
+        direction,
+        maker: intent.maker,
+        sell: intent.makerAmount,
+        minBuy: intent.takerAmount,
+        deadline: intent.deadline,
+        allowPartialFills: Boolean(intent.allowPartialFills),
+        minPartialFill: intent.minPartialFill || 0,
+        algorandAddress: intent.algorandAddress,
+        hashlock: intent.hashlock,
+        ...extra
+    };
+}
+
+class CowMatcher {
+    /**
+     * @param {object} options
+     * @param {function} [options.now]            () => seconds
+     * @param {function} [options.referencePrice] () => { num, den } microAlgos per wei, or null
+     * @param {number} [options.maxWaitSeconds]   unmatched time before takeResidual() releases an intent
+     */
+    constructor(options = {}) {
+        this.now = options.now || (() => Math.floor(Date.now() / 1000));
+        this.referencePrice = options.referencePrice || (() => null);
+        this.maxWaitSeconds = options.maxWaitSeconds ?? DEFAULT_MAX_WAIT_SECONDS;
+        this.book = new Map(); // id -> entry
+    }
+
+    add(intent) {
+        if (!DIRECTION[intent.direction]) throw new Error(`Unknown direction: ${intent.direction}`);
+        if (this.book.has(intent.id)) throw new Error(`Intent ${intent.id} already in the book`);
+        const sell = toBigInt(intent.sell);
+        const minBuy = toBigInt(intent.minBuy);
+        if (sell <= 0n || minBuy <= 0n) throw new Error(`Intent ${intent.id} has no amount`);
+
+        const entry = {
+            ...intent,
+            sell,
+            minBuy,
+            minPartialFill: toBigInt(intent.minPartialFill || 0),
+            deadline: Number(intent.deadline),
+            remaining: sell,
+            addedAt: this.now()
+        };
+        this.book.set(intent.id, entry);
+        return entry;
+    }
+
+    remove(id) {
+        return this.book.delete(id);
+    }
+
+    get size() {
+        return this.book.size;
+    }
+
+    /**
+     * One matching round over the book. Matched amounts leave the book; entries
+     * with something left stay for the next round (or takeResidual).
+     * @returns {{ matches: Array<object>, expired: Array<string> }}
+     */
+    match() {
+        const now = this.now();
+        const expired = [];
+        const asks = [];
+        const bids = [];
+        for (const entry of this.book.values()) {
+            if (entry.deadline <= now) {
+                expired.push(entry.id);
+                this.book.delete(entry.id);
+            } else if (entry.direction === DIRECTION.ETH_TO_ALGO) {
+                asks.push(entry);
+            } else {
+                bids.push(entry);
+            }
+        }
+
+        // ask = minBuy / sell (microAlgos per wei wanted), bid = sell / minBuy (offered)
+        asks.sort((a, b) => compare(a.minBuy * b.sell, b.minBuy * a.sell) || a.deadline - b.deadline);
+        bids.sort((a, b) => compare(b.sell * a.minBuy, a.sell * b.minBuy) || a.deadline - b.deadline);
+
+        const matches = [];
+        for (const ethSeller of asks) {
+            for (const algoSeller of bids) {
+                if (ethSeller.remaining === 0n) break;
+                if (algoSeller.remaining === 0n) continue;
+                // Later bids are lower still: nothing else crosses this ask
+                if (ethSeller.minBuy * algoSeller.minBuy > ethSeller.sell * algoSeller.sell) break;
+
+                const fill = this.fill(ethSeller, algoSeller);
+                if (!fill) continue;
+
+                ethSeller.remaining -= fill.ethAmount;
+                algoSeller.remaining -= fill.algoAmount;
+                matches.push({
+                    ethIntent: ethSeller.id,
+                    algoIntent: algoSeller.id,
+                    ...fill,
+                    hashlock: ethSeller.hashlock,
+                    ethRecipient: algoSeller.ethAddress || algoSeller.maker,
+                    algorandRecipient: ethSeller.algorandAddress
+                });
+            }
+        }
+
+        for (const entry of [...asks, ...bids]) {
+            if (entry.remaining === 0n) this.book.delete(entry.id);
+        }
+        return { matches, expired };
+    }
+
+    /**
+     * Largest fill between a crossing pair that respects both limits, or null
+     */
+    fill(ethSeller, algoSeller) {
+        const price = this.clearingPrice(ethSeller, algoSeller);
+        const ethLeft = ethSeller.remaining;
+        const algoLeft = algoSeller.remaining;
+
+        let ethAmount;
+        let algoAmount;
+        const ethForAllAlgo = algoLeft * price.den / price.num;
+        if (!algoSeller.allowPartialFills || ethForAllAlgo < ethLeft) {
+            // The ALGO side sells out; any rounding dust stays with the ETH seller
+            algoAmount = algoLeft;
+            ethAmount = ethForAllAlgo < ethLeft ? ethForAllAlgo : ethLeft;
+        } else {
+            // The ETH side sells out; round in its favour, never past the ALGO seller's stock
+            ethAmount = ethLeft;
+            algoAmount = ethAmount * price.num / price.den;
+            const algoFloor = ceilDiv(ethAmount * ethSeller.minBuy, ethSeller.sell);
+            if (algoAmount < algoFloor) algoAmount = algoFloor;
+            if (algoAmount > algoLeft) return null;
+        }
+        if (ethAmount === 0n) return null;
+
+        // Pro-rata limits as signed: seller of ETH gets >= its rate, seller of ALGO pays <= its rate
+        if (algoAmount * ethSeller.sell < ethAmount * ethSeller.minBuy) return null;
+        if (ethAmount * algoSeller.sell < algoAmount * algoSeller.minBuy) return null;
+        if (!this.sizeAllowed(ethSeller, ethAmount) || !this.sizeAllowed(algoSeller, algoAmount)) return null;
+
+        return { ethAmount, algoAmount, price };
+    }
+
+    sizeAllowed(entry, amount) {
+        if (amount === entry.remaining) return entry.allowPartialFills || entry.remaining === entry.sell;
+        if (!entry.allowPartialFills) return false;
+        return amount >= entry.minPartialFill;
+    }
+
+    /**
+     * Reference price clamped into [ask, bid]; midpoint when there is none
+     */
+    clearingPrice(ethSeller, algoSeller) {
+        const ask = { num: ethSeller.minBuy, den: ethSeller.sell };
+        const bid = { num: algoSeller.sell, den: algoSeller.minBuy };
+        const reference = this.referencePrice();
+        if (!reference) {
+            return { num: ask.num * bid.den + bid.num * ask.den, den: 2n * ask.den * bid.den };
+        }
+        const ref = { num: toBigInt(reference.num), den: toBigInt(reference.den) };
+        if (ref.num * ask.den < ask.num * ref.den) return ask;
+        if (ref.num * bid.den > bid.num * ref.den) return bid;
+        return ref;
+    }
+
+    /**
+     * Entries unmatched for maxWaitSeconds leave the book for the resolver route.
+     * untouched = nothing of it was matched (its original signed order still applies).
+     */
+    takeResidual() {
+        const cutoff = this.now() - this.maxWaitSeconds;
+        const residual = [];
+        for (const entry of this.book.values()) {
+            if (entry.addedAt > cutoff) continue;
+            residual.push({ ...entry, untouched: entry.remaining === entry.sell });
+            this.book.delete(entry.id);
+        }
+        return residual;
+    }
+}
+
+function compare(a, b) {
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+/**
+ * HTLC legs for a round: 2 maker-to-maker HTLCs per match (both on the ETH
+ * seller's hashlock, so its secret unlocks both), 2 resolver-backed HTLCs per
+ * residual intent. htlcsWithoutMatching counts every intent through resolvers.
+ */
+function planSettlement(matches, residual = []) {
+    const legs = [];
+    for (const match of matches) {
+        legs.push({ kind: 'cow', chain: 'ethereum', from: match.ethIntent, to: match.algoIntent, amount: match.ethAmount, hashlock: match.hashlock, recipient: match.ethRecipient });
+        legs.push({ kind: 'cow', chain: 'algorand', from: match.algoIntent, to: match.ethIntent, amount: match.algoAmount, hashlock: match.hashlock, recipient: match.algorandRecipient });
+    }
+    for (const entry of residual) {
+        legs.push({ kind: 'resolver', chain: 'both', from: entry.id, amount: entry.remaining, direction: entry.direction });
+    }
+    const intents = new Set([...matches.flatMap(m => [m.ethIntent, m.algoIntent]), ...residual.map(entry => entry.id)]);
+    return {
+        legs,
+        htlcs: 2 * matches.length + 2 * residual.length,
+        htlcsWithoutMatching: 2 * intents.size
+    };
+}
+
+if (require.main === module) {
+    const eth = (n) => BigInt(Math.round(n * 1e6)) * 10n ** 12n;
+    const algo = (n) => BigInt(Math.round(n * 1e6));
+    const matcher = new CowMatcher({ referencePrice: () => ({ num: 1n, den: 10n ** 9n }) }); // 1000 ALGO per ETH
+    matcher.add({ id: 'e1', direction: 'ETH_TO_ALGO', sell: eth(1), minBuy: algo(990), deadline: 2e9, allowPartialFills: true });
+    matcher.add({ id: 'e2', direction: 'ETH_TO_ALGO', sell: eth(0.5), minBuy: algo(520), deadline: 2e9 });
+    matcher.add({ id: 'a1', direction: 'ALGO_TO_ETH', sell: algo(1500), minBuy: eth(1.45), deadline: 2e9, allowPartialFills: true });
+    matcher.add({ id: 'a2', direction: 'ALGO_TO_ETH', sell: algo(600), minBuy: eth(0.62), deadline: 2e9 });
+    const { matches } = matcher.match();
+    console.log('🤝 COINCIDENCE-OF-WANTS ROUND');
+    console.log('=============================');
+    for (const m of matches) {
+        console.log(`   ${m.ethIntent} → ${m.algoIntent}: ${m.ethAmount} wei ⇄ ${m.algoAmount} microAlgos`);
+    }
+    console.log(`   Left in book: ${[...matcher.book.values()].map(e => `${e.id} (${e.remaining})`).join(', ') || 'none'}`);
+}
+
+module.exports = { CowMatcher, DIRECTION, fromLimitOrderIntent, planSettlement };
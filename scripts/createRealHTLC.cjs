@@ -25,7 +25,8 @@ class RealHTLCCreator {
             "function createHTLCEscrow(address _recipient, address _resolver, bytes32 _hashlock, uint256 _timelock, uint256 _resolverFeeRate) external payable returns (bytes32)",
             "function withdrawWithSecret(bytes32 _escrowId, bytes32 _secret) external returns (bool)",
             "function refundAfterTimeout(bytes32 _escrowId) external returns (bool)",
-            "function getEscrow(bytes32 _escrowId) external view returns (tuple(address initiator, address recipient, address resolver, uint256 amount, bytes32 hashlock, uint256 timelock, bool withdrawn, bool refunded))",
+            "function getEscrow(bytes32 _escrowId) external view returns (tuple(address initiator, address recipient, address resolver, uint256 amount, bytes32 hashlock, uint256 timelocks, bool withdrawn, bool refunded))",
+            "function getExpiry(bytes32 _escrowId) external view returns (uint256)",
             "function owner() external view returns (address)",
             "function isResolverAuthorized(address _resolver) external view returns (bool)",
             "event HTLCEscrowCreated(bytes32 indexed escrowId, address indexed initiator, address indexed recipient, uint256 amount, bytes32 hashlock, uint256 timelock)",
@@ -0,0 +1,111 @@
+/**
+ * DEPLOY ALGORAND BOX HTLC BRIDGE
+ * Deploy contracts/algorand/AlgorandBoxHTLCBridge.teal and fund its app account
+ */
+
+const algosdk = require('algosdk');
+const fs = require('fs');
+const path = require('path');
+const { APP_MIN_BALANCE } = require('./algorandBoxHTLC.cjs');
+
+const APPROVAL_PATH = path.join(__dirname, '../contracts/algorand/AlgorandBoxHTLCBridge.teal');
+const CLEAR_TEAL = '#pragma version 10\nint 1\nreturn\n';
+
+async function deployAlgorandBoxHTLCBridge() {
+    console.log('🚀 DEPLOYING ALGORAND BOX HTLC BRIDGE');
+    console.log('=====================================');
+
+    try {
+        require('dotenv').config();
+
+        const algodClient = new algosdk.Algodv2('', 'https://testnet-api.algonode.cloud', '');
+        const algoAccount = algosdk.mnemonicToSecretKey(process.env.ALGORAND_MNEMONIC);
+        console.log(`📍 Deployer: ${algoAccount.addr}`);
+
+        // STEP 1: Compile TEAL to bytecode
+        console.log('\n🔧 STEP 1: COMPILE TEAL TO BYTECODE');
+        console.log('==================================');
+
+        const approvalCompileResponse = await algodClient.compile(fs.readFileSync(APPROVAL_PATH, 'utf8')).do();
+        const clearCompileResponse = await algodClient.compile(CLEAR_TEAL).do();
+        const approvalProgram = new Uint8Array(Buffer.from(approvalCompileResponse.result, 'base64'));
+        const clearProgram = new Uint8Array(Buffer.from(clearCompileResponse.result, 'base64'));
+
+        console.log(`✅ Approval bytecode: ${approvalProgram.length} bytes`);
+        console.log(`✅ Clear bytecode: ${clearProgram.length} bytes`);
+
+        // STEP 2: Deploy the contract (all HTLC state lives in boxes)
+        console.log('\n🚀 STEP 2: DEPLOY CONTRACT');
+        console.log('==========================');
+
+        const suggestedParams = await algodClient.getTransactionParams().do();
+        const deployTxn = algosdk.makeApplicationCreateTxnFromObject({
+            from: algoAccount.addr,
+            suggestedParams,
+            onComplete: algosdk.OnApplicationComplete.NoOpOC,
+            approvalProgram,
+            clearProgram,
+            numLocalInts: 0,
+            numLocalByteSlices: 0,
+            numGlobalInts: 0,
+            numGlobalByteSlices: 0,
+            extraPages: 0
+        });
+
+        const deployTxId = await algodClient.sendRawTransaction(deployTxn.signTxn(algoAccount.sk)).do();
+        console.log(`📝 Deploy Transaction: ${deployTxId.txId}`);
+        const confirmedTxn = await algosdk.waitForConfirmation(algodClient, deployTxId.txId, 4);
+        const appId = confirmedTxn['application-index'];
+        const appAddress = algosdk.getApplicationAddress(appId);
+
+        console.log(`🎉 CONTRACT DEPLOYED SUCCESSFULLY!`);
+        console.log(`📱 App ID: ${appId}`);
+        console.log(`🏦 App Address: ${appAddress}`);
+
+        // STEP 3: Fund the app account's own minimum balance; box deposits come with each HTLC
+        console.log('\n💰 STEP 3: FUND APP ACCOUNT');
+        console.log('===========================');
+
+        const fundTxn = algosdk.makePaymentTxnWithSuggestedParamsFromObject({
+            from: algoAccount.addr,
+            to: appAddress,
+            amount: APP_MIN_BALANCE,
+            suggestedParams: await algodClient.getTransactionParams().do()
+        });
+        const fundTxId = await algodClient.sendRawTransaction(fundTxn.signTxn(algoAccount.sk)).do();
+        await algosdk.waitForConfirmation(algodClient, fundTxId.txId, 4);
+        console.log(`✅ Funded ${APP_MIN_BALANCE} microAlgos: ${fundTxId.txId}`);
+
+        // STEP 4: Update environment file
+        console.log('\n📝 STEP 4: UPDATE ENVIRONMENT');
+        console.log('============================');
+
+        let envContent = fs.existsSync('.env') ? fs.readFileSync('.env', 'utf8') : '';
+        const appIdRegex = /^ALGORAND_BOX_HTLC_APP_ID=.*$/m;
+        const appIdLine = `ALGORAND_BOX_HTLC_APP_ID=${appId}`;
+        envContent = appIdRegex.test(envContent) ? envContent.replace(appIdRegex, appIdLine) : `${envContent}\n${appIdLine}\n`;
+        fs.writeFileSync('.env', envContent);
+        console.log(`✅ Updated .env with ${appIdLine}`);
+
+        return {
+            success: true,
+            appId,
+            appAddress,
+            transactionId: deployTxId.txId,
+            creator: algoAccount.addr,
+            approvalProgramSize: approvalProgram.length
+        };
+
+    } catch (error) {
+        console.error('❌ DEPLOYMENT FAILED');
+        console.error('====================');
+        console.error(`Error: ${error.message}`);
+        return { success: false, error: error.message };
+    }
+}
+
+if (require.main === module) {
+    deployAlgorandBoxHTLCBridge().then(result => process.exit(result.success ? 0 : 1));
+}
+
+module.exports = { deployAlgorandBoxHTLCBridge };
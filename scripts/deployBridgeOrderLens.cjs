@@ -0,0 +1,104 @@
+#!/usr/bin/env node
+
+/**
+ * deployBridgeOrderLens.cjs
+ * Deploy the stateless BridgeOrderLens (batched read-only order views)
+ *
+ * The lens holds no state and no owner; redeploy it whenever the bridges'
+ * view functions change. Point relayers at it with BRIDGE_ORDER_LENS_ADDRESS.
+ */
+
+const { ethers } = require('ethers');
+const fs = require('fs');
+const path = require('path');
+
+class BridgeOrderLensDeployer {
+    constructor() {
+        this.provider = null;
+        this.wallet = null;
+        this.lens = null;
+        this.deploymentResult = {};
+    }
+
+    async initialize() {
+        console.log('🔭 INITIALIZING BRIDGE ORDER LENS DEPLOYMENT');
+        console.log('============================================');
+
+        require('dotenv').config();
+
+        const infuraProjectId = process.env.INFURA_PROJECT_ID;
+        const sepoliaUrl = process.env.SEPOLIA_URL || `https://sepolia.infura.io/v3/${infuraProjectId}`;
+        this.provider = new ethers.JsonRpcProvider(sepoliaUrl);
+
+        const privateKey = process.env.PRIVATE_KEY;
+        if (!privateKey) {
+            throw new Error('❌ PRIVATE_KEY not found in environment');
+        }
+        this.wallet = new ethers.Wallet(privateKey, this.provider);
+
+        console.log(`📡 Connected to Sepolia: ${sepoliaUrl}`);
+        console.log(`👤 Deployer: ${this.wallet.address}`);
+    }
+
+    async deployLens() {
+        const contractPath = path.join(__dirname, '../artifacts/contracts/BridgeOrderLens.sol/BridgeOrderLens.json');
+        if (!fs.existsSync(contractPath)) {
+            throw new Error('❌ BridgeOrderLens artifact not found. Please compile with hardhat first.');
+        }
+
+        const contractArtifact = JSON.parse(fs.readFileSync(contractPath, 'utf8'));
+        const contractFactory = new ethers.ContractFactory(contractArtifact.abi, contractArtifact.bytecode, this.wallet);
+
+        console.log('🚀 Deploying BridgeOrderLens...');
+        this.lens = await contractFactory.deploy();
+        console.log(`📝 Transaction: ${this.lens.deploymentTransaction().hash}`);
+
+        await this.lens.waitForDeployment();
+        const address = await this.lens.getAddress();
+        console.log(`✅ BridgeOrderLens deployed at: ${address}`);
+
+        this.deploymentResult.lens = address;
+        return address;
+    }
+
+    async saveDeploymentResult() {
+        const deploymentData = {
+            network: 'sepolia',
+            timestamp: new Date().toISOString(),
+            deployer: this.wallet.address,
+            contracts: {
+                BridgeOrderLens: this.deploymentResult.lens
+            }
+        };
+
+        const filename = `bridge-order-lens-deployment-${Date.now()}.json`;
+        fs.writeFileSync(filename, JSON.stringify(deploymentData, null, 2));
+
+        console.log(`✅ Deployment result saved to: ${filename}`);
+        console.log(`💡 Set BRIDGE_ORDER_LENS_ADDRESS=${this.deploymentResult.lens}`);
+    }
+
+    async deploy() {
+        try {
+            await this.initialize();
+            await this.deployLens();
+            await this.saveDeploymentResult();
+            return this.deploymentResult;
+        } catch (error) {
+            console.error('❌ Deployment failed:', error.message);
+            throw error;
+        }
+    }
+}
+
+// Main execution
+async function main() {
+    const deployer = new BridgeOrderLensDeployer();
+    await deployer.deploy();
+}
+
+if (require.main === module) {
+    main().catch(console.error);
+}
+
+module.exports = { BridgeOrderLensDeployer };
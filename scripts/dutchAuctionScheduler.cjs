@@ -0,0 +1,353 @@
+#!/usr/bin/env node
+
+/**
+ * ⏱️ ANALYTIC DUTCH AUCTION BID SCHEDULER
+ *
+ * Replaces fixed-interval auction polling with a closed-form solve:
+ * ✅ Integer (BigInt) mirrors of each contract's on-chain decay curve
+ * ✅ Earliest timestamp/block where the price crosses our reservation price
+ * ✅ One timer per auction, armed for the slot before the target block
+ * ✅ Late-bid guard: never submits once the bid window has closed
+ *
+ * Supported curves (see CURVES below):
+ *   enhancedCrossChainResolver  EnhancedCrossChainResolver.getCurrentAuctionPrice / placeBid
+ *   enhanced1inchStyleBridge    Enhanced1inchStyleBridge.getCurrentAuctionPrice
+ *   algorandHTLCBridge          AlgorandHTLCBridge.placeBid / getCurrentAuctionPrice
+ *   piecewise                   EnhancedCrossChainResolver / Enhanced1inchStyleBridge with a packed curve
+ *   algorandHTLCBridgeCurve     AlgorandHTLCBridge auctions started with startDutchAuctionWithCurve
+ *   linear                      generic startPrice → endPrice over [startTime, endTime] (relayer-side auctions)
+ */
+
+const { EventEmitter } = require('events');
+const auctionCurve = require('./auctionCurve.cjs');
+
+const GWEI = 1000000000n;
+
+const toBigInt = (value) => typeof value === 'bigint' ? value : BigInt(value);
+const ceilDiv = (a, b) => (a + b - 1n) / b;
+
+/**
+ * Linear decay used by EnhancedCrossChainResolver:
+ *   t <  start → startPrice
+ *   t >= end   → endPrice
+ *   otherwise  → startPrice - (startPrice - endPrice) * (t - start) / (end - start)
+ * placeBid requires start <= t < end and bid >= price(t).
+ */
+const linearCurve = {
+    priceAt({ startTime, endTime, startPrice, endPrice }, t) {
+        const now = toBigInt(t);
+        const start = toBigInt(startTime);
+        const end = toBigInt(endTime);
+        if (now < start) return toBigInt(startPrice);
+        if (now >= end) return toBigInt(endPrice);
+        const range = toBigInt(startPrice) - toBigInt(endPrice);
+        return toBigInt(startPrice) - (range * (now - start)) / (end - start);
+    },
+
+    /**
+     * Window of timestamps where a bid of `reservation` is accepted (price <= reservation).
+     * floor(range * e / d) >= startPrice - R  ⇔  e >= ceil((startPrice - R) * d / range)
+     */
+    bidWindow({ startTime, endTime, startPrice, endPrice }, reservation) {
+        const start = toBigInt(startTime);
+        const end = toBigInt(endTime);
+        const high = toBigInt(startPrice);
+        const low = toBigInt(endPrice);
+        const r = toBigInt(reservation);
+
+        if (r < low) return null;
+        if (r >= high) return { openAt: start, closeAt: end - 1n };
+
+        const elapsed = ceilDiv((high - r) * (end - start), high - low);
+        const openAt = start + elapsed;
+        return openAt < end ? { openAt, closeAt: end - 1n } : null;
+    }
+};
+
+const CURVES = {
+    linear: linearCurve,
+
+    enhancedCrossChainResolver: linearCurve,
+
+    /**
+     * Enhanced1inchStyleBridge: fixed INITIAL_GAS_PRICE → MIN_GAS_PRICE over `duration`,
+     * dropping straight to MIN_GAS_PRICE once elapsed >= duration.
+     */
+    enhanced1inchStyleBridge: {
+        INITIAL_GAS_PRICE: 50n * GWEI,
+        MIN_GAS_PRICE: 5n * GWEI,
+
+        priceAt({ startTime, duration }, t) {
+            const elapsed = toBigInt(t) - toBigInt(startTime);
+            const d = toBigInt(duration);
+            if (elapsed >= d) return this.MIN_GAS_PRICE;
+            const range = this.INITIAL_GAS_PRICE - this.MIN_GAS_PRICE;
+            return this.INITIAL_GAS_PRICE - (range * elapsed) / d;
+        },
+
+        bidWindow({ startTime, duration }, reservation) {
+            const start = toBigInt(startTime);
+            const d = toBigInt(duration);
+            const r = toBigInt(reservation);
+            if (r < this.MIN_GAS_PRICE) return null;
+            if (r >= this.INITIAL_GAS_PRICE) return { openAt: start, closeAt: null };
+
+            const range = this.INITIAL_GAS_PRICE - this.MIN_GAS_PRICE;
+            const elapsed = ceilDiv((this.INITIAL_GAS_PRICE - r) * d, range);
+            // Once elapsed >= duration the price is MIN_GAS_PRICE <= r anyway
+            return { openAt: start + (elapsed < d ? elapsed : d), closeAt: null };
+        }
+    },
+
+    /**
+     * AlgorandHTLCBridge: price = startPrice - elapsed * GAS_PRICE_DECAY_RATE / 3600,
+     * floored at MIN_GAS_PRICE. A bid of gasPrice g is accepted while
+     * MIN_GAS_PRICE <= g <= price(t) and t < endTime, so the window closes
+     * (rather than opens) when the price crosses g.
+     */
+    algorandHTLCBridge: {
+        GAS_PRICE_DECAY_RATE: 45n,
+        MIN_GAS_PRICE: 5n * GWEI,
+
+        priceAt({ startTime, startPrice }, t) {
+            const elapsed = toBigInt(t) - toBigInt(startTime);
+            const decay = (elapsed * this.GAS_PRICE_DECAY_RATE) / 3600n;
+            const start = toBigInt(startPrice);
+            return start > decay ? start - decay : this.MIN_GAS_PRICE;
+        },
+
+        bidWindow({ startTime, endTime, startPrice }, reservation) {
+            const start = toBigInt(startTime);
+            const end = toBigInt(endTime);
+            const g = toBigInt(reservation);
+            const high = toBigInt(startPrice);
+            if (g < this.MIN_GAS_PRICE || g > high) return null;
+
+            // Largest elapsed with floor(e * rate / 3600) <= high - g
+            const maxElapsed = ((high - g + 1n) * 3600n - 1n) / this.GAS_PRICE_DECAY_RATE;
+            const lastValid = start + maxElapsed;
+            return { openAt: start, closeAt: lastValid < end - 1n ? lastValid : end - 1n };
+        }
+    },
+
+    /**
+     * Packed piecewise-linear curve (AuctionCurveLib) over basePrice, bid accepted
+     * while price <= reservation. baseFee is the expected block.basefee (0 = no gas bump).
+     */
+    piecewise: {
+        priceAt({ startTime, endTime, basePrice, curve, baseFee = 0n }, t) {
+            return auctionCurve.priceAt(curve, basePrice, startTime, endTime, t, baseFee);
+        },
+
+        bidWindow({ startTime, endTime, basePrice, curve, baseFee = 0n }, reservation) {
+            const end = toBigInt(endTime);
+            const openAt = auctionCurve.firstTimeAtOrBelow(curve, basePrice, startTime, end, reservation, baseFee);
+            return openAt !== null && openAt < end ? { openAt, closeAt: end - 1n } : null;
+        }
+    },
+
+    /**
+     * AlgorandHTLCBridge with a curve: price = MIN_GAS_PRICE scaled by the rate bump,
+     * bid g accepted while MIN_GAS_PRICE <= g <= price(t) and t < endTime.
+     */
+    algorandHTLCBridgeCurve: {
+        MIN_GAS_PRICE: 5n * GWEI,
+
+        priceAt({ startTime, endTime, curve, baseFee = 0n }, t) {
+            return auctionCurve.priceAt(curve, this.MIN_GAS_PRICE, startTime, endTime, t, baseFee);
+        },
+
+        bidWindow({ startTime, endTime, curve, baseFee = 0n }, reservation) {
+            const start = toBigInt(startTime);
+            const end = toBigInt(endTime);
+            const g = toBigInt(reservation);
+            if (g < this.MIN_GAS_PRICE || g > this.priceAt({ startTime, endTime, curve, baseFee }, start)) return null;
+
+            // Price never rises: the window closes the second before it drops below g
+            const below = auctionCurve.firstTimeAtOrBelow(curve, this.MIN_GAS_PRICE, start, end, g - 1n, baseFee);
+            const lastValid = below === null ? end - 1n : below - 1n;
+            return { openAt: start, closeAt: lastValid < end - 1n ? lastValid : end - 1n };
+        }
+    }
+};
+
+/**
+ * Maps chain timestamps to block numbers from one anchor block.
+ * Post-merge Ethereum produces a block every `slotSeconds` (12s on Sepolia/mainnet).
+ */
+class BlockClock {
+    constructor(provider, slotSeconds = 12) {
+        this.provider = provider;
+        this.slotSeconds = slotSeconds;
+        this.anchor = null;          // { number, timestamp }
+        this.offsetMs = 0;           // chain time - local time
+    }
+
+    async sync() {
+        const block = await this.provider.getBlock('latest');
+        this.anchor = { number: Number(block.number), timestamp: Number(block.timestamp) };
+        this.offsetMs = this.anchor.timestamp * 1000 - Date.now();
+        return this.anchor;
+    }
+
+    chainNow() {
+        return (Date.now() + this.offsetMs) / 1000;
+    }
+
+    timestampOf(blockNumber) {
+        return this.anchor.timestamp + (blockNumber - this.anchor.number) * this.slotSeconds;
+    }
+
+    /** First block whose timestamp is >= `timestamp`. */
+    blockAtOrAfter(timestamp) {
+        const delta = Number(timestamp) - this.anchor.timestamp;
+        return this.anchor.number + Math.max(0, Math.ceil(delta / this.slotSeconds));
+    }
+
+    /** Local wall-clock ms at which a chain timestamp occurs. */
+    localMsOf(timestamp) {
+        return timestamp * 1000 - this.offsetMs;
+    }
+}
+
+class DutchAuctionScheduler extends EventEmitter {
+    /**
+     * @param {object} provider  ethers provider (only getBlock('latest') is used)
+     * @param {object} options   { slotSeconds, propagationMs, resyncBeforeFireMs }
+     */
+    constructor(provider, options = {}) {
+        super();
+        this.clock = new BlockClock(provider, options.slotSeconds || parseInt(process.env.AUCTION_SLOT_SECONDS || '12'));
+        this.propagationMs = options.propagationMs ?? 1000;    // after previous block, before target block
+        this.resyncBeforeFireMs = options.resyncBeforeFireMs ?? 30000;
+        this.scheduled = new Map();  // key -> { timer, plan }
+    }
+
+    static curve(name) {
+        const curve = CURVES[name];
+        if (!curve) throw new Error(`Unknown auction curve: ${name}`);
+        return curve;
+    }
+
+    static priceAt(curveName, params, timestamp) {
+        return DutchAuctionScheduler.curve(curveName).priceAt(params, timestamp);
+    }
+
+    /**
+     * Solve the bid plan without arming anything.
+     * Returns null when the reservation price is never reachable.
+     */
+    plan(curveName, params, reservation) {
+        const window = DutchAuctionScheduler.curve(curveName).bidWindow(params, reservation);
+        if (!window) return null;
+
+        const openAt = Number(window.openAt);
+        const closeAt = window.closeAt === null ? Infinity : Number(window.closeAt);
+        const targetBlock = this.clock.blockAtOrAfter(Math.max(openAt, Math.ceil(this.clock.chainNow())));
+        const targetTimestamp = this.clock.timestampOf(targetBlock);
+        if (targetTimestamp > closeAt) return null;
+
+        return {
+            curve: curveName,
+            openAt,
+            closeAt,
+            targetBlock,
+            targetTimestamp,
+            expectedPrice: DutchAuctionScheduler.priceAt(curveName, params, targetTimestamp),
+            // Broadcast just after block (target - 1) so the tx lands in the target block
+            fireAtMs: this.clock.localMsOf(targetTimestamp - this.clock.slotSeconds) + this.propagationMs
+        };
+    }
+
+    /**
+     * Arm a one-shot timer that calls `submit(plan)` for the target block.
+     * Re-scheduling the same key replaces the previous timer.
+     */
+    async schedule(key, curveName, params, reservation, submit) {
+        this.cancel(key);
+        if (!this.clock.anchor) await this.clock.sync();
+
+        const plan = this.plan(curveName, params, reservation);
+        if (!plan) {
+            this.emit('unreachable', { key, curve: curveName, reservation });
+            return null;
+        }
+
+        const arm = (currentPlan) => {
+            const delay = Math.max(0, currentPlan.fireAtMs - Date.now());
+            // Long waits: wake once early to re-anchor the block clock, then re-solve
+            if (delay > this.resyncBeforeFireMs * 2) {
+                const timer = setTimeout(async () => {
+                    try {
+                        await this.clock.sync();
+                    } catch (error) {
+                        this.emit('error', { key, error });
+                    }
+                    const refreshed = this.plan(curveName, params, reservation);
+                    if (!refreshed) {
+                        this.scheduled.delete(key);
+                        this.emit('missed', { key, plan: currentPlan });
+                        return;
+                    }
+                    arm(refreshed);
+                }, delay - this.resyncBeforeFireMs);
+                this.scheduled.set(key, { timer, plan: currentPlan });
+                return;
+            }
+
+            const timer = setTimeout(async () => {
+                this.scheduled.delete(key);
+                // Late-bid guard: next block would already be outside the window
+                const nextBlockTs = this.clock.timestampOf(this.clock.blockAtOrAfter(Math.ceil(this.clock.chainNow())));
+                if (nextBlockTs > currentPlan.closeAt) {
+                    this.emit('missed', { key, plan: currentPlan });
+                    return;
+                }
+                try {
+                    const result = await submit(currentPlan);
+                    this.emit('submitted', { key, plan: currentPlan, result });
+                } catch (error) {
+                    this.emit('error', { key, plan: currentPlan, error });
+                }
+            }, delay);
+            this.scheduled.set(key, { timer, plan: currentPlan });
+        };
+
+        arm(plan);
+        this.emit('scheduled', { key, plan });
+        return plan;
+    }
+
+    cancel(key) {
+        const entry = this.scheduled.get(key);
+        if (entry) {
+            clearTimeout(entry.timer);
+            this.scheduled.delete(key);
+        }
+        return Boolean(entry);
+    }
+
+    cancelAll() {
+        for (const key of [...this.scheduled.keys()]) this.cancel(key);
+    }
+
+    pending() {
+        return [...this.scheduled.entries()].map(([key, { plan }]) => ({ key, ...plan }));
+    }
+}
+
+if (require.main === module) {
+    // Offline demo: a 180s EnhancedCrossChainResolver auction, 1000 → 900
+    const params = { startTime: 1_700_000_000, endTime: 1_700_000_180, startPrice: 1000n, endPrice: 900n };
+    const reservation = 955n;
+    const window = CURVES.enhancedCrossChainResolver.bidWindow(params, reservation);
+
+    console.log('⏱️ DUTCH AUCTION SCHEDULER (offline)');
+    console.log('====================================');
+    console.log(`📉 Curve: 1000 → 900 over 180s, reservation ${reservation}`);
+    console.log(`🎯 Earliest timestamp: ${window.openAt} (+${window.openAt - BigInt(params.startTime)}s)`);
+    console.log(`🏷️ Price at open: ${CURVES.enhancedCrossChainResolver.priceAt(params, window.openAt)}`);
+    console.log(`🏷️ Price 1s before: ${CURVES.enhancedCrossChainResolver.priceAt(params, window.openAt - 1n)}`);
+}
+
+module.exports = { DutchAuctionScheduler, BlockClock, CURVES };
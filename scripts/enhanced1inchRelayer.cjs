@@ -12,6 +12,7 @@
 
 const { ethers } = require('ethers');
 const algosdk = require('algosdk');
+const { ESCROW_ABI, ESCROW_DEPLOYED_EVENT, findEscrowImmutables } = require('./escrowAddressPredictor.cjs');
 
 class Enhanced1inchRelayer {
     constructor() {
@@ -81,19 +82,12 @@ class Enhanced1inchRelayer {
             'function addressOfEscrowSrc(bytes32 orderHash) external view returns (address)',
             'function isValidResolver(address resolver) external view returns (bool)',
             'event EscrowCreated(bytes32 indexed orderHash, address indexed escrow, address indexed token, uint256 amount)',
-            'event EscrowResolved(address indexed escrow, bytes32 secret)'
+            'event EscrowResolved(address indexed escrow, bytes32 secret)',
+            ESCROW_DEPLOYED_EVENT
         ];
         
-        // Individual Escrow Contract ABI  
-        const escrowABI = [
-            'function resolve(bytes32 secret) external',
-            'function refund() external',
-            'function deadline() external view returns (uint256)',
-            'function resolved() external view returns (bool)',
-            'function refunded() external view returns (bool)',
-            'function orderHash() external view returns (bytes32)',
-            'function hashlock() external view returns (bytes32)'
-        ];
+        // Individual Escrow Contract ABI (clones: resolve/refund take the immutables)
+        const escrowABI = ESCROW_ABI;
         
         // LOP Bridge ABI (minimal for monitoring)
         const lopBridgeABI = [
@@ -276,10 +270,13 @@ class Enhanced1inchRelayer {
             console.log(`⏰ Escrow deadline: ${new Date(escrowParams.deadline * 1000).toISOString()}`);
             
             // Check if escrow already exists
+            let immutables;
             const existingEscrow = await this.escrowFactory.getEscrow(orderId);
             if (existingEscrow !== ethers.ZeroAddress) {
                 console.log(`✅ Escrow already exists: ${existingEscrow}`);
                 console.log('🔄 Proceeding with existing escrow...');
+                immutables = await findEscrowImmutables(this.escrowFactory, orderId);
+                if (!immutables) throw new Error(`No EscrowDeployed log for ${orderId}`);
             } else {
                 // Create new escrow
                 console.log('🏭 Creating new escrow via 1inch factory...');
@@ -305,6 +302,13 @@ class Enhanced1inchRelayer {
                 // Get escrow address from event
                 const escrowAddress = await this.escrowFactory.getEscrow(orderId);
                 console.log(`🏠 Deterministic escrow address: ${escrowAddress}`);
+                immutables = {
+                    orderHash: escrowParams.orderHash,
+                    creator: this.wallet.address,
+                    token: escrowParams.token,
+                    amount: escrowParams.amount,
+                    deadline: escrowParams.deadline
+                };
             }
             
             // 4. PLACE BID ON ORIGINAL ORDER
@@ -317,8 +321,9 @@ class Enhanced1inchRelayer {
             this.activeEscrows.set(orderId, {
                 escrowAddress: await this.escrowFactory.getEscrow(orderId),
                 orderHash: orderId,
-                amount: escrowParams.amount,
-                deadline: escrowParams.deadline,
+                amount: immutables.amount,
+                deadline: Number(immutables.deadline),
+                immutables,
                 created: Date.now(),
                 orderParams
             });
@@ -404,10 +409,17 @@ class Enhanced1inchRelayer {
                 this.wallet
             );
             
-            // Check if already refunded
-            const isRefunded = await escrowContract.refunded();
-            if (isRefunded) {
-                console.log('✅ Escrow already refunded');
+            // Check if already settled
+            const [isRefunded, isResolved] = await Promise.all([escrowContract.refunded(), escrowContract.resolved()]);
+            if (isRefunded || isResolved) {
+                console.log(`✅ Escrow already ${isRefunded ? 'refunded' : 'resolved'}`);
+                this.activeEscrows.delete(orderHash);
+                return;
+            }
+            
+            // Only the escrow creator can refund
+            if (escrowInfo.immutables.creator.toLowerCase() !== this.wallet.address.toLowerCase()) {
+                console.log(`ℹ️  Escrow created by ${escrowInfo.immutables.creator} - refund is theirs`);
                 this.activeEscrows.delete(orderHash);
                 return;
             }
@@ -415,7 +427,7 @@ class Enhanced1inchRelayer {
             console.log(`🏠 Refunding escrow: ${escrowInfo.escrowAddress}`);
             console.log(`💰 Amount: ${ethers.formatEther(escrowInfo.amount)} ETH`);
             
-            const refundTx = await escrowContract.refund({
+            const refundTx = await escrowContract.refund(escrowInfo.immutables, {
                 gasLimit: 200000
             });
             
@@ -460,7 +472,7 @@ class Enhanced1inchRelayer {
             console.log(`🏠 Resolving escrow: ${escrowInfo.escrowAddress}`);
             console.log(`🔓 With secret: ${secret}`);
             
-            const resolveTx = await escrowContract.resolve(secret, {
+            const resolveTx = await escrowContract.resolve(secret, escrowInfo.immutables, {
                 gasLimit: 200000
             });
             
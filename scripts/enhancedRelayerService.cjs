@@ -9,6 +9,8 @@
 const { ethers } = require('hardhat');
 const algosdk = require('algosdk');
 const fs = require('fs');
+const { SecretStore } = require('./secretStore.cjs');
+const { BoxHTLCClient } = require('./algorandBoxHTLC.cjs');
 
 class EnhancedRelayerService {
     constructor() {
@@ -35,7 +37,7 @@ class EnhancedRelayerService {
             },
             algorand: {
                 rpcUrl: 'https://testnet-api.algonode.cloud',
-                applicationId: 1001, // Will be updated from deployment
+                applicationId: parseInt(process.env.ALGORAND_BOX_HTLC_APP_ID || '1001', 10), // AlgorandBoxHTLCBridge
                 relayerMnemonic: process.env.ALGORAND_MNEMONIC,
                 relayerAddress: process.env.ALGORAND_ACCOUNT_ADDRESS
             }
@@ -76,6 +78,12 @@ class EnhancedRelayerService {
             this.ethWallet
         );
         
+        // Revealed secrets, recovered from SecretRevealed logs when the bridge is event-only
+        this.secretStore = new SecretStore();
+        
+        // Algorand side: one box per HTLC, keyed by the Ethereum htlcId
+        this.algoHTLC = new BoxHTLCClient(this.algoClient, this.config.algorand.applicationId, this.algoAccount);
+        
         console.log('✅ Smart contracts loaded');
     }
     
@@ -167,50 +175,23 @@ class EnhancedRelayerService {
         console.log('==========================================\n');
         
         try {
-            // Get Algorand transaction parameters
-            const suggestedParams = await this.algoClient.getTransactionParams().do();
-            
-            // Fix parameters if needed
-            const status = await this.algoClient.status().do();
-            const currentRound = status['last-round'];
-            
-            const txnParams = {
-                fee: suggestedParams.fee || 1000,
-                firstRound: suggestedParams.firstRound || currentRound,
-                lastRound: suggestedParams.lastRound || (currentRound + 1000),
-                genesisID: suggestedParams.genesisID || 'testnet-v1.0',
-                genesisHash: suggestedParams.genesisHash
-            };
-            
-            // Create HTLC on Algorand (relayer pays fees)
-            const algoHTLCTxn = algosdk.makeApplicationNoOpTxnFromObject({
-                from: this.algoAccount.addr,
-                suggestedParams: txnParams,
-                appIndex: this.config.algorand.applicationId,
-                appArgs: [
-                    new Uint8Array(Buffer.from('create_htlc')),
-                    new Uint8Array(Buffer.from(ethHTLC.hashlock.slice(2), 'hex')), // Same hashlock
-                    algosdk.encodeUint64(ethHTLC.algorandAmount), // Converted amount
-                    algosdk.encodeUint64(parseInt(ethHTLC.timelock.toString())), // Same timelock
-                    new Uint8Array(Buffer.from(ethHTLC.algorandAddress))
-                ]
-            });
-            
-            // Sign and submit (relayer pays fees)
+            // Lock ALGO under the Ethereum htlcId (relayer funds it and pays fees)
             console.log('💰 RELAYER PAYING ALGORAND FEES...');
-            const signedTxn = algoHTLCTxn.signTxn(this.algoAccount.sk);
-            const txn = await this.algoClient.sendRawTransaction(signedTxn).do();
-            
-            // Wait for confirmation
-            await algosdk.waitForConfirmation(this.algoClient.sendRawTransaction, txn.txId, 4);
+            const txn = await this.algoHTLC.create({
+                htlcId: ethHTLC.htlcId,
+                hashlock: ethHTLC.hashlock, // Same hashlock
+                timelock: parseInt(ethHTLC.timelock.toString()), // Same timelock
+                recipient: ethHTLC.algorandAddress,
+                amount: ethHTLC.algorandAmount // Converted amount
+            });
             
             console.log('✅ ALGORAND HTLC CREATED SUCCESSFULLY!');
             console.log(`   Transaction ID: ${txn.txId}`);
             console.log('✅ ALGO securely locked on Algorand');
             console.log('✅ Gasless for user - relayer paid fees');
             
-            // Store mapping for tracking
-            this.storeHTLCMapping(ethHTLC.htlcId, txn.txId);
+            // Store mapping for tracking (the box key is the Ethereum htlcId)
+            this.storeHTLCMapping(ethHTLC.htlcId, ethHTLC.htlcId);
             
             // Start monitoring for secret reveal
             this.monitorSecretReveal(ethHTLC.htlcId);
@@ -251,9 +232,9 @@ class EnhancedRelayerService {
                 console.log(`   Recipient: ${recipient}`);
                 console.log('✅ Ethereum side completed');
                 
-                // Get the revealed secret
-                const secret = await this.ethContract.getRevealedSecret(htlcId);
-                if (secret !== ethers.ZeroHash) {
+                // Get the revealed secret (event log, or storage on older bridges)
+                const secret = await this.secretStore.resolve(this.ethContract, htlcId);
+                if (secret) {
                     await this.completeAlgorandSide(htlcId, secret);
                 }
             }
@@ -275,40 +256,11 @@ class EnhancedRelayerService {
         
         try {
             // Get Algorand HTLC ID from mapping
-            const algoHTLCId = this.getAlgorandHTLCId(ethHTLCId);
+            const algoHTLCId = this.getAlgorandHTLCId(ethHTLCId) || ethHTLCId;
             
-            // Get transaction parameters
-            const suggestedParams = await this.algoClient.getTransactionParams().do();
-            const status = await this.algoClient.status().do();
-            const currentRound = status['last-round'];
-            
-            const txnParams = {
-                fee: suggestedParams.fee || 1000,
-                firstRound: suggestedParams.firstRound || currentRound,
-                lastRound: suggestedParams.lastRound || (currentRound + 1000),
-                genesisID: suggestedParams.genesisID || 'testnet-v1.0',
-                genesisHash: suggestedParams.genesisHash
-            };
-            
-            // Create claim transaction
-            const claimTxn = algosdk.makeApplicationNoOpTxnFromObject({
-                from: this.algoAccount.addr,
-                suggestedParams: txnParams,
-                appIndex: this.config.algorand.applicationId,
-                appArgs: [
-                    new Uint8Array(Buffer.from('claim_htlc')),
-                    new Uint8Array(Buffer.from(algoHTLCId)),
-                    new Uint8Array(Buffer.from(secret.slice(2), 'hex'))
-                ]
-            });
-            
-            // Sign and submit (relayer pays fees)
+            // Claim with the revealed secret (relayer pays fees for both inner payments)
             console.log('💰 RELAYER PAYING ALGORAND CLAIM FEES...');
-            const signedTxn = claimTxn.signTxn(this.algoAccount.sk);
-            const txn = await this.algoClient.sendRawTransaction(signedTxn).do();
-            
-            // Wait for confirmation
-            await algosdk.waitForConfirmation(this.algoClient, txn.txId, 4);
+            const txn = await this.algoHTLC.claim(algoHTLCId, secret);
             
             console.log('✅ ALGORAND SIDE COMPLETED!');
             console.log(`   Claim Transaction: ${txn.txId}`);
@@ -411,8 +363,12 @@ class EnhancedRelayerService {
     }
     
     async verifyAlgorandCompletion(htlcId) {
-        // Check Algorand HTLC status
-        return true; // Simplified for demo
+        // Claimed or refunded HTLCs have their box deleted
+        try {
+            return (await this.algoHTLC.get(htlcId)) === null;
+        } catch {
+            return false;
+        }
     }
     
     logSuccessfulSwap(swapData) {
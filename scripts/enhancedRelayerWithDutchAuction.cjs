@@ -11,6 +11,7 @@
  */
 
 const { ethers } = require('ethers');
+const { DutchAuctionScheduler, CURVES } = require('./dutchAuctionScheduler.cjs');
 
 class EnhancedDutchAuctionRelayer {
     constructor() {
@@ -74,6 +75,11 @@ class EnhancedDutchAuctionRelayer {
         this.partialFillTracker = new Map();
         this.currentBlock = 0;
         
+        // Bids are armed for the exact block the auction price crosses our reservation
+        this.bidScheduler = new DutchAuctionScheduler(this.provider);
+        this.bidScheduler.on('missed', ({ key }) => console.log(`⚠️  Bid window closed before submission: ${key.slice(0, 10)}...`));
+        this.bidScheduler.on('error', ({ key, error }) => console.log(`⚠️  Scheduled bid failed for ${key.slice(0, 10)}: ${error.message}`));
+        
         console.log('🏆 ENHANCED RELAYER CONFIGURATION:');
         console.log('=================================');
         console.log(`🌐 Ethereum RPC: ${this.config.ethereum.rpcUrl}`);
@@ -171,7 +177,6 @@ class EnhancedDutchAuctionRelayer {
         setInterval(async () => {
             try {
                 await this.scanForNewOrders();
-                await this.processDutchAuctionBids();
             } catch (error) {
                 console.log(`⚠️  Monitoring error: ${error.message}`);
             }
@@ -236,8 +241,7 @@ class EnhancedDutchAuctionRelayer {
                 ...orderParams,
                 detectedAt: currentTime,
                 auctionStartTime: currentTime,
-                lastBidTime: 0,
-                optimalBidTime: currentTime + (this.config.relayer.dutchAuction.duration * 0.3) // 30% into auction
+                lastBidTime: 0
             });
             
             // Calculate dutch auction price
@@ -260,6 +264,9 @@ class EnhancedDutchAuctionRelayer {
             console.log('\n🏭 Creating 1inch escrow for dutch auction...');
             await this.createEscrowForDutchAuction(orderId, orderParams);
             
+            // Arm a single timer for the block where the price reaches our reservation
+            await this.scheduleDutchAuctionBid(orderId);
+            
             console.log('✅ Order ready for dutch auction bidding\n');
             
         } catch (error) {
@@ -321,65 +328,69 @@ class EnhancedDutchAuctionRelayer {
         }
     }
     
-    async processDutchAuctionBids() {
-        const currentTime = Math.floor(Date.now() / 1000);
+    auctionCurveParams(orderInfo) {
+        const { duration, initialGasPrice, minGasPrice } = this.config.relayer.dutchAuction;
+        return {
+            startTime: orderInfo.auctionStartTime,
+            endTime: orderInfo.auctionStartTime + duration,
+            startPrice: initialGasPrice,
+            endPrice: minGasPrice
+        };
+    }
+    
+    async scheduleDutchAuctionBid(orderId) {
+        const orderInfo = this.activeOrders.get(orderId);
+        if (!orderInfo) return null;
         
-        for (const [orderId, orderInfo] of this.activeOrders) {
-            try {
-                // Check if it's optimal time to bid
-                const timeIntoAuction = currentTime - orderInfo.auctionStartTime;
-                const auctionProgress = timeIntoAuction / this.config.relayer.dutchAuction.duration;
-                
-                // Skip if auction hasn't progressed enough or is too old
-                if (auctionProgress < 0.2 || auctionProgress > 1.0) continue;
-                
-                // Check if we haven't bid recently
-                if (currentTime - orderInfo.lastBidTime < 300) continue; // Wait 5 minutes between bids
-                
-                // Calculate current dutch auction price
-                const currentPrice = this.calculateDutchAuctionPrice(orderInfo.auctionStartTime, currentTime);
-                
-                console.log(`\n🏷️ DUTCH AUCTION BID OPPORTUNITY`);
-                console.log(`================================`);
-                console.log(`🆔 Order: ${orderId.slice(0, 10)}...`);
-                console.log(`⏰ Auction Progress: ${(auctionProgress * 100).toFixed(1)}%`);
-                console.log(`🏷️ Current Price: ${ethers.formatUnits(currentPrice, 'gwei')} gwei`);
-                
-                // Check existing bids
-                const existingBids = await this.lopBridge.getBids(orderId);
-                console.log(`📊 Existing Bids: ${existingBids.length}`);
-                
-                // Determine if we should bid
-                const shouldBid = this.shouldPlaceDutchAuctionBid(orderInfo, currentPrice, existingBids, auctionProgress);
-                
-                if (shouldBid) {
-                    await this.placeDutchAuctionBid(orderId, orderInfo, currentPrice);
-                    orderInfo.lastBidTime = currentTime;
-                } else {
-                    console.log('⏳ Waiting for better auction conditions...');
-                }
-                
-            } catch (error) {
-                console.log(`⚠️  Dutch auction processing error for ${orderId.slice(0, 10)}: ${error.message}`);
-            }
+        // Same threshold shouldPlaceDutchAuctionBid uses: 30% below the initial price
+        const reservation = this.config.relayer.dutchAuction.initialGasPrice * 7n / 10n;
+        
+        const plan = await this.bidScheduler.schedule(
+            orderId,
+            'linear',
+            this.auctionCurveParams(orderInfo),
+            reservation,
+            (bidPlan) => this.processScheduledBid(orderId, bidPlan)
+        );
+        
+        if (plan) {
+            console.log(`⏱️ Bid armed for block ${plan.targetBlock} (~${new Date(plan.targetTimestamp * 1000).toISOString()})`);
+            console.log(`🏷️ Expected auction price: ${ethers.formatUnits(plan.expectedPrice, 'gwei')} gwei`);
+        } else {
+            console.log('⏳ Reservation price not reachable within this auction');
         }
+        return plan;
     }
     
-    calculateDutchAuctionPrice(startTime, currentTime) {
-        const timeElapsed = currentTime - startTime;
-        const maxDuration = this.config.relayer.dutchAuction.duration;
+    async processScheduledBid(orderId, plan) {
+        const orderInfo = this.activeOrders.get(orderId);
+        if (!orderInfo) return;
         
-        // Clamp time elapsed to auction duration
-        const clampedTime = Math.min(timeElapsed, maxDuration);
+        const currentTime = Math.floor(Date.now() / 1000);
+        const auctionProgress = (currentTime - orderInfo.auctionStartTime) / this.config.relayer.dutchAuction.duration;
+        const currentPrice = this.calculateDutchAuctionPrice(orderInfo.auctionStartTime, plan.targetTimestamp);
         
-        // Calculate price decay (linear decay from initial to min)
-        const priceDecay = (this.config.relayer.dutchAuction.initialGasPrice - this.config.relayer.dutchAuction.minGasPrice) * 
-                          (clampedTime / maxDuration);
+        console.log(`\n🏷️ DUTCH AUCTION BID (block ${plan.targetBlock})`);
+        console.log(`================================`);
+        console.log(`🆔 Order: ${orderId.slice(0, 10)}...`);
+        console.log(`⏰ Auction Progress: ${(auctionProgress * 100).toFixed(1)}%`);
+        console.log(`🏷️ Current Price: ${ethers.formatUnits(currentPrice, 'gwei')} gwei`);
         
-        const currentPrice = this.config.relayer.dutchAuction.initialGasPrice - priceDecay;
+        // Single read at submission time instead of polling every interval
+        const existingBids = await this.lopBridge.getBids(orderId);
+        console.log(`📊 Existing Bids: ${existingBids.length}`);
         
-        return currentPrice > this.config.relayer.dutchAuction.minGasPrice ? 
-               currentPrice : this.config.relayer.dutchAuction.minGasPrice;
+        if (this.shouldPlaceDutchAuctionBid(orderInfo, currentPrice, existingBids, auctionProgress)) {
+            await this.placeDutchAuctionBid(orderId, orderInfo, currentPrice);
+            orderInfo.lastBidTime = currentTime;
+        } else {
+            console.log('⏳ Bid conditions no longer hold, skipping');
+        }
+    }
+    
+    calculateDutchAuctionPrice(startTime, currentTime) {
+        // Integer evaluation of the same linear curve the scheduler solves against
+        return CURVES.linear.priceAt(this.auctionCurveParams({ auctionStartTime: startTime }), currentTime);
     }
     
     calculateOptimalPartialFill(orderParams) {
@@ -400,7 +411,7 @@ class EnhancedDutchAuctionRelayer {
         // 4. The auction progress suggests good timing
         
         const optimalWindow = auctionProgress >= 0.2 && auctionProgress <= 0.8;
-        const priceAttractive = currentPrice <= this.config.relayer.dutchAuction.initialGasPrice * 0.7; // 30% discount
+        const priceAttractive = currentPrice <= this.config.relayer.dutchAuction.initialGasPrice * 7n / 10n; // 30% discount
         const noActiveBid = !existingBids.some(bid => bid.resolver === this.wallet.address && bid.active);
         
         return optimalWindow && priceAttractive && noActiveBid;
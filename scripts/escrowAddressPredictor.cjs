@@ -0,0 +1,75 @@
+#!/usr/bin/env node
+
+/**
+ * 🧭 ESCROW ADDRESS PREDICTOR
+ *
+ * Off-chain twin of Official1inchEscrowFactory.addressOfEscrow():
+ * ✅ EIP-1167 proxy bytecode hash for the factory's implementation (ProxyHashLib)
+ * ✅ CREATE2 salt = keccak256 of the five immutables words (EscrowImmutablesLib)
+ * ✅ Lets relayers pre-fund an escrow before createEscrow() is mined
+ * ✅ Escrow ABI and immutables lookup (EscrowDeployed event) for resolve()/refund()
+ */
+
+const { ethers } = require('ethers');
+
+const PROXY_PREFIX = '0x3d602d80600a3d3981f3363d3d373d3d3d363d73';
+const PROXY_SUFFIX = '0x5af43d82803e903d91602b57fd5bf3';
+
+// Clones keep no parameters: resolve()/refund() take the immutables back in
+const ESCROW_IMMUTABLES_TUPLE = 'tuple(bytes32 orderHash, address creator, address token, uint256 amount, uint256 deadline)';
+const ESCROW_ABI = [
+    `function resolve(bytes32 secret, ${ESCROW_IMMUTABLES_TUPLE} immutables) external`,
+    `function refund(${ESCROW_IMMUTABLES_TUPLE} immutables) external`,
+    'function resolved() external view returns (bool)',
+    'function refunded() external view returns (bool)'
+];
+const ESCROW_DEPLOYED_EVENT = `event EscrowDeployed(bytes32 indexed orderHash, address indexed escrow, ${ESCROW_IMMUTABLES_TUPLE} immutables)`;
+
+function proxyBytecodeHash(implementation) {
+    return ethers.keccak256(ethers.concat([PROXY_PREFIX, ethers.getAddress(implementation), PROXY_SUFFIX]));
+}
+
+/** immutables: { orderHash, creator, token, amount, deadline } */
+function escrowSalt(immutables) {
+    return ethers.keccak256(ethers.AbiCoder.defaultAbiCoder().encode(
+        ['bytes32', 'address', 'address', 'uint256', 'uint256'],
+        [immutables.orderHash, immutables.creator, immutables.token, immutables.amount, immutables.deadline]
+    ));
+}
+
+function predictEscrowAddress(factory, implementation, immutables) {
+    return ethers.getCreate2Address(factory, escrowSalt(immutables), proxyBytecodeHash(implementation));
+}
+
+/**
+ * Immutables of the escrow deployed for `orderHash`, rebuilt from the factory's
+ * EscrowDeployed log (factory ABI must include ESCROW_DEPLOYED_EVENT); null if none
+ */
+async function findEscrowImmutables(factory, orderHash, fromBlock = 0) {
+    const [event] = await factory.queryFilter(factory.filters.EscrowDeployed(orderHash), fromBlock);
+    if (!event) return null;
+    const { creator, token, amount, deadline } = event.args.immutables;
+    return { orderHash, creator, token, amount, deadline };
+}
+
+if (require.main === module) {
+    const [factory, implementation, orderHash, creator, amount, deadline] = process.argv.slice(2);
+    if (!deadline) {
+        console.log('Usage: node scripts/escrowAddressPredictor.cjs <factory> <implementation> <orderHash> <creator> <amountWei> <deadline>');
+        process.exit(1);
+    }
+    const address = predictEscrowAddress(factory, implementation, {
+        orderHash, creator, token: ethers.ZeroAddress, amount, deadline
+    });
+    console.log(`🧭 Escrow address: ${address}`);
+}
+
+module.exports = {
+    ESCROW_IMMUTABLES_TUPLE,
+    ESCROW_ABI,
+    ESCROW_DEPLOYED_EVENT,
+    proxyBytecodeHash,
+    escrowSalt,
+    predictEscrowAddress,
+    findEscrowImmutables
+};
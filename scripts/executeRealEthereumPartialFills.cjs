@@ -228,7 +228,7 @@ class RealEthereumPartialFills {
         
         try {
             const contractABI = [
-                "function getOrderSummary(bytes32) external view returns (uint256, uint256, uint256, uint256, bool, address[])"
+                "function getOrderSummary(bytes32) external view returns (uint256, uint256, uint256, uint256, bool, uint256)"
             ];
             
             const contract = new ethers.Contract(this.contractAddress, contractABI, this.ethProvider);
@@ -241,7 +241,8 @@ class RealEthereumPartialFills {
             console.log(`   ✅ Filled Amount: ${ethers.formatEther(summary[1])} ETH`);
             console.log(`   📋 Remaining: ${ethers.formatEther(summary[2])} ETH`);
             console.log(`   🔢 Fill Count: ${summary[3].toString()}`);
-            console.log(`   ✅ Fully Filled: ${summary[4]}\n`);
+            console.log(`   ✅ Fully Filled: ${summary[4]}`);
+            console.log(`   💰 Resolver Fees: ${ethers.formatEther(summary[5])} ETH\n`);
             
         } catch (error) {
             console.error('❌ Order verification failed:', error);
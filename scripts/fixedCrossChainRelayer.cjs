@@ -127,7 +127,11 @@ class FixedCrossChainRelayer {
             'function authorizedResolvers(address resolver) external view returns (bool)',
             'event LimitOrderCreated(bytes32 indexed orderId, address indexed maker, address makerToken, address takerToken, uint256 makerAmount, uint256 takerAmount, uint256 deadline, string algorandAddress, bytes32 hashlock, uint256 timelock)',
             'event BidPlaced(bytes32 indexed orderId, address indexed resolver, uint256 inputAmount, uint256 outputAmount, uint256 gasEstimate)',
-            'event OrderExecuted(bytes32 indexed orderId, address indexed resolver, bytes32 secret)'
+            'event OrderExecuted(bytes32 indexed orderId, address indexed resolver, bytes32 secret)',
+            'error OrderAlreadyFilled()',
+            'error OrderExpired()',
+            'error OutputTooLow()',
+            'error InputTooHigh()'
         ];
         
         this.limitOrderBridge = new ethers.Contract(
@@ -585,12 +589,13 @@ class FixedCrossChainRelayer {
         } catch (error) {
             console.error('❌ Error placing bid:', error.message);
             
-            // Check if it's a known error
-            if (error.message.includes('Order already filled')) {
+            // Check if it's a known error (custom errors decoded from the ABI)
+            const revertName = error.revert?.name;
+            if (revertName === 'OrderAlreadyFilled') {
                 console.log('⚠️  Order was filled by another resolver');
-            } else if (error.message.includes('Order expired')) {
+            } else if (revertName === 'OrderExpired') {
                 console.log('⚠️  Order has expired');
-            } else if (error.message.includes('Bid too low')) {
+            } else if (revertName === 'OutputTooLow' || revertName === 'InputTooHigh') {
                 console.log('⚠️  Our bid was not competitive enough');
             }
         }
@@ -0,0 +1,136 @@
+#!/usr/bin/env node
+
+/**
+ * 📣 ALGORAND HTLC EVENT DECODER
+ *
+ * Decodes the ARC-28 logs of the Algorand HTLC apps (contracts/algorand/HTLCEvents.py):
+ * ✅ 4-byte selector = SHA-512/256 of the event signature, then static ARC-4 fields
+ * ✅ Fixed layout per event: one length check, no application-args parsing
+ * ✅ A log is only present when the call succeeded, so events are final
+ * ✅ Reads algod block transactions (dt.lg) and indexer transactions (logs),
+ *    inner transactions included
+ *
+ * htlcKey is the 32-byte htlcId (box app), sha256(HtlcId) for the local-state
+ * apps (see legacyHtlcKey) or the hashlock for the partial fill apps.
+ */
+
+const crypto = require('crypto');
+const { decodeAlgorandAddress, encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+
+const FIELD_SIZES = { 'byte[32]': 32, address: 32, uint64: 8 };
+
+const EVENT_DEFINITIONS = {
+    HTLCCreated: [
+        ['htlcKey', 'byte[32]'], ['initiator', 'address'], ['recipient', 'address'],
+        ['hashlock', 'byte[32]'], ['amount', 'uint64'], ['timelock', 'uint64']
+    ],
+    HTLCClaimed: [
+        ['htlcKey', 'byte[32]'], ['recipient', 'address'], ['secret', 'byte[32]'], ['amount', 'uint64']
+    ],
+    HTLCRefunded: [
+        ['htlcKey', 'byte[32]'], ['initiator', 'address'], ['amount', 'uint64']
+    ],
+    HTLCPartiallyFilled: [
+        ['htlcKey', 'byte[32]'], ['resolver', 'address'], ['secret', 'byte[32]'],
+        ['fillAmount', 'uint64'], ['remaining', 'uint64']
+    ]
+};
+
+function eventSignature(name) {
+    return `${name}(${EVENT_DEFINITIONS[name].map(([, type]) => type).join(',')})`;
+}
+
+function eventSelector(name) {
+    return crypto.createHash('sha512-256').update(eventSignature(name)).digest().subarray(0, 4).toString('hex');
+}
+
+// selector hex -> { name, fields, size }
+const EVENTS_BY_SELECTOR = new Map(Object.keys(EVENT_DEFINITIONS).map(name => {
+    const fields = EVENT_DEFINITIONS[name];
+    const size = 4 + fields.reduce((total, [, type]) => total + FIELD_SIZES[type], 0);
+    return [eventSelector(name), { name, fields, size }];
+}));
+
+const toBuffer = (log) => typeof log === 'string' ? Buffer.from(log, 'base64') : Buffer.from(log);
+
+/**
+ * One log entry (bytes or base64) → { name, ...fields }, or null when it is not an HTLC event
+ */
+function decodeHtlcEvent(log) {
+    const bytes = toBuffer(log);
+    if (bytes.length < 4) return null;
+    const event = EVENTS_BY_SELECTOR.get(bytes.subarray(0, 4).toString('hex'));
+    if (!event || bytes.length !== event.size) return null;
+
+    const decoded = { name: event.name };
+    let offset = 4;
+    for (const [field, type] of event.fields) {
+        const value = bytes.subarray(offset, offset + FIELD_SIZES[type]);
+        if (type === 'uint64') decoded[field] = value.readBigUInt64BE();
+        else if (type === 'address') decoded[field] = encodeAlgorandAddress('0x' + value.toString('hex'));
+        else decoded[field] = '0x' + value.toString('hex');
+        offset += FIELD_SIZES[type];
+    }
+    return decoded;
+}
+
+/**
+ * HTLC events of a confirmed transaction, in log order, inner transactions last
+ */
+function decodeTransactionEvents(txn) {
+    const logs = txn.logs || (txn.dt && txn.dt.lg) || [];
+    const inner = txn['inner-txns'] || (txn.dt && txn.dt.itx) || [];
+    const events = [];
+    for (const log of logs) {
+        const event = decodeHtlcEvent(log);
+        if (event) events.push(event);
+    }
+    for (const innerTxn of inner) events.push(...decodeTransactionEvents(innerTxn));
+    return events;
+}
+
+/**
+ * htlcKey logged by the local-state apps for a free-form HtlcId
+ */
+function legacyHtlcKey(htlcId) {
+    const bytes = Buffer.isBuffer(htlcId) || htlcId instanceof Uint8Array ? Buffer.from(htlcId) : Buffer.from(String(htlcId));
+    return '0x' + crypto.createHash('sha256').update(bytes).digest('hex');
+}
+
+/**
+ * Log bytes for an event (tests and local tooling)
+ */
+function encodeHtlcEvent(name, values) {
+    const parts = [Buffer.from(eventSelector(name), 'hex')];
+    for (const [field, type] of EVENT_DEFINITIONS[name]) {
+        const value = values[field];
+        if (type === 'uint64') {
+            const word = Buffer.alloc(8);
+            word.writeBigUInt64BE(BigInt(value));
+            parts.push(word);
+        } else if (type === 'address') {
+            parts.push(Buffer.from(decodeAlgorandAddress(value).publicKey.slice(2), 'hex'));
+        } else {
+            parts.push(Buffer.from(String(value).replace(/^0x/, ''), 'hex'));
+        }
+    }
+    return Buffer.concat(parts);
+}
+
+if (require.main === module) {
+    console.log('📣 ALGORAND HTLC EVENTS');
+    console.log('=======================');
+    for (const [selector, { name, size }] of EVENTS_BY_SELECTOR) {
+        console.log(`   0x${selector}  ${eventSignature(name)}  ${size} bytes`);
+    }
+}
+
+module.exports = {
+    EVENT_DEFINITIONS,
+    eventSignature,
+    eventSelector,
+    decodeHtlcEvent,
+    decodeTransactionEvents,
+    encodeHtlcEvent,
+    legacyHtlcKey
+};
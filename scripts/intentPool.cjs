@@ -0,0 +1,295 @@
+#!/usr/bin/env node
+
+/**
+ * ⛽ GASLESS INTENT POOL
+ *
+ * Relayer-side pool for signed RelayedLimitOrders (EnhancedLimitOrderBridge):
+ * ✅ Signature checked once, on admission
+ * ✅ Deduped by maker + salt for as long as the intent can still be submitted
+ * ✅ Min-heap on deadline: expired intents drop out in O(log n), and each flush
+ *    takes the most urgent intents first
+ * ✅ Flushes in batches through submitRelayedLimitOrders, on size or timer
+ * ✅ Failed batches are requeued; skipped orders (RelayedOrderSkipped) are dropped
+ *
+ * Makers prefund with depositForRelayedOrders() once, then sign orders without
+ * sending transactions; many users' orders share one submission.
+ */
+
+const { EventEmitter } = require('events');
+
+const DEFAULT_MAX_BATCH = 40;
+const DEFAULT_FLUSH_INTERVAL_MS = 15000;
+const DEFAULT_DEADLINE_MARGIN = 60; // seconds: leave room for inclusion
+const DEFAULT_MAX_ATTEMPTS = 3;
+
+const RELAYED_ORDER_TYPES = {
+    RelayedLimitOrder: [
+        { name: 'intent', type: 'LimitOrderIntent' },
+        { name: 'hashlock', type: 'bytes32' },
+        { name: 'timelock', type: 'uint256' }
+    ],
+    LimitOrderIntent: [
+        { name: 'maker', type: 'address' },
+        { name: 'makerToken', type: 'address' },
+        { name: 'takerToken', type: 'address' },
+        { name: 'makerAmount', type: 'uint256' },
+        { name: 'takerAmount', type: 'uint256' },
+        { name: 'deadline', type: 'uint256' },
+        { name: 'algorandChainId', type: 'uint256' },
+        { name: 'algorandAddress', type: 'string' },
+        { name: 'salt', type: 'bytes32' },
+        { name: 'allowPartialFills', type: 'bool' },
+        { name: 'minPartialFill', type: 'uint256' }
+    ]
+};
+
+const RELAYED_SUBMIT_ABI = [
+    'function submitRelayedLimitOrders(tuple(tuple(address maker, address makerToken, address takerToken, uint256 makerAmount, uint256 takerAmount, uint256 deadline, uint256 algorandChainId, string algorandAddress, bytes32 salt, bool allowPartialFills, uint256 minPartialFill) intent, bytes32 hashlock, uint256 timelock, bytes signature)[] orders) external returns (bytes32[] orderIds)',
+    'function depositForRelayedOrders() external payable',
+    'function makerDeposits(address maker) external view returns (uint256)',
+    'event RelayedOrderSkipped(bytes32 indexed relayedHash, address indexed maker, bytes4 reason)'
+];
+
+/**
+ * Binary min-heap of { deadline, key }
+ */
+class DeadlineHeap {
+    constructor() {
+        this.items = [];
+    }
+
+    get size() {
+        return this.items.length;
+    }
+
+    peek() {
+        return this.items[0];
+    }
+
+    push(item) {
+        const items = this.items;
+        items.push(item);
+        let i = items.length - 1;
+        while (i > 0) {
+            const parent = (i - 1) >> 1;
+            if (items[parent].deadline <= item.deadline) break;
+            items[i] = items[parent];
+            i = parent;
+        }
+        items[i] = item;
+    }
+
+    pop() {
+        const items = this.items;
+        const top = items[0];
+        const last = items.pop();
+        if (items.length > 0) {
+            let i = 0;
+            for (;;) {
+                const left = 2 * i + 1;
+                if (left >= items.length) break;
+                const child = left + 1 < items.length && items[left + 1].deadline < items[left].deadline ? left + 1 : left;
+                if (items[child].deadline >= last.deadline) break;
+                items[i] = items[child];
+                i = child;
+            }
+            items[i] = last;
+        }
+        return top;
+    }
+}
+
+class IntentPool extends EventEmitter {
+    /**
+     * @param {object} options
+     * @param {function} options.recoverSigner   order => maker address that signed it (required)
+     * @param {function} [options.submit]        orders => Promise<{ orderIds, txHash }> (flush target)
+     * @param {function} [options.now]           () => chain seconds
+     * @param {number} [options.maxBatch]        orders per submission
+     * @param {number} [options.flushIntervalMs] timer flush period
+     * @param {number} [options.deadlineMargin]  seconds of deadline left required to submit
+     * @param {number} [options.maxAttempts]     submissions per intent before it is dropped
+     * Emits 'accepted', 'rejected', 'expired', 'submitted', 'dropped'.
+     */
+    constructor(options = {}) {
+        super();
+        if (!options.recoverSigner) throw new Error('IntentPool needs a recoverSigner');
+        this.recoverSigner = options.recoverSigner;
+        this.submit = options.submit || null;
+        this.now = options.now || (() => Math.floor(Date.now() / 1000));
+        this.maxBatch = options.maxBatch || DEFAULT_MAX_BATCH;
+        this.flushIntervalMs = options.flushIntervalMs || DEFAULT_FLUSH_INTERVAL_MS;
+        this.deadlineMargin = options.deadlineMargin ?? DEFAULT_DEADLINE_MARGIN;
+        this.maxAttempts = options.maxAttempts || DEFAULT_MAX_ATTEMPTS;
+
+        this.pending = new Map(); // key -> { key, order, deadline, attempts }
+        this.seen = new Map();    // key -> deadline, pending or submitted (dedupe)
+        this.heap = new DeadlineHeap();     // pending intents by deadline
+        this.seenHeap = new DeadlineHeap(); // dedupe keys by deadline
+        this.timer = null;
+        this.flushing = null;
+    }
+
+    static key(intent) {
+        return `${intent.maker.toLowerCase()}:${String(intent.salt).toLowerCase()}`;
+    }
+
+    /**
+     * Admit one signed order { intent, hashlock, timelock, signature }.
+     * @returns {{ accepted: boolean, key: string, reason?: string }}
+     */
+    add(order) {
+        const { intent } = order;
+        const key = IntentPool.key(intent);
+        const deadline = Number(intent.deadline);
+        const reject = (reason) => {
+            this.emit('rejected', { key, reason });
+            return { accepted: false, key, reason };
+        };
+
+        if (this.seen.has(key)) return reject('duplicate');
+        if (deadline <= this.now() + this.deadlineMargin) return reject('expired');
+        if (BigInt(intent.makerAmount) === 0n) return reject('zero amount');
+
+        let signer;
+        try {
+            signer = this.recoverSigner(order);
+        } catch (error) {
+            return reject(`bad signature: ${error.message}`);
+        }
+        if (!signer || signer.toLowerCase() !== intent.maker.toLowerCase()) return reject('signer is not the maker');
+
+        const entry = { key, order, deadline, attempts: 0 };
+        this.pending.set(key, entry);
+        this.seen.set(key, deadline);
+        this.heap.push({ deadline, key });
+        this.seenHeap.push({ deadline, key });
+        this.emit('accepted', { key, deadline });
+
+        if (this.pending.size >= this.maxBatch && this.submit) this.flush().catch(() => {});
+        return { accepted: true, key };
+    }
+
+    get size() {
+        return this.pending.size;
+    }
+
+    /**
+     * Drop intents that can no longer be submitted, and forget old dedupe keys
+     */
+    prune() {
+        const cutoff = this.now() + this.deadlineMargin;
+        let expired = 0;
+        while (this.heap.size > 0 && this.heap.peek().deadline <= cutoff) {
+            const { key } = this.heap.pop();
+            if (this.pending.delete(key)) {
+                expired++;
+                this.emit('expired', { key });
+            }
+        }
+        // Past its deadline the bridge rejects the intent anyway, so the key can go
+        const now = this.now();
+        while (this.seenHeap.size > 0 && this.seenHeap.peek().deadline <= now) {
+            this.seen.delete(this.seenHeap.pop().key);
+        }
+        return expired;
+    }
+
+    /**
+     * Remove and return up to maxBatch live entries, earliest deadline first
+     */
+    take(maxBatch = this.maxBatch) {
+        this.prune();
+        const batch = [];
+        while (batch.length < maxBatch && this.heap.size > 0) {
+            const { key } = this.heap.pop();
+            const entry = this.pending.get(key);
+            if (!entry) continue; // submitted or dropped since it was queued
+            this.pending.delete(key);
+            batch.push(entry);
+        }
+        return batch;
+    }
+
+    requeue(entries) {
+        for (const entry of entries) {
+            entry.attempts++;
+            if (entry.attempts >= this.maxAttempts) {
+                this.emit('dropped', { key: entry.key, reason: 'too many failed submissions' });
+                continue;
+            }
+            this.pending.set(entry.key, entry);
+            this.heap.push({ deadline: entry.deadline, key: entry.key });
+        }
+    }
+
+    /**
+     * Submit one batch. Failed submissions go back into the pool.
+     * @returns {Promise<object|null>} { keys, orderIds, txHash } or null when empty
+     */
+    async flush() {
+        if (this.flushing) return this.flushing;
+        const batch = this.take();
+        if (batch.length === 0) return null;
+
+        this.flushing = (async () => {
+            try {
+                const result = await this.submit(batch.map(entry => entry.order));
+                const keys = batch.map(entry => entry.key);
+                (result.orderIds || []).forEach((orderId, i) => {
+                    if (BigInt(orderId) === 0n) this.emit('dropped', { key: keys[i], reason: 'skipped on-chain' });
+                });
+                this.emit('submitted', { keys, ...result });
+                return { keys, ...result };
+            } catch (error) {
+                this.requeue(batch);
+                throw error;
+            } finally {
+                this.flushing = null;
+            }
+        })();
+        return this.flushing;
+    }
+
+    start() {
+        if (this.timer) return;
+        this.timer = setInterval(() => {
+            this.flush().catch(error => console.log(`⚠️ Intent pool flush failed: ${error.message}`));
+        }, this.flushIntervalMs);
+    }
+
+    stop() {
+        clearInterval(this.timer);
+        this.timer = null;
+    }
+}
+
+/**
+ * Pool wired to a bridge (ethers v6): EIP-712 recovery and submitRelayedLimitOrders
+ */
+function createBridgeIntentPool(bridge, domain, options = {}) {
+    const { ethers } = require('ethers');
+    return new IntentPool({
+        ...options,
+        recoverSigner: (order) => ethers.verifyTypedData(
+            domain,
+            RELAYED_ORDER_TYPES,
+            { intent: order.intent, hashlock: order.hashlock, timelock: order.timelock },
+            order.signature
+        ),
+        submit: async (orders) => {
+            const orderIds = await bridge.submitRelayedLimitOrders.staticCall(orders);
+            const tx = await bridge.submitRelayedLimitOrders(orders);
+            await tx.wait();
+            return { orderIds, txHash: tx.hash };
+        }
+    });
+}
+
+module.exports = {
+    IntentPool,
+    DeadlineHeap,
+    createBridgeIntentPool,
+    RELAYED_ORDER_TYPES,
+    RELAYED_SUBMIT_ABI
+};
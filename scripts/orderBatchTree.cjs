@@ -0,0 +1,190 @@
+#!/usr/bin/env node
+
+/**
+ * 🪜 ORDER BATCH TREE
+ *
+ * Maker-side tooling for EnhancedLimitOrderBridge batch orders:
+ * ✅ Leaves are the EIP-712 struct hashes of the LimitOrderIntents
+ * ✅ Sorted-pair Merkle tree (OpenZeppelin MerkleProof), built once
+ * ✅ One LimitOrderBatch(maker, root) signature covers every order
+ * ✅ submitLimitOrdersFromBatch argument lists in chunks that fit a block
+ *
+ * The first submission of a root checks the signature on-chain and caches it
+ * (approvedOrderRoots); later submissions may pass '0x' as the signature.
+ */
+
+const LIMIT_ORDER_INTENT_TYPES = {
+    LimitOrderIntent: [
+        { name: 'maker', type: 'address' },
+        { name: 'makerToken', type: 'address' },
+        { name: 'takerToken', type: 'address' },
+        { name: 'makerAmount', type: 'uint256' },
+        { name: 'takerAmount', type: 'uint256' },
+        { name: 'deadline', type: 'uint256' },
+        { name: 'algorandChainId', type: 'uint256' },
+        { name: 'algorandAddress', type: 'string' },
+        { name: 'salt', type: 'bytes32' },
+        { name: 'allowPartialFills', type: 'bool' },
+        { name: 'minPartialFill', type: 'uint256' }
+    ]
+};
+
+const LIMIT_ORDER_BATCH_TYPES = {
+    LimitOrderBatch: [
+        { name: 'maker', type: 'address' },
+        { name: 'root', type: 'bytes32' }
+    ]
+};
+
+const BATCH_SUBMIT_ABI = [
+    'function submitLimitOrderFromBatch(tuple(address maker, address makerToken, address takerToken, uint256 makerAmount, uint256 takerAmount, uint256 deadline, uint256 algorandChainId, string algorandAddress, bytes32 salt, bool allowPartialFills, uint256 minPartialFill) intent, bytes32 root, bytes32[] proof, bytes rootSignature, bytes32 hashlock, uint256 timelock) external payable returns (bytes32)',
+    'function submitLimitOrdersFromBatch(tuple(tuple(address maker, address makerToken, address takerToken, uint256 makerAmount, uint256 takerAmount, uint256 deadline, uint256 algorandChainId, string algorandAddress, bytes32 salt, bool allowPartialFills, uint256 minPartialFill) intent, bytes32[] proof, bytes32 hashlock, uint256 timelock)[] orders, bytes32 root, bytes rootSignature) external payable returns (bytes32[])',
+    'function approvedOrderRoots(address maker, bytes32 root) external view returns (bool)',
+    'event OrderRootApproved(address indexed maker, bytes32 indexed root)'
+];
+
+const DEFAULT_ORDERS_PER_TX = 25;
+
+let ethersLib = null;
+function ethers() {
+    if (!ethersLib) ethersLib = require('ethers').ethers;
+    return ethersLib;
+}
+
+function keccak256(data) {
+    return Buffer.from(ethers().keccak256(data).slice(2), 'hex');
+}
+
+function hashIntent(intent) {
+    const encoder = ethers().TypedDataEncoder.from(LIMIT_ORDER_INTENT_TYPES);
+    return Buffer.from(encoder.hashStruct('LimitOrderIntent', intent).slice(2), 'hex');
+}
+
+const toBuffer = (value) => Buffer.isBuffer(value)
+    ? value
+    : Buffer.from(String(value).replace(/^0x/, ''), 'hex');
+const toHex = (buffer) => '0x' + buffer.toString('hex');
+
+class OrderBatchTree {
+    /**
+     * @param {Array<object>} intents        LimitOrderIntents of one maker
+     * @param {object} [options]
+     * @param {function} [options.hash]       Buffer => Buffer node hash (defaults to keccak256 via ethers)
+     * @param {function} [options.hashIntent] intent => Buffer leaf (defaults to the EIP-712 struct hash)
+     */
+    constructor(intents, options = {}) {
+        if (intents.length === 0) throw new Error('An order batch needs at least one intent');
+        const makers = new Set(intents.map(intent => intent.maker.toLowerCase()));
+        if (makers.size !== 1) throw new Error('All intents of a batch must have the same maker');
+
+        this.hash = options.hash || keccak256;
+        this.hashIntent = options.hashIntent || hashIntent;
+        this.intents = intents;
+        this.maker = intents[0].maker;
+        this.leaves = intents.map(intent => toBuffer(this.hashIntent(intent)));
+        this.levels = this.build(this.leaves);
+    }
+
+    hashPair(a, b) {
+        return Buffer.compare(a, b) <= 0
+            ? this.hash(Buffer.concat([a, b]))
+            : this.hash(Buffer.concat([b, a]));
+    }
+
+    // levels[0] = leaves, last level = [root]; an odd node is carried up unchanged
+    build(leaves) {
+        const levels = [leaves];
+        let level = leaves;
+        while (level.length > 1) {
+            const next = new Array(Math.ceil(level.length / 2));
+            for (let i = 0; i < level.length; i += 2) {
+                next[i >> 1] = i + 1 < level.length ? this.hashPair(level[i], level[i + 1]) : level[i];
+            }
+            levels.push(next);
+            level = next;
+        }
+        return levels;
+    }
+
+    get root() {
+        return toHex(this.levels[this.levels.length - 1][0]);
+    }
+
+    proof(index) {
+        if (index < 0 || index >= this.intents.length) throw new Error(`Intent index ${index} out of range`);
+        const proof = [];
+        let position = index;
+        for (let depth = 0; depth < this.levels.length - 1; depth++) {
+            const level = this.levels[depth];
+            const sibling = position ^ 1;
+            if (sibling < level.length) proof.push(toHex(level[sibling]));
+            position >>= 1;
+        }
+        return proof;
+    }
+
+    verify(intent, proof) {
+        let node = toBuffer(this.hashIntent(intent));
+        for (const sibling of proof) node = this.hashPair(node, toBuffer(sibling));
+        return toHex(node) === this.root;
+    }
+
+    /**
+     * The maker's one signature for the whole batch (ethers v6 signer)
+     */
+    async sign(signer, domain) {
+        return signer.signTypedData(domain, LIMIT_ORDER_BATCH_TYPES, { maker: this.maker, root: this.root });
+    }
+
+    /**
+     * submitLimitOrdersFromBatch calls: [{ orders, value }], ordersPerTx orders each.
+     * @param {Array<{hashlock, timelock}>} locks per intent, same order as the intents
+     */
+    submissions(locks, ordersPerTx = DEFAULT_ORDERS_PER_TX) {
+        if (locks.length !== this.intents.length) throw new Error('One hashlock/timelock per intent');
+        const calls = [];
+        for (let start = 0; start < this.intents.length; start += ordersPerTx) {
+            const orders = [];
+            let value = 0n;
+            for (let i = start; i < Math.min(start + ordersPerTx, this.intents.length); i++) {
+                orders.push({ intent: this.intents[i], proof: this.proof(i), hashlock: locks[i].hashlock, timelock: locks[i].timelock || 0 });
+                value += BigInt(this.intents[i].makerAmount);
+            }
+            calls.push({ orders, value });
+        }
+        return calls;
+    }
+}
+
+if (require.main === module) {
+    const maker = '0x' + '11'.repeat(20);
+    const rungs = parseInt(process.argv[2] || '8', 10);
+    const deadline = Math.floor(Date.now() / 1000) + 3600;
+    const intents = Array.from({ length: rungs }, (_, i) => ({
+        maker,
+        makerToken: '0x' + '00'.repeat(20),
+        takerToken: '0x' + '00'.repeat(20),
+        makerAmount: 10n ** 16n,
+        takerAmount: 10n ** 16n * BigInt(100 + i) / 100n,
+        deadline,
+        algorandChainId: 416002,
+        algorandAddress: 'BJDBVZITI7VRHJLMPY4C6BX5UVBHZVNT6PRD3ZZWO2E2HSDYGSF4KO6RR4',
+        salt: '0x' + i.toString(16).padStart(64, '0'),
+        allowPartialFills: false,
+        minPartialFill: 0n
+    }));
+    const tree = new OrderBatchTree(intents);
+    console.log('🪜 ORDER BATCH TREE');
+    console.log(`   Orders: ${rungs}`);
+    console.log(`   Root:   ${tree.root}`);
+    for (let i = 0; i < rungs; i++) {
+        console.log(`   #${i} takerAmount ${intents[i].takerAmount} proof [${tree.proof(i).length}]`);
+    }
+}
+
+module.exports = {
+    OrderBatchTree,
+    LIMIT_ORDER_INTENT_TYPES,
+    LIMIT_ORDER_BATCH_TYPES,
+    BATCH_SUBMIT_ABI
+};
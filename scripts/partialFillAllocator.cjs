@@ -0,0 +1,365 @@
+#!/usr/bin/env node
+
+/**
+ * 🎒 MULTI-ORDER PARTIAL FILL ALLOCATOR
+ *
+ * Chooses fill amounts across every fillable order at once instead of sizing
+ * each order in isolation:
+ * ✅ Bounded (multiple-choice) knapsack per spend asset over profit per unit
+ * ✅ Respects minFill / allowPartial / remaining and per-order fill limits
+ * ✅ Wallet inventory per asset (ALGO, ETH) with gas reserved in ETH
+ * ✅ Incremental: only asset groups touched by an order change are re-solved
+ *
+ * Order descriptor (amounts are BigInt in base units: wei / microAlgos):
+ *   {
+ *     orderId, source,                // e.g. 'PartialFillLimitOrderBridge' | 'EnhancedLimitOrderBridge'
+ *     makerAmount, takerAmount,       // order totals (maker sells, resolver delivers taker side)
+ *     remaining,                      // maker amount still fillable
+ *     minFill,                        // minimum partial fill (maker units)
+ *     allowPartial,                   // false → only `remaining` can be filled
+ *     remainderBelowMin,              // true → a final fill below minFill is allowed (PartialFillLimitOrderBridge)
+ *     fillsLeft,                      // remaining fill slots (e.g. MAX_PARTIAL_FILLS_PER_ORDER - fillCount)
+ *     receiveAsset, spendAsset        // 'ETH' | 'ALGO' (both bridges escrow ETH, resolver delivers ALGO)
+ *   }
+ */
+
+const { EventEmitter } = require('events');
+
+const ASSET_DECIMALS = { ETH: 18, ALGO: 6 };
+
+const toBigInt = (value) => typeof value === 'bigint' ? value : BigInt(value);
+const toUnits = (amount, asset) => Number(amount) / 10 ** ASSET_DECIMALS[asset];
+const ceilDiv = (a, b) => (a + b - 1n) / b;
+
+class PartialFillAllocator extends EventEmitter {
+    /**
+     * @param {object} options
+     *   priceOf(asset)   → value of 1 unit of `asset` in ETH (e.g. oracle.convert(1, asset, 'ETH', 'bid'))
+     *   gasCostWei       → ETH cost of one fill transaction (BigInt)
+     *   lotsPerAsset     → DP resolution per asset (default 200)
+     *   maxFills         → cap on simultaneous fills across all orders
+     *   minProfitEth     → drop fills whose net profit is below this
+     *   minMargin        → drop fills whose net profit / received value is below this
+     *   reserve          → { ETH, ALGO } amounts never allocated (BigInt)
+     */
+    constructor(options = {}) {
+        super();
+        this.priceOf = options.priceOf || ((asset) => asset === 'ETH' ? 1 : 0.001);
+        this.gasCostWei = toBigInt(options.gasCostWei || 0n);
+        this.lotsPerAsset = options.lotsPerAsset || 200;
+        this.maxFills = options.maxFills || Infinity;
+        this.minProfitEth = options.minProfitEth || 0;
+        this.minMargin = options.minMargin || 0;
+        this.reserve = { ETH: 0n, ALGO: 0n, ...(options.reserve || {}) };
+
+        this.orders = new Map();                   // orderId -> descriptor
+        this.inventory = { ETH: 0n, ALGO: 0n };
+        this.allocation = new Map();               // orderId -> { fillAmount, spendAmount, profitEth }
+        this.groupResults = new Map();             // spendAsset -> [{ orderId, ... }]
+        this.dirtyAssets = new Set();
+        this.solveScheduled = false;
+    }
+
+    // 📦 Inventory / order book maintenance (each call schedules an incremental re-solve)
+
+    setInventory(asset, amount) {
+        const value = toBigInt(amount);
+        if (this.inventory[asset] === value) return;
+        this.inventory[asset] = value;
+        // ETH funds gas for every group, so an ETH change touches all of them
+        if (asset === 'ETH') {
+            for (const order of this.orders.values()) this.dirtyAssets.add(order.spendAsset);
+        }
+        this.dirtyAssets.add(asset);
+        this.scheduleSolve();
+    }
+
+    setGasCost(gasCostWei) {
+        this.gasCostWei = toBigInt(gasCostWei);
+        for (const order of this.orders.values()) this.dirtyAssets.add(order.spendAsset);
+        this.scheduleSolve();
+    }
+
+    upsertOrder(descriptor) {
+        const order = {
+            allowPartial: true,
+            remainderBelowMin: false,
+            fillsLeft: Infinity,
+            receiveAsset: 'ETH',
+            spendAsset: 'ALGO',
+            ...descriptor,
+            makerAmount: toBigInt(descriptor.makerAmount),
+            takerAmount: toBigInt(descriptor.takerAmount),
+            remaining: toBigInt(descriptor.remaining ?? descriptor.makerAmount),
+            minFill: toBigInt(descriptor.minFill || 0n)
+        };
+        const previous = this.orders.get(order.orderId);
+        if (previous && previous.spendAsset !== order.spendAsset) this.dirtyAssets.add(previous.spendAsset);
+
+        this.orders.set(order.orderId, order);
+        this.dirtyAssets.add(order.spendAsset);
+        this.scheduleSolve();
+    }
+
+    updateOrder(orderId, changes) {
+        const order = this.orders.get(orderId);
+        if (!order) return;
+        this.upsertOrder({ ...order, ...changes });
+    }
+
+    removeOrder(orderId) {
+        const order = this.orders.get(orderId);
+        if (!order) return;
+        this.orders.delete(orderId);
+        this.dirtyAssets.add(order.spendAsset);
+        this.scheduleSolve();
+    }
+
+    scheduleSolve() {
+        if (this.solveScheduled) return;
+        this.solveScheduled = true;
+        // Coalesce bursts of events (many orders in one block) into one solve
+        setImmediate(() => {
+            this.solveScheduled = false;
+            this.solve();
+        });
+    }
+
+    // 🧮 Economics
+
+    /**
+     * Exact amounts for a maker-side fill: what we deliver and what we get back.
+     * Delivery is rounded up so `spend >= takerAmount * fill / makerAmount` holds on-chain.
+     */
+    fillTerms(order, fillAmount) {
+        const spendAmount = ceilDiv(order.takerAmount * fillAmount, order.makerAmount);
+        const receiveAmount = fillAmount;
+        const receiveEth = toUnits(receiveAmount, order.receiveAsset) * this.priceOf(order.receiveAsset);
+        const spendEth = toUnits(spendAmount, order.spendAsset) * this.priceOf(order.spendAsset);
+        const gasEth = toUnits(this.gasCostWei, 'ETH');
+        const profitEth = receiveEth - spendEth - gasEth;
+        return { fillAmount, spendAmount, profitEth, margin: receiveEth > 0 ? profitEth / receiveEth : 0 };
+    }
+
+    /**
+     * Candidate fills for one order at the group's lot resolution.
+     * Returns [{ lots, fillAmount, spendAmount, profitEth }] (empty if unfillable).
+     */
+    candidateFills(order, lotSize, capacityLots) {
+        if (order.remaining <= 0n || order.fillsLeft <= 0) return [];
+
+        const candidates = [];
+        const push = (fillAmount) => {
+            if (fillAmount <= 0n || fillAmount > order.remaining) return;
+            const terms = this.fillTerms(order, fillAmount);
+            const lots = Number(ceilDiv(terms.spendAmount, lotSize));
+            if (lots > capacityLots || terms.profitEth < this.minProfitEth || terms.margin < this.minMargin) return;
+            candidates.push({ lots, ...terms });
+        };
+
+        if (!order.allowPartial) {
+            push(order.remaining);
+            return candidates;
+        }
+
+        // Whole-remaining fill is always a candidate if it is itself >= minFill or allowed as the tail
+        if (order.remaining >= order.minFill || order.remainderBelowMin) push(order.remaining);
+
+        // Largest maker amount whose delivery fits in `lots` lots, for every lot count
+        const maxLots = Math.min(capacityLots, Number(ceilDiv(ceilDiv(order.takerAmount * order.remaining, order.makerAmount), lotSize)));
+        for (let lots = 1; lots <= maxLots; lots++) {
+            const fill = (BigInt(lots) * lotSize * order.makerAmount) / order.takerAmount;
+            const clipped = fill > order.remaining ? order.remaining : fill;
+            if (clipped < order.minFill && !(clipped === order.remaining && order.remainderBelowMin)) continue;
+            // Leaving a dust tail below minFill makes the rest unfillable on bridges without a tail exception
+            const tail = order.remaining - clipped;
+            if (tail > 0n && tail < order.minFill && !order.remainderBelowMin) continue;
+            push(clipped);
+        }
+        return candidates;
+    }
+
+    /**
+     * Multiple-choice knapsack: each order contributes at most one candidate fill.
+     * dp[c] = best profit with at most c lots; choice table rebuilds the selection.
+     */
+    solveGroup(orders, capacity, lotSize, fillSlots) {
+        const capacityLots = capacity > 0n ? Number(capacity / lotSize) : 0;
+        const items = orders
+            .map(order => ({ order, candidates: this.candidateFills(order, lotSize, capacityLots) }))
+            .filter(item => item.candidates.length > 0);
+        if (items.length === 0 || capacityLots === 0) return [];
+
+        const width = capacityLots + 1;
+        let dp = new Float64Array(width);
+        const choice = new Int32Array(items.length * width).fill(-1);
+
+        items.forEach((item, i) => {
+            const next = Float64Array.from(dp);
+            item.candidates.forEach((candidate, k) => {
+                for (let c = width - 1; c >= candidate.lots; c--) {
+                    const value = dp[c - candidate.lots] + candidate.profitEth;
+                    if (value > next[c]) {
+                        next[c] = value;
+                        choice[i * width + c] = k;
+                    }
+                }
+            });
+            dp = next;
+        });
+
+        // Walk back from full capacity
+        const selected = [];
+        let c = capacityLots;
+        for (let i = items.length - 1; i >= 0; i--) {
+            const k = choice[i * width + c];
+            if (k < 0) continue;
+            const candidate = items[i].candidates[k];
+            selected.push({ orderId: items[i].order.orderId, source: items[i].order.source, ...candidate });
+            c -= candidate.lots;
+        }
+
+        // Gas is paid per transaction: keep the most profitable fills if slots are scarce
+        selected.sort((a, b) => b.profitEth - a.profitEth);
+        return selected.slice(0, fillSlots);
+    }
+
+    /**
+     * Re-solve dirty asset groups. ALGO-spending groups run first so their gas
+     * reservation is known before ETH-spending fills are sized.
+     */
+    solve() {
+        if (this.dirtyAssets.size === 0) return this.allocation;
+        const assets = [...this.dirtyAssets].sort((a, b) => (a === 'ETH') - (b === 'ETH'));
+        this.dirtyAssets.clear();
+
+        for (const asset of assets) {
+            const orders = [...this.orders.values()].filter(order => order.spendAsset === asset);
+            const otherFills = [...this.groupResults.entries()]
+                .filter(([groupAsset]) => groupAsset !== asset)
+                .reduce((count, [, fills]) => count + fills.length, 0);
+
+            let fillSlots = Math.max(0, this.maxFills - otherFills);
+            let capacity = this.inventory[asset] - (this.reserve[asset] || 0n);
+
+            // Every fill needs gas in ETH; ETH-spending fills share that budget
+            const ethFree = this.inventory.ETH - this.reserve.ETH - this.gasReservedExcept(asset);
+            if (this.gasCostWei > 0n) {
+                const affordable = ethFree > 0n ? Number(ethFree / this.gasCostWei) : 0;
+                fillSlots = Math.min(fillSlots, affordable);
+            }
+            if (asset === 'ETH') capacity = ethFree;
+
+            const lotSize = capacity > 0n ? ceilDiv(capacity, BigInt(this.lotsPerAsset)) : 1n;
+            let fills = this.solveGroup(orders, capacity, lotSize, fillSlots);
+
+            // ETH group: delivery and gas come from the same balance
+            if (asset === 'ETH' && this.gasCostWei > 0n) {
+                let budget = capacity;
+                fills = fills.filter(fill => {
+                    const need = fill.spendAmount + this.gasCostWei;
+                    if (need > budget) return false;
+                    budget -= need;
+                    return true;
+                });
+            }
+
+            this.groupResults.set(asset, fills);
+        }
+
+        const previous = this.allocation;
+        this.allocation = new Map();
+        for (const fills of this.groupResults.values()) {
+            for (const fill of fills) this.allocation.set(fill.orderId, fill);
+        }
+
+        this.emit('allocation', { allocation: this.allocation, changed: this.diff(previous, this.allocation) });
+        return this.allocation;
+    }
+
+    gasReservedExcept(asset) {
+        let count = 0;
+        for (const [groupAsset, fills] of this.groupResults) {
+            if (groupAsset !== asset) count += fills.length;
+        }
+        return this.gasCostWei * BigInt(count);
+    }
+
+    diff(previous, next) {
+        const changed = [];
+        for (const [orderId, fill] of next) {
+            const old = previous.get(orderId);
+            if (!old || old.fillAmount !== fill.fillAmount) changed.push(orderId);
+        }
+        for (const orderId of previous.keys()) {
+            if (!next.has(orderId)) changed.push(orderId);
+        }
+        return changed;
+    }
+
+    /** Current plan, most profitable first. */
+    plan() {
+        return [...this.allocation.values()].sort((a, b) => b.profitEth - a.profitEth);
+    }
+
+    // 🔌 Adapters for the two bridge order layouts
+
+    /** PartialFillLimitOrderBridge: LimitOrderCreated fields + getOrderSummary() */
+    static fromPartialFillBridge(orderId, order, summary = {}) {
+        const maxFills = 10; // MAX_PARTIAL_FILLS_PER_ORDER
+        const fillCount = Number(summary.fillCount || 0);
+        return {
+            orderId,
+            source: 'PartialFillLimitOrderBridge',
+            makerAmount: toBigInt(order.makerAmount),
+            takerAmount: toBigInt(order.takerAmount),
+            remaining: toBigInt(summary.remainingAmount ?? order.remainingAmount ?? order.makerAmount),
+            minFill: toBigInt(order.minFillAmount || 0),
+            allowPartial: Boolean(order.partialFillsEnabled),
+            remainderBelowMin: true,
+            fillsLeft: order.partialFillsEnabled ? maxFills - fillCount : 1
+        };
+    }
+
+    /** EnhancedLimitOrderBridge.limitOrders (executePartialFill has no tail exception) */
+    static fromEnhancedBridge(orderId, order) {
+        const intent = order.intent || order;
+        return {
+            orderId,
+            source: 'EnhancedLimitOrderBridge',
+            makerAmount: toBigInt(intent.makerAmount),
+            takerAmount: toBigInt(intent.takerAmount),
+            remaining: toBigInt(order.remainingAmount ?? intent.makerAmount),
+            minFill: toBigInt(intent.minPartialFill || 0),
+            allowPartial: Boolean(intent.allowPartialFills),
+            remainderBelowMin: false
+        };
+    }
+}
+
+if (require.main === module) {
+    // Offline demo: three ETH→ALGO orders competing for 1500 ALGO of inventory
+    const eth = (x) => BigInt(Math.round(x * 1e6)) * 10n ** 12n;
+    const algo = (x) => BigInt(Math.round(x * 1e6));
+
+    const allocator = new PartialFillAllocator({
+        priceOf: (asset) => asset === 'ETH' ? 1 : 0.001,
+        gasCostWei: eth(0.0001),
+        maxFills: 5
+    });
+    allocator.setInventory('ETH', eth(0.05));
+    allocator.setInventory('ALGO', algo(1500));
+    allocator.upsertOrder({ orderId: 'A', makerAmount: eth(1), takerAmount: algo(950), minFill: eth(0.1) });   // 5% edge
+    allocator.upsertOrder({ orderId: 'B', makerAmount: eth(1), takerAmount: algo(980), minFill: eth(0.2) });   // 2% edge
+    allocator.upsertOrder({ orderId: 'C', makerAmount: eth(0.5), takerAmount: algo(490), allowPartial: false }); // 2% edge, all-or-nothing
+
+    allocator.once('allocation', () => {
+        console.log('🎒 PARTIAL FILL ALLOCATION');
+        console.log('==========================');
+        for (const fill of allocator.plan()) {
+            console.log(`   ${fill.orderId}: fill ${toUnits(fill.fillAmount, 'ETH').toFixed(4)} ETH, deliver ${toUnits(fill.spendAmount, 'ALGO').toFixed(2)} ALGO, profit ${fill.profitEth.toFixed(5)} ETH`);
+        }
+    });
+}
+
+module.exports = { PartialFillAllocator };
@@ -0,0 +1,123 @@
+#!/usr/bin/env node
+
+/**
+ * 📚 PARTIAL FILL HISTORY INDEX
+ *
+ * PartialFillLimitOrderBridge keeps only running totals on-chain; per-fill
+ * details are in events. This index rebuilds fill history from them:
+ * ✅ Joins PartialOrderFilled with PartialFillSecretRevealed by (orderId, fillIndex)
+ * ✅ Backfills from logs in block chunks, then follows live events
+ * ✅ Idempotent (a log seen twice - backfill overlap, reorg replay - is stored once)
+ * ✅ Paginated reads per order plus per-order aggregates
+ */
+
+const DEFAULT_CHUNK_BLOCKS = 5000;
+
+class PartialFillHistoryIndex {
+    constructor(options = {}) {
+        this.chunkBlocks = options.chunkBlocks || DEFAULT_CHUNK_BLOCKS;
+        this.orders = new Map();       // orderId -> { fills: Map<fillIndex, fill>, totalFees, filled }
+        this.seenLogs = new Set();     // `${txHash}:${logIndex}`
+        this.lastBlock = 0;
+    }
+
+    order(orderId) {
+        let entry = this.orders.get(orderId);
+        if (!entry) {
+            entry = { fills: new Map(), totalFees: 0n, filled: 0n };
+            this.orders.set(orderId, entry);
+        }
+        return entry;
+    }
+
+    fill(orderId, fillIndex) {
+        const entry = this.order(orderId);
+        const key = Number(fillIndex);
+        let fill = entry.fills.get(key);
+        if (!fill) {
+            fill = { orderId, fillIndex: key };
+            entry.fills.set(key, fill);
+        }
+        return { entry, fill };
+    }
+
+    markSeen(meta) {
+        if (!meta || meta.transactionHash === undefined) return true;
+        const key = `${meta.transactionHash}:${meta.index ?? meta.logIndex}`;
+        if (this.seenLogs.has(key)) return false;
+        this.seenLogs.add(key);
+        if (meta.blockNumber > this.lastBlock) this.lastBlock = meta.blockNumber;
+        return true;
+    }
+
+    onFilled(orderId, resolver, fillAmount, remainingAmount, algorandAmount, resolverFee, fillIndex, isFullyFilled, meta = {}) {
+        if (!this.markSeen(meta)) return;
+        const { entry, fill } = this.fill(orderId, fillIndex);
+        Object.assign(fill, {
+            resolver,
+            fillAmount: BigInt(fillAmount),
+            remainingAmount: BigInt(remainingAmount),
+            algorandAmount: BigInt(algorandAmount),
+            resolverFee: BigInt(resolverFee),
+            isFullyFilled: Boolean(isFullyFilled),
+            blockNumber: meta.blockNumber,
+            transactionHash: meta.transactionHash
+        });
+        entry.totalFees += fill.resolverFee;
+        entry.filled += fill.fillAmount;
+    }
+
+    onSecretRevealed(orderId, fillIndex, secret, meta = {}) {
+        if (!this.markSeen(meta)) return;
+        this.fill(orderId, fillIndex).fill.secret = secret;
+    }
+
+    /**
+     * Fills of one order in fill order; { offset, limit } for paging.
+     */
+    getOrderFills(orderId, { offset = 0, limit = 50 } = {}) {
+        const entry = this.orders.get(orderId);
+        if (!entry) return { total: 0, fills: [] };
+        const fills = [...entry.fills.values()].sort((a, b) => a.fillIndex - b.fillIndex);
+        return { total: fills.length, fills: fills.slice(offset, offset + limit) };
+    }
+
+    getOrderTotals(orderId) {
+        const entry = this.orders.get(orderId);
+        if (!entry) return null;
+        return { fillCount: entry.fills.size, totalFees: entry.totalFees, filled: entry.filled };
+    }
+
+    /**
+     * Replay logs from fromBlock to toBlock (inclusive) in chunks.
+     */
+    async backfill(contract, fromBlock, toBlock) {
+        for (let start = fromBlock; start <= toBlock; start += this.chunkBlocks) {
+            const end = Math.min(start + this.chunkBlocks - 1, toBlock);
+            const [filled, revealed] = await Promise.all([
+                contract.queryFilter(contract.filters.PartialOrderFilled(), start, end),
+                contract.queryFilter(contract.filters.PartialFillSecretRevealed(), start, end)
+            ]);
+            for (const log of filled) this.onFilled(...log.args, log);
+            for (const log of revealed) this.onSecretRevealed(...log.args, log);
+        }
+        if (toBlock > this.lastBlock) this.lastBlock = toBlock;
+    }
+
+    /**
+     * Follow new events (ethers v6 passes the event payload last; its .log carries the position).
+     */
+    attach(contract) {
+        const meta = (payload) => (payload && payload.log) || payload || {};
+        contract.on('PartialOrderFilled', (...args) => {
+            const payload = args.pop();
+            this.onFilled(...args, meta(payload));
+        });
+        contract.on('PartialFillSecretRevealed', (...args) => {
+            const payload = args.pop();
+            this.onSecretRevealed(...args, meta(payload));
+        });
+    }
+}
+
+module.exports = { PartialFillHistoryIndex };
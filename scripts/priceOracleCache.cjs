@@ -0,0 +1,429 @@
+#!/usr/bin/env node
+
+/**
+ * 💱 STREAMING PRICE ORACLE CACHE
+ *
+ * In-memory ALGO/ETH price service for resolver pricing:
+ * ✅ Background feeds push ticks (HTTP pollers or local mock feed)
+ * ✅ Time-weighted average price (TWAP) over a configurable window
+ * ✅ Spread estimate from quoted bid/ask and cross-source dispersion
+ * ✅ getPrice()/convert() are synchronous reads of a precomputed snapshot
+ *
+ * Pairs are quoted as BASE/QUOTE, i.e. 'ALGO/ETH' is the ETH value of 1 ALGO.
+ *
+ * Configuration (env):
+ *   PRICE_SOURCES            comma list of feeds: binance,coingecko,mock   (default: binance,coingecko)
+ *   PRICE_POLL_INTERVAL_MS   poll interval per HTTP feed                   (default: 5000)
+ *   PRICE_TWAP_WINDOW_MS     TWAP window                                   (default: 300000)
+ *   PRICE_MAX_STALENESS_MS   snapshot older than this is reported stale    (default: 60000)
+ *   PRICE_FALLBACK_ALGO_ETH  rate used before the first tick arrives       (default: 0.001)
+ */
+
+const { EventEmitter } = require('events');
+
+const DEFAULT_PAIR = 'ALGO/ETH';
+const HISTORY_CAPACITY = 1024;
+
+/**
+ * Fixed-size ring buffer of (timestamp, mid) samples for one pair.
+ * Typed arrays keep ingest allocation-free.
+ */
+class TickHistory {
+    constructor(capacity = HISTORY_CAPACITY) {
+        this.capacity = capacity;
+        this.timestamps = new Float64Array(capacity);
+        this.mids = new Float64Array(capacity);
+        this.head = 0;   // next write index
+        this.size = 0;
+    }
+
+    push(timestamp, mid) {
+        this.timestamps[this.head] = timestamp;
+        this.mids[this.head] = mid;
+        this.head = (this.head + 1) % this.capacity;
+        if (this.size < this.capacity) this.size++;
+    }
+
+    /**
+     * Time-weighted average of the mid over [now - windowMs, now].
+     * Each sample is held until the next one (step interpolation).
+     */
+    twap(now, windowMs) {
+        if (this.size === 0) return NaN;
+
+        const windowStart = now - windowMs;
+        let segmentEnd = now;
+        let weighted = 0;
+        let covered = 0;
+
+        for (let i = 0; i < this.size; i++) {
+            const idx = (this.head - 1 - i + this.capacity) % this.capacity;
+            const ts = this.timestamps[idx];
+            const segmentStart = Math.max(ts, windowStart);
+            const duration = segmentEnd - segmentStart;
+
+            if (duration > 0) {
+                weighted += this.mids[idx] * duration;
+                covered += duration;
+            }
+            if (ts <= windowStart) break;
+            segmentEnd = ts;
+        }
+
+        // Only one sample inside the window and no elapsed time: use it directly
+        if (covered === 0) return this.mids[(this.head - 1 + this.capacity) % this.capacity];
+        return weighted / covered;
+    }
+}
+
+/**
+ * Local deterministic feed for tests and offline demos.
+ * Emits a bounded random walk around `basePrice` with a fixed relative spread.
+ */
+class MockPriceFeed {
+    constructor({ pair = DEFAULT_PAIR, basePrice = 0.001, spread = 0.002, volatility = 0.001, intervalMs = 1000, seed = 42 } = {}) {
+        this.name = 'mock';
+        this.pair = pair;
+        this.price = basePrice;
+        this.basePrice = basePrice;
+        this.spread = spread;
+        this.volatility = volatility;
+        this.intervalMs = intervalMs;
+        this.state = seed >>> 0 || 1;
+        this.timer = null;
+    }
+
+    // xorshift32 - reproducible across runs
+    nextRandom() {
+        let x = this.state;
+        x ^= x << 13;
+        x ^= x >>> 17;
+        x ^= x << 5;
+        this.state = x >>> 0;
+        return this.state / 0x100000000;
+    }
+
+    nextTick(timestamp = Date.now()) {
+        const shock = (this.nextRandom() - 0.5) * 2 * this.volatility;
+        // Mean-revert towards basePrice so long runs stay bounded
+        this.price = Math.max(this.price * (1 + shock) + (this.basePrice - this.price) * 0.05, this.basePrice * 0.01);
+        const half = this.price * this.spread / 2;
+        return { pair: this.pair, source: this.name, bid: this.price - half, ask: this.price + half, timestamp };
+    }
+
+    start(onTick) {
+        onTick(this.nextTick());
+        this.timer = setInterval(() => onTick(this.nextTick()), this.intervalMs);
+        if (this.timer.unref) this.timer.unref();
+    }
+
+    stop() {
+        if (this.timer) clearInterval(this.timer);
+        this.timer = null;
+    }
+}
+
+/**
+ * Generic background HTTP poller. `parse(json)` returns { bid, ask } or { mid }
+ * for the configured pair. Requests never block readers of the cache.
+ */
+class HttpPollingFeed {
+    constructor({ name, pair = DEFAULT_PAIR, urls, parse, intervalMs = 5000, timeoutMs = 4000 }) {
+        this.name = name;
+        this.pair = pair;
+        this.urls = urls;
+        this.parse = parse;
+        this.intervalMs = intervalMs;
+        this.timeoutMs = timeoutMs;
+        this.timer = null;
+        this.inFlight = false;
+        this.consecutiveErrors = 0;
+    }
+
+    async fetchJson(url) {
+        const controller = new AbortController();
+        const timeout = setTimeout(() => controller.abort(), this.timeoutMs);
+        try {
+            const response = await fetch(url, { signal: controller.signal });
+            if (!response.ok) throw new Error(`HTTP ${response.status}`);
+            return await response.json();
+        } finally {
+            clearTimeout(timeout);
+        }
+    }
+
+    async poll(onTick, onError) {
+        // Skip a tick rather than stacking requests behind a slow endpoint
+        if (this.inFlight) return;
+        this.inFlight = true;
+        try {
+            const payloads = await Promise.all(this.urls.map(url => this.fetchJson(url)));
+            const quote = this.parse(...payloads);
+            if (quote) {
+                onTick({ pair: this.pair, source: this.name, ...quote, timestamp: Date.now() });
+            }
+            this.consecutiveErrors = 0;
+        } catch (error) {
+            this.consecutiveErrors++;
+            onError(this.name, error);
+        } finally {
+            this.inFlight = false;
+        }
+    }
+
+    start(onTick, onError = () => {}) {
+        this.poll(onTick, onError);
+        this.timer = setInterval(() => this.poll(onTick, onError), this.intervalMs);
+        if (this.timer.unref) this.timer.unref();
+    }
+
+    stop() {
+        if (this.timer) clearInterval(this.timer);
+        this.timer = null;
+    }
+}
+
+/**
+ * Built-in feed definitions, selected by name from PRICE_SOURCES.
+ */
+const FEED_FACTORIES = {
+    // Top of book for both legs, cross-rate bid/ask: ALGO bid / ETH ask .. ALGO ask / ETH bid
+    binance: (intervalMs) => new HttpPollingFeed({
+        name: 'binance',
+        intervalMs,
+        urls: [
+            'https://api.binance.com/api/v3/ticker/bookTicker?symbol=ALGOUSDT',
+            'https://api.binance.com/api/v3/ticker/bookTicker?symbol=ETHUSDT'
+        ],
+        parse: (algo, eth) => ({
+            bid: parseFloat(algo.bidPrice) / parseFloat(eth.askPrice),
+            ask: parseFloat(algo.askPrice) / parseFloat(eth.bidPrice)
+        })
+    }),
+
+    // Last-trade reference only (no book), contributes to dispersion-based spread
+    coingecko: (intervalMs) => new HttpPollingFeed({
+        name: 'coingecko',
+        intervalMs: Math.max(intervalMs, 15000), // public API rate limit
+        urls: ['https://api.coingecko.com/api/v3/simple/price?ids=algorand,ethereum&vs_currencies=usd'],
+        parse: (prices) => ({
+            mid: prices.algorand.usd / prices.ethereum.usd
+        })
+    }),
+
+    mock: (intervalMs) => new MockPriceFeed({ intervalMs: Math.min(intervalMs, 1000) })
+};
+
+class PriceOracleCache extends EventEmitter {
+    constructor(options = {}) {
+        super();
+
+        this.config = {
+            sources: options.sources || (process.env.PRICE_SOURCES || 'binance,coingecko').split(',').map(s => s.trim()).filter(Boolean),
+            pollIntervalMs: options.pollIntervalMs || parseInt(process.env.PRICE_POLL_INTERVAL_MS || '5000'),
+            twapWindowMs: options.twapWindowMs || parseInt(process.env.PRICE_TWAP_WINDOW_MS || '300000'),
+            maxStalenessMs: options.maxStalenessMs || parseInt(process.env.PRICE_MAX_STALENESS_MS || '60000'),
+            spreadHalfLife: options.spreadHalfLife || 20, // ticks
+            fallback: {
+                [DEFAULT_PAIR]: options.fallbackAlgoEth || parseFloat(process.env.PRICE_FALLBACK_ALGO_ETH || '0.001'),
+                ...(options.fallback || {})
+            }
+        };
+
+        this.feeds = options.feeds || this.config.sources
+            .filter(name => FEED_FACTORIES[name])
+            .map(name => FEED_FACTORIES[name](this.config.pollIntervalMs));
+
+        this.pairs = new Map();   // pair -> { history, latestBySource, spreadEwma, snapshot }
+        this.running = false;
+        this.spreadAlpha = 1 - Math.pow(0.5, 1 / this.config.spreadHalfLife);
+    }
+
+    start() {
+        if (this.running) return this;
+        this.running = true;
+        for (const feed of this.feeds) {
+            feed.start(tick => this.ingest(tick), (source, error) => this.emit('feedError', { source, error }));
+        }
+        return this;
+    }
+
+    stop() {
+        for (const feed of this.feeds) feed.stop();
+        this.running = false;
+    }
+
+    getPairState(pair) {
+        let state = this.pairs.get(pair);
+        if (!state) {
+            state = {
+                history: new TickHistory(),
+                latestBySource: new Map(),
+                spreadEwma: NaN,
+                snapshot: null
+            };
+            this.pairs.set(pair, state);
+        }
+        return state;
+    }
+
+    /**
+     * Push one quote into the cache and rebuild the pair snapshot.
+     * All aggregation happens here so that reads are a single Map lookup.
+     */
+    ingest(tick) {
+        const pair = tick.pair || DEFAULT_PAIR;
+        const timestamp = tick.timestamp || Date.now();
+        const hasBook = Number.isFinite(tick.bid) && Number.isFinite(tick.ask) && tick.ask >= tick.bid && tick.bid > 0;
+        const mid = hasBook ? (tick.bid + tick.ask) / 2 : tick.mid;
+
+        if (!Number.isFinite(mid) || mid <= 0) return null;
+
+        const state = this.getPairState(pair);
+        state.history.push(timestamp, mid);
+        state.latestBySource.set(tick.source || 'unknown', { mid, timestamp });
+
+        if (hasBook) {
+            const quotedSpread = (tick.ask - tick.bid) / mid;
+            state.spreadEwma = Number.isNaN(state.spreadEwma)
+                ? quotedSpread
+                : state.spreadEwma + this.spreadAlpha * (quotedSpread - state.spreadEwma);
+        }
+
+        // Cross-source dispersion over sources that are still fresh
+        let low = Infinity;
+        let high = -Infinity;
+        let freshSources = 0;
+        for (const quote of state.latestBySource.values()) {
+            if (timestamp - quote.timestamp > this.config.maxStalenessMs) continue;
+            if (quote.mid < low) low = quote.mid;
+            if (quote.mid > high) high = quote.mid;
+            freshSources++;
+        }
+        const dispersion = freshSources > 1 ? (high - low) / mid : 0;
+        const spread = Math.max(Number.isNaN(state.spreadEwma) ? 0 : state.spreadEwma, dispersion);
+        const twap = state.history.twap(timestamp, this.config.twapWindowMs);
+
+        state.snapshot = Object.freeze({
+            pair,
+            mid,
+            twap,
+            spread,
+            bid: twap * (1 - spread / 2),
+            ask: twap * (1 + spread / 2),
+            sources: freshSources,
+            samples: state.history.size,
+            updatedAt: timestamp
+        });
+
+        this.emit('price', state.snapshot);
+        return state.snapshot;
+    }
+
+    /**
+     * Latest snapshot for a pair. Inverse pairs are derived on the fly.
+     * Never performs I/O; returns a fallback snapshot before the first tick.
+     */
+    getPrice(pair = DEFAULT_PAIR, now = Date.now()) {
+        const state = this.pairs.get(pair);
+        if (state && state.snapshot) {
+            const stale = now - state.snapshot.updatedAt > this.config.maxStalenessMs;
+            return stale ? { ...state.snapshot, stale } : state.snapshot;
+        }
+
+        const [base, quote] = pair.split('/');
+        const inverse = this.pairs.get(`${quote}/${base}`);
+        if (inverse && inverse.snapshot) {
+            const s = inverse.snapshot;
+            return {
+                pair,
+                mid: 1 / s.mid,
+                twap: 1 / s.twap,
+                spread: s.spread,
+                bid: 1 / s.ask,
+                ask: 1 / s.bid,
+                sources: s.sources,
+                samples: s.samples,
+                updatedAt: s.updatedAt,
+                stale: now - s.updatedAt > this.config.maxStalenessMs
+            };
+        }
+
+        const fallback = this.config.fallback[pair] || (this.config.fallback[`${quote}/${base}`] ? 1 / this.config.fallback[`${quote}/${base}`] : NaN);
+        return { pair, mid: fallback, twap: fallback, spread: 0, bid: fallback, ask: fallback, sources: 0, samples: 0, updatedAt: 0, stale: true };
+    }
+
+    /**
+     * TWAP rate for a pair (BASE priced in QUOTE).
+     */
+    getRate(pair = DEFAULT_PAIR) {
+        return this.getPrice(pair).twap;
+    }
+
+    /**
+     * Convert `amount` of `from` into `to` using the TWAP.
+     * side='bid' values what we receive conservatively, side='ask' what we pay.
+     */
+    convert(amount, from, to, side = 'mid') {
+        if (from === to) return amount;
+        const snapshot = this.getPrice(`${from}/${to}`);
+        const rate = side === 'bid' ? snapshot.bid : side === 'ask' ? snapshot.ask : snapshot.twap;
+        return amount * rate;
+    }
+
+    /**
+     * Wait (once) until every pair in `pairs` has at least one live sample.
+     */
+    ready(pairs = [DEFAULT_PAIR], timeoutMs = 10000) {
+        const isReady = () => pairs.every(pair => !this.getPrice(pair).stale);
+        if (isReady()) return Promise.resolve(true);
+
+        return new Promise(resolve => {
+            const timer = setTimeout(() => {
+                this.off('price', onPrice);
+                resolve(false);
+            }, timeoutMs);
+            const onPrice = () => {
+                if (!isReady()) return;
+                clearTimeout(timer);
+                this.off('price', onPrice);
+                resolve(true);
+            };
+            this.on('price', onPrice);
+        });
+    }
+}
+
+// Shared process-wide instance so every relayer component reads the same cache
+let sharedOracle = null;
+
+function getPriceOracle(options) {
+    if (!sharedOracle) {
+        sharedOracle = new PriceOracleCache(options).start();
+    }
+    return sharedOracle;
+}
+
+if (require.main === module) {
+    (async () => {
+        console.log('💱 PRICE ORACLE CACHE');
+        console.log('=====================');
+        const oracle = getPriceOracle();
+        console.log(`📡 Sources: ${oracle.config.sources.join(', ')}`);
+        oracle.on('feedError', ({ source, error }) => console.log(`⚠️ ${source}: ${error.message}`));
+
+        const live = await oracle.ready();
+        const snapshot = oracle.getPrice('ALGO/ETH');
+        console.log(`${live ? '✅' : '⚠️ (fallback)'} ALGO/ETH TWAP: ${snapshot.twap} (spread ${(snapshot.spread * 100).toFixed(3)}%)`);
+        console.log(`   ETH/ALGO TWAP: ${oracle.getRate('ETH/ALGO')}`);
+
+        const start = process.hrtime.bigint();
+        for (let i = 0; i < 100000; i++) oracle.getPrice('ALGO/ETH');
+        const perCall = Number(process.hrtime.bigint() - start) / 100000;
+        console.log(`⚡ getPrice(): ${perCall.toFixed(0)} ns/call`);
+
+        oracle.stop();
+    })();
+}
+
+module.exports = { PriceOracleCache, MockPriceFeed, HttpPollingFeed, TickHistory, getPriceOracle };
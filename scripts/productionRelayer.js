@@ -14,6 +14,9 @@ const { Server } = require('socket.io');
 const cors = require('cors');
 const { ethers } = require('ethers');
 const algosdk = require('algosdk');
+const { createBridgeIntentPool, RELAYED_SUBMIT_ABI } = require('./intentPool.cjs');
+const { CowMatcher, fromLimitOrderIntent, planSettlement } = require('./cowMatcher.cjs');
+const { getPriceOracle } = require('./priceOracleCache.cjs');
 require('dotenv').config();
 
 class ProductionRelayerService {
@@ -38,6 +41,9 @@ class ProductionRelayerService {
         // Contract instances
         this.limitOrderBridge = null;
         this.algoClient = null;
+        this.intentPool = null; // Gasless RelayedLimitOrders, flushed in batches
+        this.cowMatcher = new CowMatcher({ referencePrice: () => this.cowReferencePrice() });
+        this.cowTimer = null;
         
         // Active orders tracking
         this.activeOrders = new Map();
@@ -104,6 +110,35 @@ class ProductionRelayerService {
             });
         });
 
+        // Gasless intents: signed RelayedLimitOrder, submitted later in a batch
+        this.app.post('/api/intents', (req, res) => {
+            if (!this.intentPool) {
+                return res.status(503).json({ success: false, error: 'Intent pool disabled' });
+            }
+            try {
+                const { intent, hashlock, timelock, signature } = req.body;
+                const result = this.intentPool.add({ intent, hashlock, timelock, signature });
+                res.status(result.accepted ? 202 : 400).json({ success: result.accepted, ...result });
+            } catch (error) {
+                res.status(400).json({ success: false, error: error.message });
+            }
+        });
+
+        this.app.get('/api/intents', (req, res) => {
+            res.json({ success: true, pending: this.intentPool ? this.intentPool.size : 0 });
+        });
+
+        // Coincidence-of-wants: opposite-direction intents netted before any escrow
+        this.app.post('/api/cow/intents', (req, res) => {
+            try {
+                const { id, direction, intent, ethAddress, relayedOrder } = req.body;
+                const entry = this.cowMatcher.add(fromLimitOrderIntent(id, direction, intent, { ethAddress, relayedOrder }));
+                res.status(202).json({ success: true, id: entry.id, remaining: entry.remaining.toString() });
+            } catch (error) {
+                res.status(400).json({ success: false, error: error.message });
+            }
+        });
+
         // Manual order execution (for testing)
         this.app.post('/api/orders/:orderId/execute', async (req, res) => {
             try {
@@ -143,13 +178,30 @@ class ProductionRelayerService {
                 "event LimitOrderCreated(bytes32 indexed orderId, address indexed maker, address makerToken, address takerToken, uint256 makerAmount, uint256 takerAmount, uint256 deadline, string algorandAddress, bytes32 hashlock, uint256 timelock)",
                 "event LimitOrderFilled(bytes32 indexed orderId, address indexed resolver, bytes32 secret, uint256 algorandAmount, uint256 resolverFee)",
                 "function fillLimitOrder(bytes32 orderId, bytes32 secret, uint256 algorandAmount) external",
-                "function limitOrders(bytes32) external view returns (tuple(tuple(address,address,address,uint256,uint256,uint256,uint256,string,bytes32) intent, bytes32 hashlock, uint256 timelock, uint256 depositedAmount, bool filled, bool cancelled, uint256 createdAt, address resolver))"
+                "function limitOrders(bytes32) external view returns (tuple(tuple(address,address,address,uint256,uint256,uint256,uint256,string,bytes32) intent, bytes32 hashlock, uint256 timelocks, uint256 depositedAmount, bool filled, bool cancelled, address resolver))",
+                "function getOrderExpiry(bytes32 orderId) external view returns (uint256)"
             ];
             
             // Replace with your deployed contract address
             const limitOrderAddress = process.env.LIMIT_ORDER_BRIDGE_ADDRESS || "0xYourContractAddress";
             this.limitOrderBridge = new ethers.Contract(limitOrderAddress, limitOrderABI, this.ethWallet);
             
+            // Gasless intent pool (EnhancedLimitOrderBridge.submitRelayedLimitOrders)
+            const enhancedBridgeAddress = process.env.ENHANCED_LIMIT_ORDER_BRIDGE_ADDRESS;
+            if (enhancedBridgeAddress) {
+                const enhancedBridge = new ethers.Contract(enhancedBridgeAddress, RELAYED_SUBMIT_ABI, this.ethWallet);
+                const { chainId } = await this.ethProvider.getNetwork();
+                const domain = { name: 'EnhancedLimitOrderBridge', version: '1', chainId, verifyingContract: enhancedBridgeAddress };
+                this.intentPool = createBridgeIntentPool(enhancedBridge, domain);
+                this.intentPool.on('submitted', ({ keys, txHash }) => {
+                    console.log(`⛽ Submitted ${keys.length} gasless intents: ${txHash}`);
+                    this.io.emit('intentsSubmitted', { keys, txHash });
+                });
+                this.intentPool.on('dropped', ({ key, reason }) => console.log(`⚠️ Intent ${key} dropped: ${reason}`));
+                this.intentPool.start();
+            }
+            this.startCowMatching();
+            
             // Initialize Algorand client
             this.algoClient = new algosdk.Algodv2(
                 '', 
@@ -168,6 +220,51 @@ class ProductionRelayerService {
         }
     }
 
+    /**
+     * ALGO/ETH TWAP as microAlgos per wei, or null while the oracle is stale
+     */
+    cowReferencePrice() {
+        const snapshot = this.priceOracle ? this.priceOracle.getPrice('ALGO/ETH') : null;
+        if (!snapshot || snapshot.stale || !(snapshot.twap > 0)) return null;
+        return { num: 10n ** 6n, den: BigInt(Math.round(snapshot.twap * 1e18)) };
+    }
+
+    startCowMatching() {
+        if (this.cowTimer) return;
+        this.priceOracle = getPriceOracle();
+        const intervalMs = parseInt(process.env.COW_MATCH_INTERVAL_MS || '5000', 10);
+        this.cowTimer = setInterval(() => this.runCowRound(), intervalMs);
+    }
+
+    /**
+     * One matching round: matched pairs settle maker-to-maker, intents left
+     * unmatched past the wait go to the resolver route (gasless pool if signed for it)
+     */
+    runCowRound() {
+        const { matches, expired } = this.cowMatcher.match();
+        const residual = this.cowMatcher.takeResidual();
+        const toResolvers = [];
+        for (const entry of residual) {
+            if (entry.untouched && entry.relayedOrder && this.intentPool) {
+                this.intentPool.add(entry.relayedOrder);
+            } else {
+                toResolvers.push(entry);
+            }
+        }
+
+        if (matches.length > 0) {
+            const plan = planSettlement(matches, toResolvers);
+            console.log(`🤝 ${matches.length} CoW matches: ${plan.htlcs} HTLCs instead of ${plan.htlcsWithoutMatching}`);
+            this.io.emit('cowMatches', JSON.parse(JSON.stringify(plan, (key, value) => typeof value === 'bigint' ? value.toString() : value)));
+        }
+        for (const entry of toResolvers) {
+            this.io.emit('cowResidual', { id: entry.id, direction: entry.direction, remaining: entry.remaining.toString(), untouched: entry.untouched });
+        }
+        for (const id of expired) {
+            this.io.emit('cowExpired', { id });
+        }
+    }
+
     async startMonitoring() {
         console.log('📡 Starting blockchain monitoring...');
         
@@ -0,0 +1,203 @@
+#!/usr/bin/env node
+
+/**
+ * 📝 RELAYER LOGGER
+ *
+ * Structured JSON logging for relayer hot loops:
+ * ✅ Levels (trace → error) filtered before any formatting work
+ * ✅ Per-swap context via child loggers (orderHash, htlcId, lane, ...)
+ * ✅ Rate-limited sampling for repetitive messages, with suppressed counts
+ * ✅ Non-blocking writer: lines are batched and flushed off the hot path,
+ *    respecting stream backpressure with a bounded buffer
+ *
+ * Environment:
+ *   LOG_LEVEL   trace | debug | info | warn | error   (default info)
+ *   LOG_FORMAT  json | pretty                          (default json, pretty on a TTY)
+ *   LOG_FILE    append to this file instead of stdout
+ */
+
+const fs = require('fs');
+
+const LEVELS = { trace: 10, debug: 20, info: 30, warn: 40, error: 50, silent: 100 };
+const LEVEL_ICONS = { trace: '🔍', debug: '🐛', info: 'ℹ️ ', warn: '⚠️ ', error: '❌' };
+
+const jsonReplacer = (key, value) => {
+    if (typeof value === 'bigint') return value.toString();
+    if (value instanceof Error) return { message: value.message, code: value.code, stack: value.stack };
+    return value;
+};
+
+/**
+ * Batches lines and hands them to the stream once per tick. If the stream
+ * signals backpressure, lines stay buffered until 'drain'; beyond
+ * `maxBufferedLines` the oldest are dropped and counted.
+ */
+class AsyncLineWriter {
+    constructor(stream, options = {}) {
+        this.stream = stream;
+        this.maxBufferedLines = options.maxBufferedLines || 10000;
+        this.buffer = [];
+        this.dropped = 0;
+        this.scheduled = false;
+        this.blocked = false;
+
+        this.stream.on && this.stream.on('drain', () => {
+            this.blocked = false;
+            this.schedule();
+        });
+    }
+
+    write(line) {
+        if (this.buffer.length >= this.maxBufferedLines) {
+            this.buffer.shift();
+            this.dropped++;
+        }
+        this.buffer.push(line);
+        this.schedule();
+    }
+
+    schedule() {
+        if (this.scheduled || this.blocked || this.buffer.length === 0) return;
+        this.scheduled = true;
+        setImmediate(() => {
+            this.scheduled = false;
+            this.flush();
+        });
+    }
+
+    flush() {
+        if (this.blocked || this.buffer.length === 0) return;
+        if (this.dropped > 0) {
+            this.buffer.unshift(JSON.stringify({ time: new Date().toISOString(), level: 'warn', msg: 'log lines dropped', dropped: this.dropped }) + '\n');
+            this.dropped = 0;
+        }
+        const chunk = this.buffer.join('');
+        this.buffer = [];
+        if (!this.stream.write(chunk)) this.blocked = true;
+    }
+
+    /** Synchronous last-chance flush (process exit) for fd-backed streams. */
+    flushSync() {
+        if (this.buffer.length === 0) return;
+        const chunk = this.buffer.join('');
+        this.buffer = [];
+        try {
+            if (typeof this.stream.fd === 'number') {
+                fs.writeSync(this.stream.fd, chunk);
+            } else {
+                this.stream.write(chunk);
+            }
+        } catch (error) {
+            // Nothing sensible left to do during shutdown
+        }
+    }
+}
+
+class Logger {
+    constructor(options = {}, context = {}, shared = null) {
+        this.shared = shared || Logger.createShared(options);
+        this.context = context;
+    }
+
+    static createShared(options) {
+        const file = options.file ?? process.env.LOG_FILE;
+        const stream = options.stream || (file ? fs.createWriteStream(file, { flags: 'a' }) : process.stdout);
+        const format = options.format || process.env.LOG_FORMAT || (stream.isTTY ? 'pretty' : 'json');
+        const writer = new AsyncLineWriter(stream, options);
+        const shared = {
+            level: LEVELS[options.level || process.env.LOG_LEVEL || 'info'] ?? LEVELS.info,
+            format,
+            writer,
+            samplers: new Map(),   // key -> { last, suppressed }
+            now: options.now || Date.now
+        };
+        if (options.flushOnExit !== false) process.once('exit', () => writer.flushSync());
+        return shared;
+    }
+
+    /** Logger that adds `fields` to every line (e.g. { orderHash, lane }). */
+    child(fields) {
+        return new Logger(null, { ...this.context, ...fields }, this.shared);
+    }
+
+    isEnabled(level) {
+        return LEVELS[level] >= this.shared.level;
+    }
+
+    setLevel(level) {
+        this.shared.level = LEVELS[level] ?? this.shared.level;
+    }
+
+    write(level, msg, fields) {
+        if (LEVELS[level] < this.shared.level) return;
+        const time = new Date(this.shared.now()).toISOString();
+
+        if (this.shared.format === 'pretty') {
+            const extra = { ...this.context, ...fields };
+            const keys = Object.keys(extra);
+            const suffix = keys.length ? ' ' + keys.map(key => `${key}=${typeof extra[key] === 'object' ? JSON.stringify(extra[key], jsonReplacer) : extra[key]}`).join(' ') : '';
+            this.shared.writer.write(`${time} ${LEVEL_ICONS[level]} ${msg}${suffix}\n`);
+            return;
+        }
+        this.shared.writer.write(JSON.stringify({ time, level, msg, ...this.context, ...fields }, jsonReplacer) + '\n');
+    }
+
+    trace(msg, fields) { this.write('trace', msg, fields); }
+    debug(msg, fields) { this.write('debug', msg, fields); }
+    info(msg, fields) { this.write('info', msg, fields); }
+    warn(msg, fields) { this.write('warn', msg, fields); }
+    error(msg, fields) { this.write('error', msg, fields); }
+
+    /**
+     * Rate-limited view for repetitive messages: at most one line per
+     * `intervalMs` per key; the next emitted line carries `suppressed: n`.
+     *
+     *   log.sampled('lop-poll', 60000).info('LOP poll', { fromBlock, toBlock })
+     */
+    sampled(key, intervalMs = 60000) {
+        const parent = this;
+        const emit = (level, msg, fields) => {
+            if (!parent.isEnabled(level)) return;
+            const now = parent.shared.now();
+            const state = parent.shared.samplers.get(key) || { last: -Infinity, suppressed: 0 };
+            parent.shared.samplers.set(key, state);
+            if (now - state.last < intervalMs) {
+                state.suppressed++;
+                return;
+            }
+            const suppressed = state.suppressed;
+            state.last = now;
+            state.suppressed = 0;
+            parent.write(level, msg, suppressed > 0 ? { ...fields, suppressed } : fields);
+        };
+        return {
+            trace: (msg, fields) => emit('trace', msg, fields),
+            debug: (msg, fields) => emit('debug', msg, fields),
+            info: (msg, fields) => emit('info', msg, fields),
+            warn: (msg, fields) => emit('warn', msg, fields),
+            error: (msg, fields) => emit('error', msg, fields)
+        };
+    }
+
+    flush() {
+        this.shared.writer.flush();
+    }
+}
+
+let sharedLogger = null;
+
+/** Process-wide logger; `component` is added as a context field. */
+function getLogger(component, options = {}) {
+    if (!sharedLogger) sharedLogger = new Logger(options);
+    return component ? sharedLogger.child({ component }) : sharedLogger;
+}
+
+if (require.main === module) {
+    const log = getLogger('demo', { level: 'debug' });
+    const swap = log.child({ orderHash: '0xabc', htlcId: 'TXN123' });
+    swap.info('swap committed', { ethAmount: 10n ** 16n, block: 123 });
+    for (let i = 0; i < 1000; i++) log.sampled('poll', 1000).debug('poll tick', { round: i });
+    log.warn('bid not profitable', { margin: 0.013 });
+}
+
+module.exports = { Logger, AsyncLineWriter, getLogger, LEVELS };
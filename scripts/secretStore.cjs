@@ -0,0 +1,128 @@
+#!/usr/bin/env node
+
+/**
+ * 🔑 RELAYER SECRET STORE
+ *
+ * Bridges in event-only mode (setEventOnlySecrets) keep revealed preimages only
+ * in SecretRevealed logs; revealedSecrets / getRevealedSecret return zero there.
+ * This store is the relayer's copy:
+ * ✅ Backfills SecretRevealed logs in block chunks, then follows live events
+ * ✅ Per-id recovery through the indexed id topic, newest blocks first
+ * ✅ Falls back to getRevealedSecret for bridges that still store secrets
+ * ✅ Idempotent, with optional JSON persistence and a resume block
+ */
+
+const fs = require('fs');
+const { EventEmitter } = require('events');
+
+const DEFAULT_CHUNK_BLOCKS = 5000;
+const DEFAULT_LOOKBACK_BLOCKS = 50000; // ~1 week of Ethereum blocks
+const ZERO_SECRET = '0x' + '00'.repeat(32);
+
+class SecretStore extends EventEmitter {
+    /**
+     * @param {object} options { chunkBlocks, lookbackBlocks, persistPath, eventName }
+     * Emits 'secret' { id, secret, blockNumber, transactionHash } once per new secret.
+     */
+    constructor(options = {}) {
+        super();
+        this.chunkBlocks = options.chunkBlocks || DEFAULT_CHUNK_BLOCKS;
+        this.lookbackBlocks = options.lookbackBlocks || DEFAULT_LOOKBACK_BLOCKS;
+        this.persistPath = options.persistPath || null;
+        this.eventName = options.eventName || 'SecretRevealed';
+        this.secrets = new Map(); // id -> { secret, blockNumber, transactionHash }
+        this.lastBlock = 0;
+        this.load();
+    }
+
+    put(id, secret, meta = {}, { persist = true } = {}) {
+        if (!secret || secret === ZERO_SECRET) return false;
+        if (meta.blockNumber > this.lastBlock) this.lastBlock = meta.blockNumber;
+        if (this.secrets.has(id)) return false;
+
+        const entry = { secret, blockNumber: meta.blockNumber, transactionHash: meta.transactionHash };
+        this.secrets.set(id, entry);
+        this.emit('secret', { id, ...entry });
+        if (persist) this.save();
+        return true;
+    }
+
+    get(id) {
+        const entry = this.secrets.get(id);
+        return entry ? entry.secret : null;
+    }
+
+    /**
+     * Replay SecretRevealed logs from fromBlock to toBlock (inclusive) in chunks.
+     * @returns {Promise<number>} secrets added
+     */
+    async backfill(contract, fromBlock, toBlock) {
+        let added = 0;
+        for (let start = fromBlock; start <= toBlock; start += this.chunkBlocks) {
+            const end = Math.min(start + this.chunkBlocks - 1, toBlock);
+            const logs = await contract.queryFilter(contract.filters[this.eventName](), start, end);
+            for (const log of logs) {
+                if (this.put(log.args[0], log.args[1], log, { persist: false })) added++;
+            }
+        }
+        if (toBlock > this.lastBlock) this.lastBlock = toBlock;
+        this.save();
+        return added;
+    }
+
+    /**
+     * Follow new events (ethers v6 passes the event payload last; its .log carries the position).
+     */
+    attach(contract) {
+        contract.on(this.eventName, (id, secret, payload) => {
+            this.put(id, secret, (payload && payload.log) || payload || {});
+        });
+    }
+
+    /**
+     * Secret for one id: local copy, then its logs (newest first, lookbackBlocks deep),
+     * then the storage getter. Null if it was not revealed in that window.
+     */
+    async resolve(contract, id, options = {}) {
+        const cached = this.get(id);
+        if (cached) return cached;
+
+        const toBlock = options.toBlock ?? await contract.runner.provider.getBlockNumber();
+        const fromBlock = Math.max(options.fromBlock ?? toBlock - this.lookbackBlocks + 1, 0);
+        const filter = contract.filters[this.eventName](id);
+        for (let end = toBlock; end >= fromBlock; end -= this.chunkBlocks) {
+            const start = Math.max(end - this.chunkBlocks + 1, fromBlock);
+            const logs = await contract.queryFilter(filter, start, end);
+            const log = logs.find(entry => entry.args[0] === id);
+            if (log) {
+                this.put(id, log.args[1], log);
+                return log.args[1];
+            }
+        }
+
+        if (typeof contract.getRevealedSecret === 'function') {
+            const stored = await contract.getRevealedSecret(id);
+            if (this.put(id, stored)) return stored;
+        }
+        return null;
+    }
+
+    load() {
+        if (!this.persistPath || !fs.existsSync(this.persistPath)) return;
+        try {
+            const data = JSON.parse(fs.readFileSync(this.persistPath, 'utf8'));
+            this.secrets = new Map(data.secrets || []);
+            this.lastBlock = data.lastBlock || 0;
+        } catch (error) {
+            console.log(`⚠️ Could not load secret store ${this.persistPath}, starting fresh`);
+        }
+    }
+
+    save() {
+        if (!this.persistPath) return;
+        const data = { lastBlock: this.lastBlock, secrets: [...this.secrets.entries()] };
+        fs.writeFileSync(this.persistPath, JSON.stringify(data, null, 2));
+    }
+}
+
+module.exports = { SecretStore, ZERO_SECRET };
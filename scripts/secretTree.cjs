@@ -0,0 +1,172 @@
+#!/usr/bin/env node
+
+/**
+ * 🌳 SECRET TREE
+ *
+ * Off-chain twin of contracts/MultiFillSecretLib.sol for orders filled in parts:
+ * ✅ partsAmount + 1 random secrets, leaf i = keccak256(uint64(i) ‖ keccak256(secret_i))
+ * ✅ Tree built once bottom-up (sorted-pair hashing, same as OpenZeppelin MerkleProof)
+ * ✅ O(log n) proofs from the stored levels, no rebuild per fill
+ * ✅ secretIndex() mirrors the contract's part/index rule, so a resolver knows
+ *    which secret (and proof) its fill needs before sending it
+ *
+ * Use with submitLimitOrderWithSecretTree / fillLimitOrderWithProof
+ * (PartialFillLimitOrderBridge) and executePartialFillWithProof (EnhancedLimitOrderBridge).
+ */
+
+const crypto = require('crypto');
+
+let defaultHash = null;
+function keccak256(data) {
+    if (!defaultHash) {
+        const { ethers } = require('ethers');
+        defaultHash = (bytes) => Buffer.from(ethers.keccak256(bytes).slice(2), 'hex');
+    }
+    return defaultHash(data);
+}
+
+const toBuffer = (value) => Buffer.isBuffer(value)
+    ? value
+    : Buffer.from(String(value).replace(/^0x/, ''), 'hex');
+const toHex = (buffer) => '0x' + buffer.toString('hex');
+
+/**
+ * Which secret a fill must reveal (MultiFillSecretLib.secretIndex).
+ * Amounts are BigInt-compatible; returns { valid, index }.
+ */
+function secretIndex(orderAmount, filledBefore, fillAmount, partsAmount) {
+    const total = BigInt(orderAmount);
+    const before = BigInt(filledBefore);
+    const parts = BigInt(partsAmount);
+    const after = before + BigInt(fillAmount);
+    const index = (after - 1n) * parts / total;
+
+    if (after === total) return { valid: true, index: Number(index + 1n) };
+    if (before !== 0n && (before - 1n) * parts / total === index) return { valid: false, index: Number(index) };
+    return { valid: true, index: Number(index) };
+}
+
+class SecretTree {
+    /**
+     * @param {Array<Buffer|string>} secrets  partsAmount + 1 secrets (32 bytes each)
+     * @param {object} [options]
+     * @param {function} [options.hash]       Buffer => Buffer (defaults to keccak256 via ethers)
+     */
+    constructor(secrets, options = {}) {
+        if (secrets.length < 3) throw new Error('A secret tree needs at least 2 parts (3 secrets)');
+        this.hash = options.hash || keccak256;
+        this.secrets = secrets.map(toBuffer);
+        this.partsAmount = this.secrets.length - 1;
+        this.secretHashes = this.secrets.map(secret => this.hash(secret));
+        this.leaves = this.secretHashes.map((secretHash, index) => this.leaf(index, secretHash));
+        this.levels = this.build(this.leaves);
+    }
+
+    static generate(partsAmount, options = {}) {
+        const secrets = Array.from({ length: partsAmount + 1 }, () => crypto.randomBytes(32));
+        return new SecretTree(secrets, options);
+    }
+
+    leaf(index, secretHash) {
+        const packed = Buffer.alloc(40);
+        packed.writeBigUInt64BE(BigInt(index), 0);
+        secretHash.copy(packed, 8);
+        return this.hash(packed);
+    }
+
+    hashPair(a, b) {
+        return Buffer.compare(a, b) <= 0
+            ? this.hash(Buffer.concat([a, b]))
+            : this.hash(Buffer.concat([b, a]));
+    }
+
+    // levels[0] = leaves, last level = [root]; an odd node is carried up unchanged
+    build(leaves) {
+        const levels = [leaves];
+        let level = leaves;
+        while (level.length > 1) {
+            const next = new Array(Math.ceil(level.length / 2));
+            for (let i = 0; i < level.length; i += 2) {
+                next[i >> 1] = i + 1 < level.length ? this.hashPair(level[i], level[i + 1]) : level[i];
+            }
+            levels.push(next);
+            level = next;
+        }
+        return levels;
+    }
+
+    get root() {
+        return toHex(this.levels[this.levels.length - 1][0]);
+    }
+
+    proof(index) {
+        if (index < 0 || index > this.partsAmount) throw new Error(`Secret index ${index} out of range`);
+        const proof = [];
+        let position = index;
+        for (let depth = 0; depth < this.levels.length - 1; depth++) {
+            const level = this.levels[depth];
+            const sibling = position ^ 1;
+            if (sibling < level.length) proof.push(toHex(level[sibling]));
+            position >>= 1;
+        }
+        return proof;
+    }
+
+    verify(index, secret, proof) {
+        let node = this.leaf(index, this.hash(toBuffer(secret)));
+        for (const sibling of proof) node = this.hashPair(node, toBuffer(sibling));
+        return toHex(node) === this.root;
+    }
+
+    secret(index) {
+        return toHex(this.secrets[index]);
+    }
+
+    /**
+     * Everything a resolver needs to send one fill, or null if the fill stays inside the last filled part.
+     */
+    fillArgs(orderAmount, filledBefore, fillAmount) {
+        const { valid, index } = secretIndex(orderAmount, filledBefore, fillAmount, this.partsAmount);
+        if (!valid) return null;
+        return { index, secret: this.secret(index), proof: this.proof(index) };
+    }
+
+    /**
+     * Smallest fill from filledBefore that reaches the next part boundary.
+     */
+    static minFillToNextPart(orderAmount, filledBefore, partsAmount) {
+        const total = BigInt(orderAmount);
+        const parts = BigInt(partsAmount);
+        const before = BigInt(filledBefore);
+        const part = before === 0n ? 0n : (before - 1n) * parts / total + 1n;
+        if (part >= parts) return total - before;
+        // First amount whose (after - 1) * parts / total reaches `part`
+        const after = (part * total + parts - 1n) / parts + 1n;
+        return (after > total ? total : after) - before;
+    }
+
+    toJSON() {
+        return {
+            root: this.root,
+            partsAmount: this.partsAmount,
+            secrets: this.secrets.map(toHex)
+        };
+    }
+
+    static fromJSON(json, options = {}) {
+        return new SecretTree(json.secrets, options);
+    }
+}
+
+if (require.main === module) {
+    const partsAmount = parseInt(process.argv[2] || '4', 10);
+    const tree = SecretTree.generate(partsAmount);
+    console.log('🌳 SECRET TREE');
+    console.log(`   Parts: ${partsAmount} (${partsAmount + 1} secrets)`);
+    console.log(`   Root:  ${tree.root}`);
+    for (let i = 0; i <= partsAmount; i++) {
+        console.log(`   #${i} secret ${tree.secret(i)} proof [${tree.proof(i).length}]`);
+    }
+}
+
+module.exports = { SecretTree, secretIndex };
@@ -0,0 +1,180 @@
+#!/usr/bin/env node
+
+/**
+ * 📦 SETTLEMENT BATCHER
+ *
+ * Collects claims/refunds and settles them through the contracts' batch*
+ * entry points (batchExecuteHTLCWithSecret, batchRefundHTLC,
+ * batchExecuteCrossChainSwap, batchWithdrawWithSecret, ...):
+ * ✅ Flushes when a batch is full or after a short collection window
+ * ✅ Dedupes by id (a second add() returns the pending promise)
+ * ✅ Per-item results from the contract's *BatchResult events
+ * ✅ A reverted batch is split in half and retried, so one bad payout
+ *    cannot hold back the rest of the backlog
+ *
+ * Env: SETTLEMENT_BATCH_SIZE (default 50), SETTLEMENT_BATCH_WINDOW_MS (default 2000)
+ */
+
+const { EventEmitter } = require('events');
+
+class SettlementBatcher extends EventEmitter {
+    /**
+     * @param {object} options
+     * @param {string} options.name             label used in events/logs
+     * @param {function} options.submit         async (items) => ({ results: Map<id, {success, reason}>, txHash })
+     * @param {number} [options.maxBatch]
+     * @param {number} [options.windowMs]
+     */
+    constructor(options = {}) {
+        super();
+        if (typeof options.submit !== 'function') throw new Error('SettlementBatcher needs a submit(items) function');
+
+        this.name = options.name || 'settlement';
+        this.submitBatch = options.submit;
+        this.maxBatch = options.maxBatch || parseInt(process.env.SETTLEMENT_BATCH_SIZE || '50', 10);
+        this.windowMs = options.windowMs !== undefined
+            ? options.windowMs
+            : parseInt(process.env.SETTLEMENT_BATCH_WINDOW_MS || '2000', 10);
+
+        this.queue = new Map();        // id -> { id, args, promise, resolve }
+        this.timer = null;
+        this.running = Promise.resolve();
+        this.stats = { batches: 0, items: 0, settled: 0, skipped: 0, splits: 0 };
+    }
+
+    get pending() {
+        return this.queue.size;
+    }
+
+    /**
+     * Queue one item; resolves with { success, reason, txHash } once its batch is mined.
+     */
+    add(id, args) {
+        const queued = this.queue.get(id);
+        if (queued) return queued.promise;
+
+        let resolve;
+        const promise = new Promise(r => { resolve = r; });
+        this.queue.set(id, { id, args, promise, resolve });
+
+        if (this.queue.size >= this.maxBatch) {
+            this.flush();
+        } else if (!this.timer) {
+            this.timer = setTimeout(() => this.flush(), this.windowMs);
+        }
+        return promise;
+    }
+
+    /**
+     * Send everything queued so far. Batches are mined one after another.
+     */
+    flush() {
+        if (this.timer) {
+            clearTimeout(this.timer);
+            this.timer = null;
+        }
+        if (this.queue.size === 0) return this.running;
+
+        const items = [...this.queue.values()];
+        this.queue.clear();
+
+        const chunks = [];
+        for (let i = 0; i < items.length; i += this.maxBatch) {
+            chunks.push(items.slice(i, i + this.maxBatch));
+        }
+
+        this.running = this.running.then(async () => {
+            for (const chunk of chunks) await this.settle(chunk);
+        });
+        return this.running;
+    }
+
+    async settle(items) {
+        this.stats.batches++;
+        let outcome;
+        try {
+            outcome = await this.submitBatch(items.map(({ id, args }) => ({ id, args })));
+        } catch (error) {
+            if (items.length === 1) {
+                this.finish(items[0], { success: false, reason: error.message, txHash: null });
+                return;
+            }
+            // Whole batch reverted (e.g. a payout transfer failed): bisect
+            this.stats.splits++;
+            this.emit('split', { name: this.name, size: items.length, error });
+            const middle = Math.ceil(items.length / 2);
+            await this.settle(items.slice(0, middle));
+            await this.settle(items.slice(middle));
+            return;
+        }
+
+        const results = outcome.results || new Map();
+        for (const item of items) {
+            const result = results.get(item.id) || { success: false, reason: 'No batch result emitted' };
+            this.finish(item, { success: result.success, reason: result.reason || '', txHash: outcome.txHash });
+        }
+        this.emit('batch', { name: this.name, size: items.length, txHash: outcome.txHash });
+    }
+
+    finish(item, result) {
+        this.stats.items++;
+        if (result.success) this.stats.settled++;
+        else this.stats.skipped++;
+        this.emit('result', { name: this.name, id: item.id, ...result });
+        item.resolve(result);
+    }
+
+    /**
+     * Map *BatchResult(id indexed, success, reason) events in a receipt to per-item results.
+     * A bytes4 reason is a custom error selector and is resolved to the error name.
+     */
+    static resultsFromReceipt(contractInterface, receipt, eventName = 'HTLCBatchResult') {
+        const results = new Map();
+        for (const log of receipt.logs) {
+            let parsed;
+            try {
+                parsed = contractInterface.parseLog(log);
+            } catch {
+                continue;
+            }
+            if (!parsed || parsed.name !== eventName) continue;
+            results.set(parsed.args[0], { success: parsed.args[1], reason: SettlementBatcher.reasonName(contractInterface, parsed.args[2]) });
+        }
+        return results;
+    }
+
+    static reasonName(contractInterface, reason) {
+        if (typeof reason !== 'string' || !/^0x[0-9a-fA-F]{8}$/.test(reason)) return reason;
+        if (/^0x0{8}$/.test(reason)) return '';
+        try {
+            return contractInterface.parseError(reason)?.name || reason;
+        } catch {
+            return reason;
+        }
+    }
+}
+
+if (require.main === module) {
+    // Demo against a fake contract that rejects odd ids and reverts on id 7
+    const batcher = new SettlementBatcher({
+        name: 'demo',
+        maxBatch: 4,
+        windowMs: 50,
+        async submit(items) {
+            if (items.some(item => item.id === 7)) throw new Error('ETH transfer failed');
+            const results = new Map(items.map(item => [item.id, {
+                success: item.id % 2 === 0,
+                reason: item.id % 2 === 0 ? '' : 'Invalid secret'
+            }]));
+            return { results, txHash: `0xbatch${items.map(item => item.id).join('')}` };
+        }
+    });
+    batcher.on('split', ({ size, error }) => console.log(`✂️  Batch of ${size} reverted (${error.message}), splitting`));
+
+    Promise.all([...Array(10).keys()].map(id => batcher.add(id, {}))).then(results => {
+        results.forEach((result, id) => console.log(`${result.success ? '✅' : '❌'} ${id} ${result.reason} ${result.txHash || ''}`));
+        console.log('📊', batcher.stats);
+    });
+}
+
+module.exports = { SettlementBatcher };
@@ -0,0 +1,598 @@
+#!/usr/bin/env node
+
+/**
+ * 🧮 OFFLINE TEAL INTERPRETER
+ *
+ * Local stand-in for algod dryrun/simulate, covering the opcodes the Algorand
+ * HTLC programs in this repo use:
+ * ✅ Assembles TEAL source (labels, int/byte/addr pseudo-ops, named constants)
+ * ✅ Runs application calls and logic signatures against an in-memory ledger
+ *    (global/local state, boxes); state changes commit only when approved
+ * ✅ Opcode cost as in the AVM cost table, checked against a dynamic budget
+ * ✅ Reports logs, inner transactions and the state delta of every call
+ *
+ * Not modeled: account balances and minimum balances, asset ops, foreign app
+ * references. Unsupported opcodes fail the call with a clear error.
+ */
+
+const crypto = require('crypto');
+const { decodeAlgorandAddress, encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+
+const APP_BUDGET = 700;        // per application call, pooled across a group
+const LOGIC_SIG_BUDGET = 20000;
+const MAX_LOGS = 32;
+const MAX_LOG_BYTES = 1024;
+const MIN_TXN_FEE = 1000;
+
+const OPCODE_COSTS = { sha256: 35, sha512_256: 45, keccak256: 130 };
+
+const NAMED_INTS = {
+    pay: 1, keyreg: 2, acfg: 3, axfer: 4, afrz: 5, appl: 6,
+    NoOp: 0, OptIn: 1, CloseOut: 2, ClearState: 3, UpdateApplication: 4, DeleteApplication: 5
+};
+
+const ADDRESS_FIELDS = new Set(['Sender', 'Receiver', 'CloseRemainderTo', 'RekeyTo']);
+const ZERO_ADDRESS = Buffer.alloc(32);
+
+class TealError extends Error {
+    constructor(message, line) {
+        super(line ? `${message} (line ${line})` : message);
+        this.line = line;
+    }
+}
+
+const hexOf = (bytes) => Buffer.from(bytes).toString('hex');
+
+function addressBytes(address) {
+    return Buffer.from(decodeAlgorandAddress(address).publicKey.slice(2), 'hex');
+}
+
+function applicationAddress(appId) {
+    const id = Buffer.alloc(8);
+    id.writeBigUInt64BE(BigInt(appId));
+    return crypto.createHash('sha512-256').update(Buffer.concat([Buffer.from('appID'), id])).digest();
+}
+
+/**
+ * Split one source line into tokens, keeping quoted strings whole
+ */
+function tokenize(line) {
+    const tokens = [];
+    let i = 0;
+    while (i < line.length) {
+        if (/\s/.test(line[i])) { i++; continue; }
+        if (line.startsWith('//', i)) break;
+        if (line[i] === '"') {
+            let j = i + 1;
+            while (j < line.length && line[j] !== '"') j += line[j] === '\\' ? 2 : 1;
+            tokens.push(line.slice(i, j + 1));
+            i = j + 1;
+        } else {
+            let j = i;
+            while (j < line.length && !/\s/.test(line[j])) j++;
+            tokens.push(line.slice(i, j));
+            i = j;
+        }
+    }
+    return tokens;
+}
+
+function parseBytes(tokens, line) {
+    const [first, second] = tokens;
+    if (first === undefined) throw new TealError('byte needs a value', line);
+    if (first.startsWith('"')) return Buffer.from(JSON.parse(first), 'utf8');
+    if (first.startsWith('0x')) return Buffer.from(first.slice(2), 'hex');
+    if (first === 'base64' || first === 'b64') return Buffer.from(second, 'base64');
+    if (first.startsWith('base64(') || first.startsWith('b64(')) return Buffer.from(first.slice(first.indexOf('(') + 1, -1), 'base64');
+    throw new TealError(`Unsupported byte constant ${first}`, line);
+}
+
+function parseInt64(token, line) {
+    if (token in NAMED_INTS) return BigInt(NAMED_INTS[token]);
+    if (!/^(0x[0-9a-fA-F]+|\d+)$/.test(token || '')) throw new TealError(`Bad int constant ${token}`, line);
+    return BigInt(token);
+}
+
+/**
+ * Assemble TEAL source → { version, ops, labels }
+ */
+function assembleTeal(source) {
+    const ops = [];
+    const labels = {};
+    let version = 1;
+    source.split('\n').forEach((raw, index) => {
+        const line = index + 1;
+        const tokens = tokenize(raw);
+        if (tokens.length === 0) return;
+        if (tokens[0] === '#pragma') {
+            if (tokens[1] === 'version') version = Number(tokens[2]);
+            return;
+        }
+        if (tokens.length === 1 && tokens[0].endsWith(':')) {
+            labels[tokens[0].slice(0, -1)] = ops.length;
+            return;
+        }
+        const [op, ...rest] = tokens;
+        const instruction = { op, line, args: rest };
+        if (op === 'int' || op === 'pushint') instruction.value = parseInt64(rest[0], line);
+        else if (op === 'byte' || op === 'pushbytes') instruction.value = parseBytes(rest, line);
+        else if (op === 'addr') instruction.value = addressBytes(rest[0]);
+        ops.push(instruction);
+    });
+    for (const { op, args, line } of ops) {
+        if ((op === 'b' || op === 'bz' || op === 'bnz' || op === 'callsub') && !(args[0] in labels)) {
+            throw new TealError(`Unknown label ${args[0]}`, line);
+        }
+    }
+    return { version, ops, labels };
+}
+
+const cloneLedger = (ledger) => ({
+    global: new Map(ledger.global),
+    local: new Map([...ledger.local].map(([account, state]) => [account, new Map(state)])),
+    boxes: new Map([...ledger.boxes].map(([name, value]) => [name, Buffer.from(value)]))
+});
+
+function createLedger() {
+    return { global: new Map(), local: new Map(), boxes: new Map() };
+}
+
+/**
+ * Printable view of a stack value
+ */
+function showValue(value) {
+    if (typeof value === 'bigint') return Number(value) <= Number.MAX_SAFE_INTEGER ? Number(value) : value.toString();
+    if (value.length === 32 && !/^[\x20-\x7e]*$/.test(value.toString('latin1'))) return encodeAlgorandAddress('0x' + hexOf(value));
+    return /^[\x20-\x7e]*$/.test(value.toString('latin1')) ? value.toString('latin1') : '0x' + hexOf(value);
+}
+
+function diffMaps(before, after, keyView) {
+    const delta = {};
+    for (const key of new Set([...before.keys(), ...after.keys()])) {
+        const a = before.get(key);
+        const b = after.get(key);
+        const same = a !== undefined && b !== undefined && typeof a === typeof b && (typeof a === 'bigint' ? a === b : Buffer.compare(a, b) === 0);
+        if (same) continue;
+        delta[keyView(key)] = b === undefined ? null : showValue(b);
+    }
+    return delta;
+}
+
+/**
+ * State delta between two ledgers: changed keys map to their new value, deleted ones to null
+ */
+function ledgerDelta(before, after) {
+    const local = {};
+    for (const account of new Set([...before.local.keys(), ...after.local.keys()])) {
+        const changes = diffMaps(before.local.get(account) || new Map(), after.local.get(account) || new Map(), key => Buffer.from(key, 'hex').toString('latin1'));
+        if (!after.local.has(account)) changes['(opted in)'] = null;
+        else if (!before.local.has(account)) changes['(opted in)'] = 1;
+        if (Object.keys(changes).length > 0) local[encodeAlgorandAddress('0x' + account)] = changes;
+    }
+    return {
+        global: diffMaps(before.global, after.global, key => Buffer.from(key, 'hex').toString('latin1')),
+        local,
+        boxes: diffMaps(before.boxes, after.boxes, key => '0x' + key)
+    };
+}
+
+class TealMachine {
+    /**
+     * @param {string|object} program TEAL source or assembleTeal() output
+     */
+    constructor(program) {
+        this.program = typeof program === 'string' ? assembleTeal(program) : program;
+    }
+
+    /**
+     * Run one transaction.
+     *
+     * @param {object} options
+     *   mode         'application' (default) or 'signature'
+     *   txn          transaction fields: Sender (address), ApplicationID, OnCompletion,
+     *                ApplicationArgs (Buffers), Fee, FirstValid, LastValid, Receiver, ...
+     *   group        other transactions of the group, by index (txn sits at txn.GroupIndex)
+     *   args         logic-signature arguments (Buffers)
+     *   ledger       { global, local, boxes } from createLedger(); updated on approval
+     *   appId        application id (for CurrentApplicationID/Address)
+     *   timestamp    LatestTimestamp; round: Round
+     *   budget       opcode budget (default 700 per app call or 20000 per logic signature)
+     * @returns {object} { approved, error, cost, budget, logs, innerTxns, delta }
+     */
+    run(options) {
+        const mode = options.mode || 'application';
+        const budget = options.budget ?? (mode === 'signature' ? LOGIC_SIG_BUDGET : APP_BUDGET);
+        const appId = BigInt(options.appId || 0);
+        const ledger = options.ledger || createLedger();
+        const working = cloneLedger(ledger);
+        const txn = this.normalizeTxn(options.txn || {}, mode === 'application' ? 'appl' : 'pay', appId);
+        const group = (options.group || []).map(fields => this.normalizeTxn(fields, 'pay', 0n));
+        group[Number(txn.GroupIndex)] = txn;
+
+        const state = {
+            mode, txn, group, ledger: working, budget,
+            args: (options.args || []).map(arg => Buffer.from(arg)),
+            globals: {
+                LatestTimestamp: BigInt(options.timestamp || 0),
+                Round: BigInt(options.round || 0),
+                MinTxnFee: BigInt(MIN_TXN_FEE),
+                ZeroAddress: ZERO_ADDRESS,
+                GroupSize: BigInt(group.length),
+                CurrentApplicationID: appId,
+                CurrentApplicationAddress: applicationAddress(appId),
+                CreatorAddress: options.creator ? addressBytes(options.creator) : ZERO_ADDRESS
+            },
+            stack: [], scratch: new Array(256).fill(0n), frames: [],
+            cost: 0, logs: [], innerTxns: [], pendingInner: null
+        };
+
+        // OptIn allocates local state before the program runs, CloseOut frees it afterwards
+        const sender = hexOf(txn.Sender);
+        if (mode === 'application' && txn.OnCompletion === BigInt(NAMED_INTS.OptIn) && !working.local.has(sender)) {
+            working.local.set(sender, new Map());
+        }
+
+        let approved = false;
+        let error = null;
+        try {
+            approved = this.execute(state);
+        } catch (caught) {
+            error = caught.message;
+        }
+        if (approved && mode === 'application' && txn.OnCompletion === BigInt(NAMED_INTS.CloseOut)) working.local.delete(sender);
+
+        const delta = approved ? ledgerDelta(ledger, working) : { global: {}, local: {}, boxes: {} };
+        if (approved) Object.assign(ledger, working);
+        return { approved, error, cost: state.cost, budget, logs: state.logs, innerTxns: state.innerTxns, delta };
+    }
+
+    normalizeTxn(fields, type, appId) {
+        const txn = {
+            TypeEnum: BigInt(NAMED_INTS[type]),
+            ApplicationID: appId,
+            OnCompletion: 0n,
+            Fee: BigInt(MIN_TXN_FEE),
+            FirstValid: 0n, LastValid: 0n, Amount: 0n, GroupIndex: 0n,
+            ApplicationArgs: []
+        };
+        for (const [field, value] of Object.entries(fields)) {
+            if (ADDRESS_FIELDS.has(field)) txn[field] = typeof value === 'string' ? addressBytes(value) : Buffer.from(value);
+            else if (field === 'ApplicationArgs') txn[field] = value.map(arg => Buffer.from(arg));
+            else if (field === 'OnCompletion' || field === 'TypeEnum') txn[field] = typeof value === 'string' ? BigInt(NAMED_INTS[value]) : BigInt(value);
+            else txn[field] = typeof value === 'number' || typeof value === 'bigint' ? BigInt(value) : Buffer.from(value);
+        }
+        for (const field of ADDRESS_FIELDS) if (!txn[field]) txn[field] = ZERO_ADDRESS;
+        txn.NumAppArgs = BigInt(txn.ApplicationArgs.length);
+        return txn;
+    }
+
+    execute(state) {
+        const { ops } = this.program;
+        let pc = 0;
+        while (pc < ops.length) {
+            const instruction = ops[pc];
+            state.cost += OPCODE_COSTS[instruction.op] || 1;
+            if (state.cost > state.budget) throw new TealError(`dynamic cost budget exceeded: ${state.cost} > ${state.budget}`, instruction.line);
+            const jump = this.step(state, instruction, pc);
+            if (jump === 'return') return this.finalValue(state, instruction.line);
+            pc = jump === undefined ? pc + 1 : jump;
+        }
+        return this.finalValue(state, ops.length ? ops[ops.length - 1].line : 0);
+    }
+
+    finalValue(state, line) {
+        if (state.stack.length !== 1) throw new TealError(`stack must hold one value at the end, has ${state.stack.length}`, line);
+        const value = state.stack.pop();
+        if (typeof value !== 'bigint') throw new TealError('program ended with a byte value', line);
+        return value !== 0n;
+    }
+
+    step(state, { op, args, value, line }, pc) {
+        const { stack } = state;
+        const pop = () => {
+            if (stack.length === 0) throw new TealError(`stack underflow in ${op}`, line);
+            return stack.pop();
+        };
+        const popUint = () => {
+            const item = pop();
+            if (typeof item !== 'bigint') throw new TealError(`${op} expects a uint64`, line);
+            return item;
+        };
+        const popBytes = () => {
+            const item = pop();
+            if (typeof item === 'bigint') throw new TealError(`${op} expects bytes`, line);
+            return item;
+        };
+        const push = (item) => {
+            if (typeof item === 'bigint' && (item < 0n || item > 0xffffffffffffffffn)) throw new TealError(`${op} overflowed`, line);
+            if (typeof item !== 'bigint' && item.length > 4096) throw new TealError(`${op} produced more than 4096 bytes`, line);
+            stack.push(item);
+        };
+        const appOnly = () => {
+            if (state.mode !== 'application') throw new TealError(`${op} is not allowed in a logic signature`, line);
+        };
+        const label = (name) => this.program.labels[name];
+        const local = (accountBytes) => {
+            const values = state.ledger.local.get(hexOf(accountBytes));
+            if (!values) throw new TealError(`${showValue(accountBytes)} has not opted in`, line);
+            return values;
+        };
+        const txnField = (txn, field, index) => {
+            if (field === 'ApplicationArgs') {
+                const arg = txn.ApplicationArgs[Number(index)];
+                if (arg === undefined) throw new TealError(`ApplicationArgs ${index} out of range`, line);
+                return arg;
+            }
+            if (!(field in txn)) throw new TealError(`Unsupported txn field ${field}`, line);
+            return txn[field];
+        };
+        const compare = (fn) => {
+            const b = pop();
+            const a = pop();
+            if (typeof a !== typeof b) throw new TealError(`${op} compares a uint64 with bytes`, line);
+            push(fn(a, b) ? 1n : 0n);
+        };
+        const uintOp = (fn) => {
+            const b = popUint();
+            const a = popUint();
+            push(fn(a, b));
+        };
+
+        switch (op) {
+        case 'int': case 'pushint': case 'byte': case 'pushbytes': case 'addr':
+            push(value);
+            return undefined;
+        case 'arg': {
+            const arg = state.args[Number(args[0])];
+            if (arg === undefined) throw new TealError(`arg ${args[0]} out of range`, line);
+            push(arg);
+            return undefined;
+        }
+        case 'arg_0': case 'arg_1': case 'arg_2': case 'arg_3': {
+            const arg = state.args[Number(op.slice(4))];
+            if (arg === undefined) throw new TealError(`${op} out of range`, line);
+            push(arg);
+            return undefined;
+        }
+        case 'txn': push(txnField(state.txn, args[0], args[1])); return undefined;
+        case 'txna': push(txnField(state.txn, args[0], args[1])); return undefined;
+        case 'txnas': push(txnField(state.txn, args[0], popUint())); return undefined;
+        case 'gtxn': case 'gtxna': push(txnField(this.groupTxn(state, BigInt(args[0]), line), args[1], args[2])); return undefined;
+        case 'gtxns': case 'gtxnsa': push(txnField(this.groupTxn(state, popUint(), line), args[0], args[1])); return undefined;
+        case 'global':
+            if (!(args[0] in state.globals)) throw new TealError(`Unsupported global ${args[0]}`, line);
+            push(state.globals[args[0]]);
+            return undefined;
+        case '==': compare((a, b) => typeof a === 'bigint' ? a === b : Buffer.compare(a, b) === 0); return undefined;
+        case '!=': compare((a, b) => typeof a === 'bigint' ? a !== b : Buffer.compare(a, b) !== 0); return undefined;
+        case '<': uintOp((a, b) => a < b ? 1n : 0n); return undefined;
+        case '>': uintOp((a, b) => a > b ? 1n : 0n); return undefined;
+        case '<=': uintOp((a, b) => a <= b ? 1n : 0n); return undefined;
+        case '>=': uintOp((a, b) => a >= b ? 1n : 0n); return undefined;
+        case '&&': uintOp((a, b) => a && b ? 1n : 0n); return undefined;
+        case '||': uintOp((a, b) => a || b ? 1n : 0n); return undefined;
+        case '+': uintOp((a, b) => a + b); return undefined;
+        case '-': uintOp((a, b) => a - b); return undefined;
+        case '*': uintOp((a, b) => a * b); return undefined;
+        case '/': uintOp((a, b) => {
+            if (b === 0n) throw new TealError('division by zero', line);
+            return a / b;
+        }); return undefined;
+        case '%': uintOp((a, b) => {
+            if (b === 0n) throw new TealError('modulo by zero', line);
+            return a % b;
+        }); return undefined;
+        case '!': push(popUint() === 0n ? 1n : 0n); return undefined;
+        case 'assert':
+            if (popUint() === 0n) throw new TealError('assert failed', line);
+            return undefined;
+        case 'err': throw new TealError('err opcode executed', line);
+        case 'return': {
+            const result = popUint();
+            stack.length = 0;
+            stack.push(result);
+            return 'return';
+        }
+        case 'b': return label(args[0]);
+        case 'bnz': return popUint() !== 0n ? label(args[0]) : undefined;
+        case 'bz': return popUint() === 0n ? label(args[0]) : undefined;
+        case 'callsub':
+            state.frames.push(pc + 1);
+            return label(args[0]);
+        case 'retsub':
+            if (state.frames.length === 0) throw new TealError('retsub without callsub', line);
+            return state.frames.pop();
+        case 'pop': pop(); return undefined;
+        case 'dup': { const top = pop(); push(top); push(top); return undefined; }
+        case 'swap': { const b = pop(); const a = pop(); push(b); push(a); return undefined; }
+        case 'load': push(state.scratch[Number(args[0])]); return undefined;
+        case 'store': state.scratch[Number(args[0])] = pop(); return undefined;
+        case 'concat': { const b = popBytes(); const a = popBytes(); push(Buffer.concat([a, b])); return undefined; }
+        case 'len': push(BigInt(popBytes().length)); return undefined;
+        case 'itob': { const word = Buffer.alloc(8); word.writeBigUInt64BE(popUint()); push(word); return undefined; }
+        case 'btoi': {
+            const bytes = popBytes();
+            if (bytes.length > 8) throw new TealError('btoi arg longer than 8 bytes', line);
+            push(bytes.length === 0 ? 0n : BigInt('0x' + hexOf(bytes)));
+            return undefined;
+        }
+        case 'sha256': push(crypto.createHash('sha256').update(popBytes()).digest()); return undefined;
+        case 'sha512_256': push(crypto.createHash('sha512-256').update(popBytes()).digest()); return undefined;
+        case 'extract': {
+            const bytes = popBytes();
+            const start = Number(args[0]);
+            const length = Number(args[1]) || bytes.length - start;
+            if (start + length > bytes.length) throw new TealError('extract out of range', line);
+            push(bytes.subarray(start, start + length));
+            return undefined;
+        }
+        case 'extract3': case 'substring3': {
+            const third = Number(popUint());
+            const start = Number(popUint());
+            const bytes = popBytes();
+            const end = op === 'extract3' ? start + third : third;
+            if (end > bytes.length || start > end) throw new TealError(`${op} out of range`, line);
+            push(bytes.subarray(start, end));
+            return undefined;
+        }
+        case 'extract_uint64': {
+            const offset = Number(popUint());
+            const bytes = popBytes();
+            if (offset + 8 > bytes.length) throw new TealError('extract_uint64 out of range', line);
+            push(bytes.readBigUInt64BE(offset));
+            return undefined;
+        }
+        case 'log': {
+            appOnly();
+            const message = popBytes();
+            state.logs.push(message);
+            if (state.logs.length > MAX_LOGS) throw new TealError('too many log calls', line);
+            if (state.logs.reduce((total, entry) => total + entry.length, 0) > MAX_LOG_BYTES) throw new TealError('logs exceed 1024 bytes', line);
+            return undefined;
+        }
+        case 'app_global_get': {
+            appOnly();
+            const key = hexOf(popBytes());
+            push(state.ledger.global.has(key) ? state.ledger.global.get(key) : 0n);
+            return undefined;
+        }
+        case 'app_global_put': {
+            appOnly();
+            const item = pop();
+            state.ledger.global.set(hexOf(popBytes()), item);
+            return undefined;
+        }
+        case 'app_global_del': appOnly(); state.ledger.global.delete(hexOf(popBytes())); return undefined;
+        case 'app_local_get': {
+            appOnly();
+            const key = hexOf(popBytes());
+            const values = local(popBytes());
+            push(values.has(key) ? values.get(key) : 0n);
+            return undefined;
+        }
+        case 'app_local_put': {
+            appOnly();
+            const item = pop();
+            const key = hexOf(popBytes());
+            local(popBytes()).set(key, item);
+            return undefined;
+        }
+        case 'app_local_del': {
+            appOnly();
+            const key = hexOf(popBytes());
+            local(popBytes()).delete(key);
+            return undefined;
+        }
+        case 'box_create': {
+            appOnly();
+            const size = Number(popUint());
+            const name = hexOf(popBytes());
+            const existing = state.ledger.boxes.get(name);
+            if (existing && existing.length !== size) throw new TealError('box exists with a different size', line);
+            if (!existing) state.ledger.boxes.set(name, Buffer.alloc(size));
+            push(existing ? 0n : 1n);
+            return undefined;
+        }
+        case 'box_get': {
+            appOnly();
+            const box = state.ledger.boxes.get(hexOf(popBytes()));
+            push(box ? Buffer.from(box) : Buffer.alloc(0));
+            push(box ? 1n : 0n);
+            return undefined;
+        }
+        case 'box_put': {
+            appOnly();
+            const data = popBytes();
+            const name = hexOf(popBytes());
+            const existing = state.ledger.boxes.get(name);
+            if (existing && existing.length !== data.length) throw new TealError('box_put size mismatch', line);
+            state.ledger.boxes.set(name, Buffer.from(data));
+            return undefined;
+        }
+        case 'box_replace': {
+            appOnly();
+            const data = popBytes();
+            const offset = Number(popUint());
+            const box = state.ledger.boxes.get(hexOf(popBytes()));
+            if (!box) throw new TealError('no such box', line);
+            if (offset + data.length > box.length) throw new TealError('box_replace out of range', line);
+            data.copy(box, offset);
+            return undefined;
+        }
+        case 'box_del': appOnly(); push(state.ledger.boxes.delete(hexOf(popBytes())) ? 1n : 0n); return undefined;
+        case 'box_len': {
+            appOnly();
+            const box = state.ledger.boxes.get(hexOf(popBytes()));
+            push(box ? BigInt(box.length) : 0n);
+            push(box ? 1n : 0n);
+            return undefined;
+        }
+        case 'itxn_begin':
+            appOnly();
+            if (state.pendingInner) throw new TealError('itxn_begin without itxn_submit', line);
+            state.pendingInner = [{}];
+            return undefined;
+        case 'itxn_next':
+            if (!state.pendingInner) throw new TealError('itxn_next without itxn_begin', line);
+            state.pendingInner.push({});
+            return undefined;
+        case 'itxn_field': {
+            if (!state.pendingInner) throw new TealError('itxn_field without itxn_begin', line);
+            const item = pop();
+            state.pendingInner[state.pendingInner.length - 1][args[0]] = showValue(item);
+            return undefined;
+        }
+        case 'itxn_submit':
+            if (!state.pendingInner) throw new TealError('itxn_submit without itxn_begin', line);
+            state.innerTxns.push(...state.pendingInner);
+            if (state.innerTxns.length > 256) throw new TealError('too many inner transactions', line);
+            state.pendingInner = null;
+            return undefined;
+        default:
+            throw new TealError(`Unsupported opcode ${op}`, line);
+        }
+    }
+
+    groupTxn(state, index, line) {
+        const txn = state.group[Number(index)];
+        if (!txn) throw new TealError(`group index ${index} out of range`, line);
+        return txn;
+    }
+}
+
+/**
+ * Fee a call needs at the minimum fee: the transaction itself plus every inner transaction
+ */
+function callFee(result, groupTxns = 1) {
+    return (groupTxns + result.innerTxns.length) * MIN_TXN_FEE;
+}
+
+if (require.main === module) {
+    const fs = require('fs');
+    const file = process.argv[2];
+    if (!file) {
+        console.log('Usage: node scripts/tealInterpreter.cjs <program.teal>');
+        process.exit(1);
+    }
+    const program = assembleTeal(fs.readFileSync(file, 'utf8'));
+    console.log('🧮 TEAL PROGRAM');
+    console.log('===============');
+    console.log(`   Version: ${program.version}`);
+    console.log(`   Instructions: ${program.ops.length}`);
+    console.log(`   Labels: ${Object.keys(program.labels).length}`);
+}
+
+module.exports = {
+    APP_BUDGET,
+    LOGIC_SIG_BUDGET,
+    MIN_TXN_FEE,
+    OPCODE_COSTS,
+    TealError,
+    TealMachine,
+    assembleTeal,
+    createLedger,
+    applicationAddress,
+    addressBytes,
+    ledgerDelta,
+    callFee
+};
@@ -0,0 +1,146 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 ALGORAND BATCH FILL TEST
+ *
+ * Offline checks for algorandBatchFill.cjs: fill record codec, packing into
+ * app calls within the fill/group limits, resolver companions, fee pooling,
+ * secret and remaining-amount checks, and agreement with PartialFillBatch.py.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const {
+    BATCH_FILL_METHOD,
+    FILL_RECORD_LENGTH,
+    MAX_BATCH_FILLS,
+    encodeFillRecord,
+    decodeFillRecord,
+    batchFillCall,
+    planBatchFills
+} = require('./algorandBatchFill.cjs');
+
+const ALGORAND_DIR = path.join(__dirname, '../contracts/algorand');
+
+class AlgorandBatchFillTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+        this.secret = '0x' + '5e'.repeat(32);
+        this.hashlock = '0x' + crypto.createHash('sha256').update(Buffer.from(this.secret.slice(2), 'hex')).digest('hex');
+        this.resolvers = ['11', '22', '33', '44', '55'].map(byte => encodeAlgorandAddress('0x' + byte.repeat(32)));
+        this.recipient = encodeAlgorandAddress('0x' + 'b0'.repeat(32));
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    throws(fn) {
+        try {
+            fn();
+            return false;
+        } catch {
+            return true;
+        }
+    }
+
+    fills(count, resolverCount = 2, amount = 1000) {
+        return Array.from({ length: count }, (_, i) => ({ resolver: this.resolvers[i % resolverCount], amount, secret: this.secret }));
+    }
+
+    testCodec() {
+        const fill = { signer: 3, amount: 2500000n, secret: this.secret };
+        const record = encodeFillRecord(fill);
+        const decoded = decodeFillRecord(record);
+        this.check('fill records are 41 bytes and round-trip',
+            record.length === FILL_RECORD_LENGTH
+            && decoded.signer === fill.signer && decoded.amount === fill.amount && decoded.secret === fill.secret);
+
+        this.check('zero amounts, short secrets, bad signer indexes and wrong record lengths are rejected',
+            this.throws(() => encodeFillRecord({ ...fill, amount: 0 }))
+            && this.throws(() => encodeFillRecord({ ...fill, secret: '0x1234' }))
+            && this.throws(() => encodeFillRecord({ ...fill, signer: 16 }))
+            && this.throws(() => decodeFillRecord(record.subarray(1))));
+
+        const signers = new Map([[this.resolvers[1], 0], [this.resolvers[0], 1]]);
+        const call = batchFillCall(this.fills(3), { signers, recipient: this.recipient });
+        this.check('one call carries the method, one record per fill pointing at its signer, and pays only the recipient',
+            Buffer.from(call.appArgs[0]).toString() === BATCH_FILL_METHOD && call.appArgs.length === 4
+            && [1, 2, 3].map(i => decodeFillRecord(call.appArgs[i]).signer).join(',') === '1,0,1'
+            && call.accounts.length === 1 && call.accounts[0] === this.recipient);
+
+        this.check('a fill whose resolver signs nothing in the group is refused',
+            this.throws(() => batchFillCall(this.fills(3), { signers: new Map([[this.resolvers[0], 0]]), recipient: this.recipient })));
+    }
+
+    testPlanning() {
+        const submitter = this.resolvers[0];
+        const single = planBatchFills(this.fills(MAX_BATCH_FILLS), { submitter, remaining: 1000000n, hashlock: this.hashlock });
+        this.check('8 fills by 2 resolvers settle in one call behind one companion, fees pooled',
+            single.calls.length === 1 && single.total === 8000n && single.fee === 3000
+            && single.companions.join() === this.resolvers[1]
+            && single.signers.get(this.resolvers[1]) === 0 && single.signers.get(submitter) === 1
+            && single.calls[0].remainingAfter === 992000n);
+
+        const split = planBatchFills(this.fills(20), { submitter, remaining: 20000n });
+        this.check('larger batches split at the fill limit, in order',
+            split.calls.map(call => call.fills.length).join(',') === '8,8,4'
+            && split.calls[2].remainingAfter === 0n && split.fee === 7000);
+
+        const manyResolvers = planBatchFills(this.fills(6, 5), { submitter });
+        this.check('every resolver other than the submitter gets one companion ahead of the calls',
+            manyResolvers.calls.length === 1 && manyResolvers.companions.length === 4
+            && manyResolvers.signers.get(submitter) === 4 && manyResolvers.fee === 6000);
+
+        this.check('wrong secrets, overfills and oversized groups are refused before signing',
+            this.throws(() => planBatchFills([...this.fills(2), { ...this.fills(1)[0], secret: '0x' + '00'.repeat(32) }], { hashlock: this.hashlock }))
+            && this.throws(() => planBatchFills(this.fills(3), { remaining: 2999n }))
+            && this.throws(() => planBatchFills(this.fills(15 * MAX_BATCH_FILLS + 1), { submitter }))
+            && this.throws(() => planBatchFills([])));
+    }
+
+    testContractAgreement() {
+        const batch = fs.readFileSync(path.join(ALGORAND_DIR, 'PartialFillBatch.py'), 'utf8');
+        const bridges = ['AlgorandPartialFillBridge.py', 'FixedAlgorandPartialFillBridge.py']
+            .map(name => fs.readFileSync(path.join(ALGORAND_DIR, name), 'utf8'));
+        this.check('client and PyTeal agree on the method, record size and fill limit; both bridges dispatch it',
+            batch.includes(`BATCH_FILL = "${BATCH_FILL_METHOD}"`)
+            && batch.includes(`FILL_RECORD_LENGTH = ${FILL_RECORD_LENGTH}`)
+            && batch.includes(`MAX_BATCH_FILLS = ${MAX_BATCH_FILLS}`)
+            && bridges.every(source => /Bytes\(BATCH_FILL\),\s*\n\s*handle_batch_fill\(hashlock, timelock, recipient, partial_fills_enabled,/.test(source)));
+
+        this.check('PyTeal pays the stored recipient, attributes fills to group signers and checks timelock and partial fills first',
+            batch.includes('TxnField.receiver: App.globalGet(recipient)')
+            && batch.includes('Gtxn[Btoi(Extract(record.load(), Int(0), Int(1)))].sender()')
+            && batch.includes('Assert(Global.latest_timestamp() < App.globalGet(timelock))')
+            && batch.indexOf('App.globalGet(partial_fills_enabled) == Int(1)') < batch.indexOf('InnerTxnBuilder'));
+    }
+
+    async run() {
+        console.log('🧪 ALGORAND BATCH FILL TEST');
+        console.log('===========================');
+
+        this.testCodec();
+        this.testPlanning();
+        this.testContractAgreement();
+
+        console.log('===========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new AlgorandBatchFillTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { AlgorandBatchFillTester };
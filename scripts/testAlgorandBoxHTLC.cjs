@@ -0,0 +1,124 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 ALGORAND BOX HTLC TEST
+ *
+ * Offline checks for algorandBoxHTLC.cjs: the box codec, call arguments and
+ * box references, and that the client's layout and deposit constants agree with
+ * contracts/algorand/AlgorandBoxHTLCBridge.teal.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const {
+    BOX_LAYOUT,
+    BOX_SIZE,
+    BOX_MBR,
+    htlcBoxName,
+    encodeHtlcBox,
+    decodeHtlcBox,
+    createHtlcCall,
+    claimHtlcCall,
+    refundHtlcCall,
+    fundingAmount
+} = require('./algorandBoxHTLC.cjs');
+
+const TEAL_PATH = path.join(__dirname, '../contracts/algorand/AlgorandBoxHTLCBridge.teal');
+
+class AlgorandBoxHTLCTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+        this.initiator = 'BJDBVZITI7VRHJLMPY4C6BX5UVBHZVNT6PRD3ZZWO2E2HSDYGSF4KO6RR4';
+        this.recipient = encodeAlgorandAddress('0x' + '42'.repeat(32));
+        this.secret = '0x' + crypto.randomBytes(32).toString('hex');
+        this.hashlock = '0x' + crypto.createHash('sha256').update(Buffer.from(this.secret.slice(2), 'hex')).digest('hex');
+        this.htlcId = '0x' + 'ab'.repeat(32);
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testCodec() {
+        const htlc = { initiator: this.initiator, recipient: this.recipient, hashlock: this.hashlock, amount: 1500000n, timelock: 1767225600 };
+        const box = encodeHtlcBox(htlc);
+        const decoded = decodeHtlcBox(box);
+        this.check('box value round-trips', box.length === BOX_SIZE
+            && decoded.initiator === htlc.initiator && decoded.recipient === htlc.recipient
+            && decoded.hashlock === htlc.hashlock && decoded.amount === htlc.amount && decoded.timelock === htlc.timelock);
+        this.check('amount and timelock are big-endian uint64s at their offsets',
+            box.readBigUInt64BE(BOX_LAYOUT.amount.offset) === 1500000n
+            && box.readBigUInt64BE(BOX_LAYOUT.timelock.offset) === 1767225600n);
+
+        let rejected = false;
+        try {
+            decodeHtlcBox(box.subarray(1));
+        } catch {
+            rejected = true;
+        }
+        this.check('short box values are rejected', rejected);
+    }
+
+    testCalls() {
+        const create = createHtlcCall({ htlcId: this.htlcId, hashlock: this.hashlock, timelock: 1767225600, recipient: this.recipient });
+        this.check('create_htlc carries id, hashlock, timelock and recipient key',
+            create.appArgs.length === 5 && Buffer.from(create.appArgs[0]).toString() === 'create_htlc'
+            && create.appArgs.slice(1).map(arg => arg.length).join() === '32,32,8,32'
+            && Buffer.from(create.appArgs[1]).equals(Buffer.from(create.boxes[0].name)) && create.boxes[0].appIndex === 0);
+
+        const claim = claimHtlcCall(this.htlcId, this.secret);
+        const refund = refundHtlcCall(this.htlcId);
+        this.check('claim and refund reference only the HTLC box',
+            claim.appArgs.length === 3 && refund.appArgs.length === 2
+            && claim.boxes.length === 1 && refund.boxes.length === 1
+            && Buffer.from(refund.boxes[0].name).equals(Buffer.from(htlcBoxName(this.htlcId))));
+
+        let rejected = false;
+        try {
+            createHtlcCall({ htlcId: '0x1234', hashlock: this.hashlock, timelock: 1, recipient: this.recipient });
+        } catch {
+            rejected = true;
+        }
+        this.check('ids that are not 32 bytes are rejected', rejected);
+        this.check('funding payment adds the box deposit', fundingAmount(1000000) === 1000000n + BigInt(BOX_MBR) && BOX_MBR === 60100);
+    }
+
+    testTealAgreement() {
+        const teal = fs.readFileSync(TEAL_PATH, 'utf8');
+        const offsets = [...teal.matchAll(/int (\d+)\nextract_uint64/g)].map(match => Number(match[1]));
+        const extracts = [...teal.matchAll(/extract (\d+) 32/g)].map(match => Number(match[1]));
+        this.check('TEAL box size, deposit and offsets match the client layout',
+            teal.includes(`int ${BOX_SIZE}\nbox_create`) && teal.includes(`int ${BOX_MBR}\n`)
+            && offsets.every(offset => offset === BOX_LAYOUT.amount.offset || offset === BOX_LAYOUT.timelock.offset)
+            && extracts.every(offset => [BOX_LAYOUT.initiator.offset, BOX_LAYOUT.recipient.offset, BOX_LAYOUT.hashlock.offset].includes(offset))
+            && offsets.length > 0 && extracts.length > 0);
+    }
+
+    async run() {
+        console.log('🧪 ALGORAND BOX HTLC TEST');
+        console.log('=========================');
+
+        this.testCodec();
+        this.testCalls();
+        this.testTealAgreement();
+
+        console.log('=========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new AlgorandBoxHTLCTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { AlgorandBoxHTLCTester };
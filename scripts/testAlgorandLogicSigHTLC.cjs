@@ -0,0 +1,149 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 ALGORAND LOGIC-SIGNATURE HTLC TEST
+ *
+ * Offline checks for algorandLogicSigHTLC.cjs: template filling and validation,
+ * timelock → round conversion, funding notes, claim/refund recognition in algod
+ * and indexer shapes, spend windows, and agreement with the PyTeal template.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { encodeAlgorandAddress, decodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const {
+    TEMPLATE_PATH,
+    TEMPLATE_PARAMS,
+    fillHtlcTemplate,
+    timelockToRound,
+    encodeHtlcNote,
+    decodeHtlcNote,
+    classifyLogicSigSpend,
+    spendWindow
+} = require('./algorandLogicSigHTLC.cjs');
+
+class AlgorandLogicSigHTLCTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+        this.secret = '0x' + '5e'.repeat(32);
+        this.swap = {
+            htlcId: '0x' + 'ab'.repeat(32),
+            hashlock: '0x' + crypto.createHash('sha256').update(Buffer.from(this.secret.slice(2), 'hex')).digest('hex'),
+            recipient: encodeAlgorandAddress('0x' + '11'.repeat(32)),
+            refundTo: encodeAlgorandAddress('0x' + '22'.repeat(32)),
+            timeoutRound: 45000000,
+            maxFee: 1000
+        };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    throws(fn) {
+        try {
+            fn();
+            return false;
+        } catch {
+            return true;
+        }
+    }
+
+    testTemplate() {
+        const teal = fillHtlcTemplate(this.swap);
+        this.check('filled template has no placeholders and bakes every parameter in',
+            !/TMPL_/.test(teal)
+            && teal.includes(`byte ${this.swap.hashlock}`)
+            && teal.includes(`addr ${this.swap.recipient}`)
+            && teal.includes(`addr ${this.swap.refundTo}`)
+            && teal.includes(`int ${this.swap.timeoutRound}`));
+
+        const other = fillHtlcTemplate({ ...this.swap, timeoutRound: this.swap.timeoutRound + 1 });
+        this.check('different swaps give different programs', other !== teal);
+
+        const badChecksum = this.swap.recipient.slice(0, -1) + (this.swap.recipient.endsWith('A') ? 'B' : 'A');
+        this.check('bad hashlocks, addresses and equal recipient/refund are rejected',
+            this.throws(() => fillHtlcTemplate({ ...this.swap, hashlock: '0x1234' }))
+            && this.throws(() => fillHtlcTemplate({ ...this.swap, recipient: badChecksum }))
+            && this.throws(() => fillHtlcTemplate({ ...this.swap, refundTo: this.swap.recipient })));
+    }
+
+    testTimeouts() {
+        const now = { round: 1000, timestamp: 1767225600 };
+        this.check('timelock maps to a later round at the estimated round time',
+            timelockToRound(now.timestamp + 2800, now) === 2000
+            && timelockToRound(now.timestamp + 100, now, 4) === 1025
+            && this.throws(() => timelockToRound(now.timestamp, now)));
+
+        const params = { firstRound: 44999000, lastRound: 44999000 + 1000 };
+        const claim = spendWindow('claim', params, this.swap.timeoutRound);
+        this.check('claims end before the timeout round, refunds only start at it',
+            claim.lastRound === this.swap.timeoutRound - 1
+            && this.throws(() => spendWindow('claim', { firstRound: this.swap.timeoutRound, lastRound: this.swap.timeoutRound + 1000 }, this.swap.timeoutRound))
+            && this.throws(() => spendWindow('refund', params, this.swap.timeoutRound))
+            && spendWindow('refund', { firstRound: this.swap.timeoutRound, lastRound: this.swap.timeoutRound + 1000 }, this.swap.timeoutRound).firstRound === this.swap.timeoutRound);
+    }
+
+    testWatcher() {
+        const note = encodeHtlcNote(this.swap);
+        const decoded = decodeHtlcNote(Buffer.from(note).toString('base64'));
+        this.check('funding note round-trips (indexer base64) and ignores other notes',
+            JSON.stringify(decoded) === JSON.stringify(decodeHtlcNote(note))
+            && decoded.hashlock === this.swap.hashlock && decoded.htlcId === this.swap.htlcId
+            && decodeHtlcNote(Buffer.from('hello')) === null && decodeHtlcNote(Buffer.from('htlc-lsig:{bad')) === null);
+
+        const key = (address) => Buffer.from(decodeAlgorandAddress(address).publicKey.slice(2), 'hex');
+        const secret = Buffer.from(this.secret.slice(2), 'hex');
+        const blockClaim = { txn: { type: 'pay', rcv: key(this.swap.recipient), close: key(this.swap.recipient) }, lsig: { arg: [secret] } };
+        const indexerClaim = {
+            'payment-transaction': { receiver: this.swap.recipient, amount: 0, 'close-remainder-to': this.swap.recipient },
+            signature: { logicsig: { args: [secret.toString('base64')] } }
+        };
+        const indexerRefund = { 'payment-transaction': { receiver: this.swap.refundTo, amount: 0, 'close-remainder-to': this.swap.refundTo } };
+        const claimed = classifyLogicSigSpend(blockClaim, this.swap);
+        this.check('claims reveal the secret in both shapes, refunds are told apart',
+            claimed && claimed.type === 'claim' && claimed.secret === this.secret
+            && classifyLogicSigSpend(indexerClaim, this.swap).secret === this.secret
+            && classifyLogicSigSpend(indexerRefund, this.swap).type === 'refund');
+
+        const wrongSecret = { ...indexerClaim, signature: { logicsig: { args: [Buffer.alloc(32).toString('base64')] } } };
+        this.check('a spend with the wrong preimage is not taken as a claim', classifyLogicSigSpend(wrongSecret, this.swap) === null);
+    }
+
+    testContractAgreement() {
+        const python = fs.readFileSync(path.join(path.dirname(TEMPLATE_PATH), 'AlgorandHTLCLogicSig.py'), 'utf8');
+        const template = fs.readFileSync(TEMPLATE_PATH, 'utf8');
+        const inTeal = new Set(template.match(/\bTMPL_[A-Z]+\b/g));
+        this.check('TEAL template, PyTeal source and client agree on the parameters',
+            TEMPLATE_PARAMS.every(name => inTeal.has(name) && python.includes(`"${name}"`)) && inTeal.size === TEMPLATE_PARAMS.length
+            && /^#pragma version 8$/m.test(template) && !/\b(app_global|app_local|box_|itxn)/.test(template));
+    }
+
+    async run() {
+        console.log('🧪 ALGORAND LOGIC-SIGNATURE HTLC TEST');
+        console.log('=====================================');
+
+        this.testTemplate();
+        this.testTimeouts();
+        this.testWatcher();
+        this.testContractAgreement();
+
+        console.log('=====================================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new AlgorandLogicSigHTLCTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { AlgorandLogicSigHTLCTester };
@@ -0,0 +1,202 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 AUCTION CURVE TEST
+ *
+ * Offline checks for auctionCurve.cjs: packing round trips, validation rules,
+ * and evaluation against a literal port of 1inch AuctionCalculator reading
+ * auctionDetails bytes, for every second of randomized curves.
+ */
+
+const crypto = require('crypto');
+const curves = require('./auctionCurve.cjs');
+
+// AuctionCalculator._getAuctionBump over raw auctionDetails (unchecked uint256 math)
+function referenceRateBump(details, timestamp, blockBaseFee) {
+    const bytes = Buffer.from(details.replace(/^0x/, ''), 'hex');
+    const u = (offset, length) => BigInt('0x' + bytes.subarray(offset, offset + length).toString('hex'));
+    const gasBumpEstimate = u(0, 3);
+    const gasPriceEstimate = u(3, 4);
+    const gasBump = gasBumpEstimate === 0n || gasPriceEstimate === 0n ? 0n : gasBumpEstimate * blockBaseFee / gasPriceEstimate / 1_000_000n;
+    const auctionStartTime = u(7, 4);
+    const auctionFinishTime = auctionStartTime + u(11, 3);
+    const initialRateBump = u(14, 3);
+
+    let auctionBump;
+    if (timestamp <= auctionStartTime) {
+        auctionBump = initialRateBump;
+    } else if (timestamp >= auctionFinishTime) {
+        auctionBump = 0n;
+    } else {
+        let currentPointTime = auctionStartTime;
+        let currentRateBump = initialRateBump;
+        let offset = 17;
+        auctionBump = null;
+        while (offset < bytes.length) {
+            const nextRateBump = u(offset, 3);
+            const nextPointTime = currentPointTime + u(offset + 3, 2);
+            if (timestamp <= nextPointTime) {
+                auctionBump = ((timestamp - currentPointTime) * nextRateBump + (nextPointTime - timestamp) * currentRateBump) / (nextPointTime - currentPointTime);
+                break;
+            }
+            currentRateBump = nextRateBump;
+            currentPointTime = nextPointTime;
+            offset += 5;
+        }
+        if (auctionBump === null) {
+            auctionBump = (auctionFinishTime - timestamp) * currentRateBump / (auctionFinishTime - currentPointTime);
+        }
+    }
+    return auctionBump > gasBump ? auctionBump - gasBump : 0n;
+}
+
+const hexN = (value, bytes) => BigInt(value).toString(16).padStart(bytes * 2, '0');
+
+function buildAuctionDetails({ gasBumpEstimate, gasPriceEstimate, startTime, duration, initialRateBump, points }) {
+    return '0x' + hexN(gasBumpEstimate, 3) + hexN(gasPriceEstimate, 4) + hexN(startTime, 4) + hexN(duration, 3)
+        + hexN(initialRateBump, 3) + points.map(p => hexN(p.rateBump, 3) + hexN(p.timeDelta, 2)).join('');
+}
+
+const randomInt = (max) => crypto.randomInt(max);
+
+// Random non-increasing curve that fits `duration`
+function randomSpec(duration) {
+    const count = randomInt(curves.MAX_POINTS + 1);
+    let bump = randomInt(1 << 24);
+    const initialRateBump = bump;
+    let budget = duration - 1;
+    const points = [];
+    for (let i = 0; i < count; i++) {
+        bump = randomInt(bump + 1);
+        const timeDelta = randomInt(Math.min(budget, 0xffff) + 1);
+        budget -= timeDelta;
+        points.push({ rateBump: bump, timeDelta });
+    }
+    const gasBumpEstimate = randomInt(2) ? randomInt(1 << 24) : 0;
+    return { gasBumpEstimate, gasPriceEstimate: 1 + randomInt(100_000), initialRateBump, points };
+}
+
+class AuctionCurveTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testRoundTrip() {
+        const spec = { gasBumpEstimate: 0xabcdef, gasPriceEstimate: 0x12345678, initialRateBump: 0xfedcba,
+            points: [{ rateBump: 0x111111, timeDelta: 0x2222 }, { rateBump: 0x33, timeDelta: 0xffff }] };
+        const decoded = curves.decodeCurve(curves.encodeCurve(spec));
+        const same = decoded.gasBumpEstimate === 0xabcdefn && decoded.gasPriceEstimate === 0x12345678n
+            && decoded.initialRateBump === 0xfedcban && decoded.pointsCount === 2
+            && decoded.points[1].rateBump === 0x33n && decoded.points[1].timeDelta === 0xffffn;
+        this.check('encode/decode round trip', same);
+
+        let threw = false;
+        try {
+            curves.encodeCurve({ initialRateBump: 1 << 24 });
+        } catch (error) {
+            threw = true;
+        }
+        this.check('out-of-range field rejected when encoding', threw);
+    }
+
+    testValidation() {
+        const ok = curves.encodeCurve({ initialRateBump: 1000, points: [{ rateBump: 500, timeDelta: 60 }] });
+        const rising = curves.encodeCurve({ initialRateBump: 500, points: [{ rateBump: 1000, timeDelta: 60 }] });
+        const long = curves.encodeCurve({ initialRateBump: 1000, points: [{ rateBump: 500, timeDelta: 180 }] });
+        const noGasPrice = curves.encodeCurve({ gasBumpEstimate: 10, initialRateBump: 1000 });
+        const stray = ok | 1n;
+        const tooMany = ok | (5n << 168n);
+        this.check('valid curve accepted', curves.validationError(ok, 180) === '');
+        this.check('rising, overlong, gas-estimate and stray-bit curves rejected',
+            curves.validationError(rising, 180) === 'Curve must not increase'
+            && curves.validationError(long, 180) === 'Curve points exceed duration'
+            && curves.validationError(noGasPrice, 180) === 'Missing gas price estimate'
+            && curves.validationError(stray, 180) === 'Unused curve bits set'
+            && curves.validationError(tooMany, 180) === 'Too many curve points');
+    }
+
+    testMatchesAuctionCalculator() {
+        let mismatches = 0;
+        let samples = 0;
+        for (let round = 0; round < 40; round++) {
+            const duration = 30 + randomInt(600);
+            const startTime = 1_700_000_000 + randomInt(1000);
+            const spec = randomSpec(duration);
+            const details = buildAuctionDetails({ ...spec, startTime, duration });
+            const { curve } = curves.fromAuctionDetails(details);
+            if (curves.validationError(curve, duration) !== '') mismatches++;
+
+            for (const baseFee of [0n, 7n * 1_000_000_000n, 123_456_789_012n]) {
+                for (let t = startTime - 2; t <= startTime + duration + 2; t++) {
+                    samples++;
+                    const expected = referenceRateBump(details, BigInt(t), baseFee);
+                    const got = curves.rateBump(curve, startTime, startTime + duration, t, baseFee);
+                    if (expected !== got) mismatches++;
+                }
+            }
+        }
+        this.check(`rate bump identical to AuctionCalculator (${samples} samples)`, mismatches === 0, `(${mismatches} mismatches)`);
+    }
+
+    testFromAuctionDetails() {
+        const details = buildAuctionDetails({ gasBumpEstimate: 0, gasPriceEstimate: 0, startTime: 1234, duration: 180,
+            initialRateBump: 50_000, points: [{ rateBump: 20_000, timeDelta: 12 }] });
+        const parsed = curves.fromAuctionDetails(details);
+        this.check('auctionDetails start/duration extracted', parsed.startTime === 1234n && parsed.duration === 180n
+            && curves.decodeCurve(parsed.curve).points[0].timeDelta === 12n);
+    }
+
+    testFirstTimeAtOrBelow() {
+        let mismatches = 0;
+        for (let round = 0; round < 30; round++) {
+            const duration = 60 + randomInt(300);
+            const curve = curves.encodeCurve(randomSpec(duration));
+            const base = 1_000_000n + BigInt(randomInt(1_000_000));
+            const start = 5000n;
+            const finish = start + BigInt(duration);
+            const reservation = curves.priceAt(curve, base, start, finish, start + BigInt(randomInt(duration + 1)));
+
+            let expected = null;
+            for (let t = start; t <= finish; t++) {
+                if (curves.priceAt(curve, base, start, finish, t) <= reservation) {
+                    expected = t;
+                    break;
+                }
+            }
+            if (curves.firstTimeAtOrBelow(curve, base, start, finish, reservation) !== expected) mismatches++;
+        }
+        this.check('bisection matches linear scan', mismatches === 0, `(${mismatches} mismatches)`);
+    }
+
+    run() {
+        console.log('🧪 AUCTION CURVE TEST');
+        console.log('=====================');
+
+        this.testRoundTrip();
+        this.testValidation();
+        this.testMatchesAuctionCalculator();
+        this.testFromAuctionDetails();
+        this.testFirstTimeAtOrBelow();
+
+        console.log('=====================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    process.exit(new AuctionCurveTester().run() ? 0 : 1);
+}
+
+module.exports = { AuctionCurveTester };
@@ -0,0 +1,113 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 BRIDGE ORDER LENS TEST
+ *
+ * Offline checks for bridgeOrderLens.cjs: status word layout (as packed by
+ * BridgeOrderLens._pack), saturation, and chunked batch calls against a fake lens.
+ */
+
+const { decodeStatusWord, encodeStatusWord, BridgeOrderLensClient, NO_BID } = require('./bridgeOrderLens.cjs');
+
+// BridgeOrderLens._pack, literally
+function referencePack(status, flags, fillCount, expiry, remaining, total, bidCount) {
+    const min = (a, b) => a < b ? a : b;
+    return BigInt(status) | BigInt(flags) << 8n | min(BigInt(fillCount), 255n) << 16n
+        | min(BigInt(expiry), 2n ** 32n - 1n) << 24n | min(remaining, 2n ** 96n - 1n) << 56n
+        | min(total, 2n ** 96n - 1n) << 152n | min(BigInt(bidCount), 255n) << 248n;
+}
+
+class FakeLens {
+    constructor(words) {
+        this.words = words;
+        this.calls = [];
+    }
+
+    async getOrders(bridge, kind, ids) {
+        this.calls.push({ method: 'getOrders', kind, size: ids.length });
+        return ids.map(id => this.words.get(id) || 0n);
+    }
+
+    async getBestBids(bridge, ids) {
+        this.calls.push({ method: 'getBestBids', size: ids.length });
+        return [ids.map(id => ({ resolver: id })), ids.map((id, i) => i % 2 ? NO_BID : BigInt(i))];
+    }
+
+    async getRevealedSecrets(bridge, ids) {
+        this.calls.push({ method: 'getRevealedSecrets', size: ids.length });
+        return ids.map(id => id === '0x02' ? '0x' + 'ab'.repeat(32) : '0x' + '00'.repeat(32));
+    }
+}
+
+class BridgeOrderLensTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testLayout() {
+        const word = referencePack(2, 2, 3, 1_700_086_400, 4n * 10n ** 17n, 10n ** 18n, 5);
+        const decoded = decodeStatusWord(word);
+        this.check('decode matches the contract layout', decoded.status === 'partiallyFilled' && decoded.multiSecret
+            && !decoded.secretRevealed && decoded.fillCount === 3 && decoded.expiry === 1_700_086_400
+            && decoded.remaining === 4n * 10n ** 17n && decoded.total === 10n ** 18n && decoded.bidCount === 5);
+        this.check('encode is the inverse of decode', encodeStatusWord(decoded) === word);
+        this.check('zero word is an unknown order', decodeStatusWord(0n).status === 'unknown');
+    }
+
+    testSaturation() {
+        const huge = 2n ** 100n;
+        const word = referencePack(1, 1, 300, 2n ** 40n, huge, huge, 1000);
+        const decoded = decodeStatusWord(word);
+        this.check('oversized fields saturate instead of spilling into neighbours',
+            decoded.status === 'open' && decoded.secretRevealed && decoded.fillCount === 255 && decoded.expiry === 2 ** 32 - 1
+            && decoded.remaining === 2n ** 96n - 1n && decoded.total === 2n ** 96n - 1n && decoded.bidCount === 255
+            && encodeStatusWord({ status: 'open', secretRevealed: true, fillCount: 300, expiry: 2n ** 40n, remaining: huge, total: huge, bidCount: 1000 }) === word);
+    }
+
+    async testChunkedCalls() {
+        const ids = [...Array(450).keys()].map(i => '0x' + i.toString(16).padStart(2, '0'));
+        const lens = new FakeLens(new Map([['0x05', encodeStatusWord({ status: 'filled', fillCount: 1 })]]));
+        const client = new BridgeOrderLensClient(lens, { chunkSize: 200 });
+
+        const orders = await client.getOrders('0xbridge', 'crossChainHTLC', ids);
+        this.check('ids are split into chunkSize calls and reassembled in order',
+            lens.calls.map(call => call.size).join(',') === '200,200,50' && lens.calls[0].kind === 3
+            && orders.size === 450 && orders.get('0x05').status === 'filled' && orders.get('0x06').status === 'unknown');
+
+        const best = await client.getBestBids('0xbridge', ['0x01', '0x02', '0x03']);
+        const secrets = await client.getRevealedSecrets('0xbridge', ['0x01', '0x02']);
+        this.check('NO_BID maps to null and only revealed secrets are returned',
+            best.get('0x01').index === 0 && best.get('0x02') === null && best.get('0x03').bid.resolver === '0x03'
+            && secrets.size === 1 && secrets.has('0x02'));
+    }
+
+    async run() {
+        console.log('🧪 BRIDGE ORDER LENS TEST');
+        console.log('=========================');
+
+        this.testLayout();
+        this.testSaturation();
+        await this.testChunkedCalls();
+
+        console.log('=========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new BridgeOrderLensTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { BridgeOrderLensTester };
@@ -0,0 +1,119 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 COMPACT LIMIT ORDER TEST
+ *
+ * Offline checks for compactLimitOrder.cjs: Algorand address round trips
+ * (as rebuilt by AlgorandAddressLib), CompactIntent packing and the EIP-2098
+ * signature form.
+ */
+
+const crypto = require('crypto');
+const {
+    decodeAlgorandAddress,
+    encodeAlgorandAddress,
+    toCompactIntent,
+    fromCompactIntent,
+    unpackTerms,
+    toCompactSignature
+} = require('./compactLimitOrder.cjs');
+
+const RELAYER_ADDRESS = 'BJDBVZITI7VRHJLMPY4C6BX5UVBHZVNT6PRD3ZZWO2E2HSDYGSF4KO6RR4';
+
+class CompactLimitOrderTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    throws(fn) {
+        try {
+            fn();
+            return false;
+        } catch (error) {
+            return true;
+        }
+    }
+
+    testAlgorandAddress() {
+        const { publicKey, checksum } = decodeAlgorandAddress(RELAYER_ADDRESS);
+        this.check('address round-trips through public key and checksum',
+            encodeAlgorandAddress(publicKey, checksum) === RELAYER_ADDRESS && encodeAlgorandAddress(publicKey) === RELAYER_ADDRESS);
+
+        let allRoundTrip = true;
+        for (let i = 0; i < 50; i++) {
+            const key = '0x' + crypto.randomBytes(32).toString('hex');
+            const address = encodeAlgorandAddress(key);
+            allRoundTrip = allRoundTrip && address.length === 58 && decodeAlgorandAddress(address).publicKey === key;
+        }
+        this.check('random public keys round-trip', allRoundTrip);
+
+        const tampered = RELAYER_ADDRESS.slice(0, 10) + (RELAYER_ADDRESS[10] === 'A' ? 'B' : 'A') + RELAYER_ADDRESS.slice(11);
+        this.check('bad checksum and bad length are rejected',
+            this.throws(() => decodeAlgorandAddress(tampered)) && this.throws(() => decodeAlgorandAddress(RELAYER_ADDRESS.slice(1))));
+    }
+
+    testPacking() {
+        const intent = {
+            maker: '0x1111111111111111111111111111111111111111',
+            makerToken: '0x0000000000000000000000000000000000000000',
+            takerToken: '0x2222222222222222222222222222222222222222',
+            makerAmount: 10n ** 16n,
+            takerAmount: 15n * 10n ** 15n,
+            deadline: 1_760_000_000,
+            algorandChainId: 416001,
+            algorandAddress: RELAYER_ADDRESS,
+            salt: '0x' + 'ab'.repeat(32),
+            allowPartialFills: true,
+            minPartialFill: 5n * 10n ** 15n
+        };
+        const compact = toCompactIntent(intent);
+        const expanded = fromCompactIntent(compact, intent.maker);
+        this.check('CompactIntent expands back to the signed intent',
+            Object.keys(intent).every(key => expanded[key] === intent[key]), JSON.stringify(expanded, (k, v) => typeof v === 'bigint' ? v.toString() : v));
+        this.check('terms keep the checksum in bits 176..207',
+            unpackTerms(compact.terms).checksum === decodeAlgorandAddress(RELAYER_ADDRESS).checksum && BigInt(compact.terms) >> 208n === 0n);
+        this.check('oversized fields are rejected instead of truncated',
+            this.throws(() => toCompactIntent({ ...intent, deadline: 2 ** 40 }))
+            && this.throws(() => toCompactIntent({ ...intent, minPartialFill: 1n << 96n }))
+            && this.throws(() => toCompactIntent({ ...intent, makerAmount: 1n << 128n })));
+    }
+
+    testCompactSignature() {
+        const r = 'aa'.repeat(32);
+        const s = '7f' + 'bb'.repeat(31);
+        const low = toCompactSignature('0x' + r + s + '1b');
+        const high = toCompactSignature('0x' + r + s + '1c');
+        this.check('yParity goes into the top bit of vs',
+            low.r === '0x' + r && low.vs === '0x' + s && high.vs === '0xff' + 'bb'.repeat(31));
+    }
+
+    async run() {
+        console.log('🧪 COMPACT LIMIT ORDER TEST');
+        console.log('===========================');
+
+        this.testAlgorandAddress();
+        this.testPacking();
+        this.testCompactSignature();
+
+        console.log('===========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new CompactLimitOrderTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { CompactLimitOrderTester };
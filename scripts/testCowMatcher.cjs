@@ -0,0 +1,140 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 COINCIDENCE-OF-WANTS MATCHER TEST
+ *
+ * Offline checks for cowMatcher.cjs: crossing and non-crossing pairs, the
+ * clearing price, all-or-nothing intents, expiry / residual release, and a
+ * randomised sweep asserting nobody is filled beyond their amount or below
+ * their signed rate.
+ */
+
+const { CowMatcher, planSettlement } = require('./cowMatcher.cjs');
+
+const eth = (n) => BigInt(Math.round(n * 1e6)) * 10n ** 12n;
+const algo = (n) => BigInt(Math.round(n * 1e6));
+const THOUSAND_ALGO_PER_ETH = { num: 1n, den: 10n ** 9n };
+
+class CowMatcherTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testCrossing() {
+        const clock = { now: 1000 };
+        const matcher = new CowMatcher({ now: () => clock.now, referencePrice: () => THOUSAND_ALGO_PER_ETH });
+        matcher.add({ id: 'e1', direction: 'ETH_TO_ALGO', sell: eth(1), minBuy: algo(990), deadline: 5000, allowPartialFills: true, hashlock: '0xh1', algorandAddress: 'ALGOADDR' });
+        matcher.add({ id: 'a1', direction: 'ALGO_TO_ETH', sell: algo(1500), minBuy: eth(1.45), deadline: 5000, allowPartialFills: true, maker: '0xa1' });
+        matcher.add({ id: 'a2', direction: 'ALGO_TO_ETH', sell: algo(600), minBuy: eth(0.62), deadline: 5000 });
+        const { matches } = matcher.match();
+        this.check('crossing intents clear at the reference price',
+            matches.length === 1 && matches[0].ethAmount === eth(1) && matches[0].algoAmount === algo(1000)
+            && matcher.book.get('a1').remaining === algo(500) && !matcher.book.has('e1'));
+        this.check('a bid below the ask does not match', matcher.book.get('a2').remaining === algo(600));
+
+        const plan = planSettlement(matches, [matcher.book.get('a2')]);
+        this.check('matched legs share the ETH seller hashlock and save HTLCs',
+            plan.legs[0].hashlock === '0xh1' && plan.legs[1].recipient === 'ALGOADDR' && plan.legs[0].recipient === '0xa1'
+            && plan.htlcs === 4 && plan.htlcsWithoutMatching === 6);
+    }
+
+    testMidpointAndAllOrNothing() {
+        const matcher = new CowMatcher({ now: () => 0 });
+        matcher.add({ id: 'e', direction: 'ETH_TO_ALGO', sell: eth(1), minBuy: algo(900), deadline: 10 });
+        matcher.add({ id: 'a-small', direction: 'ALGO_TO_ETH', sell: algo(500), minBuy: eth(0.4), deadline: 10, allowPartialFills: true });
+        let round = matcher.match();
+        this.check('an all-or-nothing intent is not partially filled', round.matches.length === 0);
+
+        matcher.add({ id: 'a-big', direction: 'ALGO_TO_ETH', sell: algo(1100), minBuy: eth(1), deadline: 10 });
+        round = matcher.match();
+        // midpoint of 900 and 1100 ALGO/ETH; a-big is all-or-nothing, so it sells all 1100 for the 1 ETH
+        this.check('without a reference both all-or-nothing sides fill completely',
+            round.matches.length === 1 && round.matches[0].ethAmount === eth(1) && round.matches[0].algoAmount === algo(1100)
+            && round.matches[0].price.num * 10n ** 18n / round.matches[0].price.den === algo(1000));
+    }
+
+    testExpiryAndResidual() {
+        const clock = { now: 0 };
+        const matcher = new CowMatcher({ now: () => clock.now, maxWaitSeconds: 30 });
+        matcher.add({ id: 'old', direction: 'ETH_TO_ALGO', sell: eth(1), minBuy: algo(1000), deadline: 100 });
+        matcher.add({ id: 'short', direction: 'ALGO_TO_ETH', sell: algo(1), minBuy: eth(1), deadline: 20 });
+        clock.now = 25;
+        const { expired } = matcher.match();
+        matcher.add({ id: 'fresh', direction: 'ETH_TO_ALGO', sell: eth(1), minBuy: algo(1000), deadline: 100 });
+        clock.now = 40;
+        const residual = matcher.takeResidual();
+        this.check('expired intents drop out and only stale ones are released as residual',
+            expired.join() === 'short' && residual.length === 1 && residual[0].id === 'old' && residual[0].untouched
+            && matcher.book.has('fresh'));
+    }
+
+    testRandomised() {
+        let seed = 42;
+        const rand = (n) => {
+            seed = seed * 48271 % 2147483647;
+            return seed % n;
+        };
+        let ok = true;
+        let matchedCount = 0;
+        for (let round = 0; round < 20; round++) {
+            const matcher = new CowMatcher({ now: () => 0, referencePrice: round % 2 ? () => THOUSAND_ALGO_PER_ETH : undefined });
+            const intents = new Map();
+            for (let i = 0; i < 40; i++) {
+                const ethSide = rand(2) === 0;
+                const ethAmount = eth(0.01 + rand(300) / 100);
+                const rate = BigInt(950 + rand(100)); // ALGO per ETH
+                const algoAmount = ethAmount * rate / 10n ** 12n;
+                const intent = ethSide
+                    ? { id: `e${i}`, direction: 'ETH_TO_ALGO', sell: ethAmount, minBuy: algoAmount, deadline: 10, allowPartialFills: rand(2) === 0, minPartialFill: ethAmount / 10n }
+                    : { id: `a${i}`, direction: 'ALGO_TO_ETH', sell: algoAmount, minBuy: ethAmount, deadline: 10, allowPartialFills: rand(2) === 0, minPartialFill: algoAmount / 10n };
+                intents.set(intent.id, { ...intent, sold: 0n, bought: 0n, fills: 0 });
+                matcher.add(intent);
+            }
+            const { matches } = matcher.match();
+            matchedCount += matches.length;
+            for (const m of matches) {
+                const e = intents.get(m.ethIntent);
+                const a = intents.get(m.algoIntent);
+                e.sold += m.ethAmount; e.bought += m.algoAmount; e.fills++;
+                a.sold += m.algoAmount; a.bought += m.ethAmount; a.fills++;
+            }
+            for (const intent of intents.values()) {
+                if (intent.sold > intent.sell) ok = false;
+                if (intent.sold > 0n && intent.bought * intent.sell < intent.sold * intent.minBuy) ok = false;
+                if (!intent.allowPartialFills && intent.fills > 0 && (intent.fills !== 1 || intent.sold !== intent.sell)) ok = false;
+            }
+        }
+        this.check('randomised rounds never overfill or undercut a signed rate', ok && matchedCount > 50, `ok=${ok} matches=${matchedCount}`);
+    }
+
+    async run() {
+        console.log('🧪 COINCIDENCE-OF-WANTS MATCHER TEST');
+        console.log('====================================');
+
+        this.testCrossing();
+        this.testMidpointAndAllOrNothing();
+        this.testExpiryAndResidual();
+        this.testRandomised();
+
+        console.log('====================================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new CowMatcherTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { CowMatcherTester };
@@ -0,0 +1,178 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 DUTCH AUCTION SCHEDULER TEST
+ *
+ * Offline checks for dutchAuctionScheduler.cjs:
+ * closed-form bid windows against a brute-force scan of each curve,
+ * block targeting, and timer firing against a mock provider.
+ */
+
+const { DutchAuctionScheduler, CURVES } = require('./dutchAuctionScheduler.cjs');
+const { encodeCurve } = require('./auctionCurve.cjs');
+
+const GWEI = 1000000000n;
+
+class MockProvider {
+    constructor(number, timestamp) {
+        this.block = { number, timestamp };
+    }
+
+    async getBlock() {
+        return this.block;
+    }
+}
+
+class DutchAuctionSchedulerTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    // First t in [from, to] where accept(t) holds, by linear scan
+    bruteForceOpen(from, to, accept) {
+        for (let t = from; t <= to; t++) {
+            if (accept(BigInt(t))) return BigInt(t);
+        }
+        return null;
+    }
+
+    testLinearCurve() {
+        const curve = CURVES.enhancedCrossChainResolver;
+        const params = { startTime: 1000, endTime: 1180, startPrice: 1_000_003n, endPrice: 900_001n };
+        let mismatches = 0;
+
+        for (const reservation of [1_000_003n, 999_999n, 955_555n, 900_002n, 900_001n, 900_000n]) {
+            const window = curve.bidWindow(params, reservation);
+            const expected = this.bruteForceOpen(1000, 1179, t => curve.priceAt(params, t) <= reservation);
+            const got = window ? window.openAt : null;
+            if (got !== expected) {
+                mismatches++;
+                console.log(`   reservation ${reservation}: expected ${expected}, got ${got}`);
+            }
+        }
+        this.check('linear curve: closed form matches scan', mismatches === 0);
+        this.check('linear curve: below endPrice unreachable', curve.bidWindow(params, 1n) === null);
+    }
+
+    testEnhanced1inchStyleCurve() {
+        const curve = CURVES.enhanced1inchStyleBridge;
+        const params = { startTime: 5000, duration: 180 };
+        let mismatches = 0;
+
+        for (const reservation of [50n * GWEI, 30n * GWEI + 7n, 6n * GWEI, 5n * GWEI]) {
+            const window = curve.bidWindow(params, reservation);
+            const expected = this.bruteForceOpen(5000, 5200, t => curve.priceAt(params, t) <= reservation);
+            if (!window || window.openAt !== expected) mismatches++;
+        }
+        this.check('1inch-style curve: closed form matches scan', mismatches === 0);
+        this.check('1inch-style curve: MIN after duration', curve.priceAt(params, 5180) === 5n * GWEI);
+    }
+
+    testAlgorandBridgeCurve() {
+        const curve = CURVES.algorandHTLCBridge;
+        // Large synthetic range so the 45 wei/hour decay actually crosses within the test
+        const params = { startTime: 0, endTime: 3600, startPrice: 5n * GWEI + 40n };
+        const gasPrice = 5n * GWEI + 3n;
+        const window = curve.bidWindow(params, gasPrice);
+
+        let lastValid = null;
+        for (let t = 0; t < 3600; t++) {
+            if (curve.priceAt(params, t) >= gasPrice) lastValid = BigInt(t);
+        }
+        this.check('algorand curve: window opens at start', window.openAt === 0n);
+        this.check('algorand curve: close matches last accepted second', window.closeAt === lastValid, `(expected ${lastValid}, got ${window.closeAt})`);
+        this.check('algorand curve: bid above start price rejected', curve.bidWindow(params, 6n * GWEI) === null);
+    }
+
+    testPiecewiseCurves() {
+        const curve = encodeCurve({
+            initialRateBump: 500_000,
+            points: [{ rateBump: 200_000, timeDelta: 40 }, { rateBump: 200_000, timeDelta: 30 }, { rateBump: 10_000, timeDelta: 50 }]
+        });
+        const piecewise = CURVES.piecewise;
+        const params = { startTime: 2000, endTime: 2180, basePrice: 900_000n, curve };
+        let mismatches = 0;
+        for (const reservation of [945_000n, 930_000n, 918_000n, 905_000n, 900_001n, 900_000n, 899_999n]) {
+            const window = piecewise.bidWindow(params, reservation);
+            const expected = this.bruteForceOpen(2000, 2179, t => piecewise.priceAt(params, t) <= reservation);
+            if ((window ? window.openAt : null) !== expected) mismatches++;
+        }
+        this.check('piecewise curve: bisection matches scan', mismatches === 0);
+
+        const algorand = CURVES.algorandHTLCBridgeCurve;
+        const aParams = { startTime: 0, endTime: 3600, curve: encodeCurve({ initialRateBump: 9_000_000, points: [{ rateBump: 1_000_000, timeDelta: 600 }] }) };
+        const gasPrice = 6n * GWEI;
+        let lastValid = null;
+        for (let t = 0; t < 3600; t++) {
+            if (algorand.priceAt(aParams, t) >= gasPrice) lastValid = BigInt(t);
+        }
+        const window = algorand.bidWindow(aParams, gasPrice);
+        this.check('algorand curve auction: close matches last accepted second', window && window.closeAt === lastValid, `(expected ${lastValid}, got ${window && window.closeAt})`);
+    }
+
+    testBlockTargeting() {
+        const scheduler = new DutchAuctionScheduler(new MockProvider(100, 10_000));
+        scheduler.clock.anchor = { number: 100, timestamp: 10_000 };
+        scheduler.clock.offsetMs = 10_000_000 - Date.now();
+
+        const params = { startTime: 10_000, endTime: 10_180, startPrice: 1000n, endPrice: 900n };
+        const plan = scheduler.plan('linear', params, 950n); // opens at +90s
+        this.check('block targeting: first block at/after open', plan.targetBlock === 108 && plan.targetTimestamp === 10_096, `(got ${plan.targetBlock}@${plan.targetTimestamp})`);
+        this.check('block targeting: expected price within reservation', plan.expectedPrice <= 950n);
+
+        const late = scheduler.plan('linear', params, 900n); // opens at +180s == endTime
+        this.check('block targeting: window past end is unreachable', late === null);
+    }
+
+    async testTimerFires() {
+        const nowSec = Math.floor(Date.now() / 1000);
+        const provider = new MockProvider(500, nowSec);
+        const scheduler = new DutchAuctionScheduler(provider, { slotSeconds: 1, propagationMs: 0 });
+
+        const params = { startTime: nowSec, endTime: nowSec + 60, startPrice: 1000n, endPrice: 0n };
+        const fired = await new Promise(resolve => {
+            scheduler.schedule('order-1', 'linear', params, 1000n, async plan => {
+                resolve(plan);
+                return 'ok';
+            });
+            setTimeout(() => resolve(null), 3000);
+        });
+        this.check('timer fires for immediately-open window', fired !== null && fired.targetBlock >= 500);
+
+        await scheduler.schedule('order-2', 'linear', { ...params, startTime: nowSec + 600, endTime: nowSec + 660 }, 500n, async () => {});
+        this.check('cancel clears pending timer', scheduler.pending().length === 1 && scheduler.cancel('order-2') && scheduler.pending().length === 0);
+    }
+
+    async run() {
+        console.log('🧪 DUTCH AUCTION SCHEDULER TEST');
+        console.log('===============================');
+
+        this.testLinearCurve();
+        this.testEnhanced1inchStyleCurve();
+        this.testAlgorandBridgeCurve();
+        this.testPiecewiseCurves();
+        this.testBlockTargeting();
+        await this.testTimerFires();
+
+        console.log('===============================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new DutchAuctionSchedulerTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { DutchAuctionSchedulerTester };
@@ -0,0 +1,123 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 ALGORAND HTLC EVENT TEST
+ *
+ * Offline checks for htlcEvents.cjs: round trips of every event, rejection of
+ * foreign or malformed logs, algod/indexer transaction shapes, and agreement of
+ * the selectors with HTLCEvents.py and the TEAL apps.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const {
+    EVENT_DEFINITIONS,
+    eventSignature,
+    eventSelector,
+    decodeHtlcEvent,
+    decodeTransactionEvents,
+    encodeHtlcEvent,
+    legacyHtlcKey
+} = require('./htlcEvents.cjs');
+
+const ALGORAND_DIR = path.join(__dirname, '../contracts/algorand');
+// Application programs only: logic-signature templates (TMPL_ placeholders) cannot log
+const TEAL_FILES = [
+    path.join(__dirname, '../AlgorandHTLCBridge.teal'),
+    ...fs.readdirSync(ALGORAND_DIR).filter(file => file.endsWith('.teal')).map(file => path.join(ALGORAND_DIR, file))
+].filter(file => !fs.readFileSync(file, 'utf8').includes('TMPL_'));
+
+class HtlcEventsTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+        this.alice = encodeAlgorandAddress('0x' + '11'.repeat(32));
+        this.bob = encodeAlgorandAddress('0x' + '22'.repeat(32));
+        this.key = '0x' + 'ab'.repeat(32);
+        this.secret = '0x' + 'cd'.repeat(32);
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testRoundTrips() {
+        const samples = {
+            HTLCCreated: { htlcKey: this.key, initiator: this.alice, recipient: this.bob, hashlock: '0x' + 'ef'.repeat(32), amount: 2500000n, timelock: 1767225600n },
+            HTLCClaimed: { htlcKey: this.key, recipient: this.bob, secret: this.secret, amount: 2500000n },
+            HTLCRefunded: { htlcKey: this.key, initiator: this.alice, amount: 2500000n },
+            HTLCPartiallyFilled: { htlcKey: this.key, resolver: this.bob, secret: this.secret, fillAmount: 1000000n, remaining: 1500000n }
+        };
+        const ok = Object.entries(samples).every(([name, values]) => {
+            const decoded = decodeHtlcEvent(encodeHtlcEvent(name, values));
+            return decoded && decoded.name === name && Object.entries(values).every(([field, value]) => decoded[field] === value);
+        });
+        this.check('every event round-trips through its fixed layout', ok);
+
+        const created = encodeHtlcEvent('HTLCCreated', samples.HTLCCreated);
+        this.check('HTLCCreated is 148 bytes, amount at offset 132', created.length === 148 && created.readBigUInt64BE(132) === 2500000n);
+        this.check('base64 logs (indexer) decode too', decodeHtlcEvent(created.toString('base64')).amount === 2500000n);
+    }
+
+    testRejection() {
+        const refunded = encodeHtlcEvent('HTLCRefunded', { htlcKey: this.key, initiator: this.alice, amount: 1n });
+        this.check('foreign or truncated logs are ignored',
+            decodeHtlcEvent(Buffer.from('hello world')) === null
+            && decodeHtlcEvent(refunded.subarray(0, refunded.length - 1)) === null
+            && decodeHtlcEvent(Buffer.concat([refunded, Buffer.alloc(1)])) === null);
+    }
+
+    testTransactions() {
+        const claimed = encodeHtlcEvent('HTLCClaimed', { htlcKey: this.key, recipient: this.bob, secret: this.secret, amount: 5n });
+        const refunded = encodeHtlcEvent('HTLCRefunded', { htlcKey: this.key, initiator: this.alice, amount: 7n });
+        const blockTxn = { dt: { lg: [Buffer.from('noise'), claimed], itx: [{ dt: { lg: [refunded] } }] } };
+        const indexerTxn = { logs: [claimed.toString('base64')], 'inner-txns': [{ logs: [refunded.toString('base64')] }] };
+        const fromBlock = decodeTransactionEvents(blockTxn).map(event => event.name).join();
+        const fromIndexer = decodeTransactionEvents(indexerTxn).map(event => event.name).join();
+        this.check('block and indexer transactions yield the same events, inner ones included',
+            fromBlock === 'HTLCClaimed,HTLCRefunded' && fromIndexer === fromBlock && decodeTransactionEvents({}).length === 0);
+        this.check('legacy keys are sha256 of the free-form id',
+            legacyHtlcKey('htlc-1') === '0x' + crypto.createHash('sha256').update('htlc-1').digest('hex'));
+    }
+
+    testContractAgreement() {
+        const python = fs.readFileSync(path.join(ALGORAND_DIR, 'HTLCEvents.py'), 'utf8');
+        const signatures = Object.keys(EVENT_DEFINITIONS).map(eventSignature);
+        this.check('HTLCEvents.py declares the same signatures', signatures.every(signature => python.includes(`"${signature}"`)));
+
+        const known = new Set(Object.keys(EVENT_DEFINITIONS).map(eventSelector));
+        const logged = TEAL_FILES.flatMap(file => [...fs.readFileSync(file, 'utf8').matchAll(/^byte 0x([0-9a-f]{8})\n/gm)].map(match => match[1]));
+        const perFile = TEAL_FILES.map(file => (fs.readFileSync(file, 'utf8').match(/^log$/gm) || []).length);
+        this.check('every TEAL app logs, and only known selectors',
+            logged.length > 0 && logged.every(selector => known.has(selector)) && perFile.every(count => count > 0),
+            `files=${TEAL_FILES.length} logs=${perFile.join(',')}`);
+    }
+
+    async run() {
+        console.log('🧪 ALGORAND HTLC EVENT TEST');
+        console.log('===========================');
+
+        this.testRoundTrips();
+        this.testRejection();
+        this.testTransactions();
+        this.testContractAgreement();
+
+        console.log('===========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new HtlcEventsTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { HtlcEventsTester };
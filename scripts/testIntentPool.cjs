@@ -0,0 +1,168 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 INTENT POOL TEST
+ *
+ * Offline checks for intentPool.cjs with a fake signer check and submitter:
+ * admission (signature once, dedupe, expiry), deadline ordering of batches,
+ * pruning, requeue on failure and on-chain skips.
+ */
+
+const { IntentPool, DeadlineHeap } = require('./intentPool.cjs');
+
+const makerOf = (i) => '0x' + (i % 5 + 1).toString(16).repeat(40);
+const orderAt = (i, deadline) => ({
+    intent: {
+        maker: makerOf(i),
+        makerToken: '0x' + '00'.repeat(20),
+        takerToken: '0x' + '00'.repeat(20),
+        makerAmount: '10000000000000000',
+        takerAmount: '3000000',
+        deadline,
+        algorandChainId: 416002,
+        algorandAddress: 'BJDBVZITI7VRHJLMPY4C6BX5UVBHZVNT6PRD3ZZWO2E2HSDYGSF4KO6RR4',
+        salt: '0x' + i.toString(16).padStart(64, '0'),
+        allowPartialFills: false,
+        minPartialFill: 0
+    },
+    hashlock: '0x' + 'aa'.repeat(32),
+    timelock: 0,
+    signature: `signed-by:${makerOf(i)}`
+});
+
+class IntentPoolTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    makePool(clock, submit, options = {}) {
+        this.recoveries = 0;
+        return new IntentPool({
+            now: () => clock.now,
+            recoverSigner: (order) => {
+                this.recoveries++;
+                return order.signature.replace('signed-by:', '');
+            },
+            submit,
+            deadlineMargin: 60,
+            maxBatch: 1000,
+            ...options
+        });
+    }
+
+    testHeap() {
+        const heap = new DeadlineHeap();
+        const deadlines = Array.from({ length: 200 }, (_, i) => (i * 7919) % 1009);
+        deadlines.forEach((deadline, i) => heap.push({ deadline, key: String(i) }));
+        const popped = [];
+        while (heap.size > 0) popped.push(heap.pop().deadline);
+        this.check('deadline heap pops in ascending order',
+            popped.join(',') === [...deadlines].sort((a, b) => a - b).join(','));
+    }
+
+    testAdmission() {
+        const clock = { now: 1000 };
+        const pool = this.makePool(clock);
+        const results = [
+            pool.add(orderAt(1, 5000)),
+            pool.add(orderAt(1, 5000)),
+            pool.add({ ...orderAt(2, 5000), intent: { ...orderAt(2, 5000).intent, maker: makerOf(1).toUpperCase().replace('0X', '0x') } }),
+            pool.add(orderAt(3, 1050)),
+            pool.add({ ...orderAt(4, 5000), signature: `signed-by:${makerOf(0)}` })
+        ];
+        this.check('valid intents are admitted once, duplicates and late intents rejected',
+            results.map(r => r.accepted).join(',') === 'true,false,false,false,false'
+            && results[1].reason === 'duplicate' && results[3].reason === 'expired'
+            && results[4].reason === 'signer is not the maker' && pool.size === 1);
+        this.check('signatures are recovered only for intents that pass the cheap checks', this.recoveries === 3);
+    }
+
+    async testBatches() {
+        const clock = { now: 1000 };
+        const submitted = [];
+        const pool = this.makePool(clock, async (orders) => {
+            submitted.push(orders.map(order => order.intent.deadline));
+            return { orderIds: orders.map((_, i) => '0x' + (i + 1).toString(16).padStart(64, '0')), txHash: '0xtx' };
+        }, { maxBatch: 5 });
+
+        const deadlines = [9000, 2000, 7000, 1500, 8000];
+        deadlines.forEach((deadline, i) => pool.add(orderAt(10 + i, deadline)));
+        await new Promise(resolve => setImmediate(resolve));
+        this.check('the pool flushes by itself once a batch is full', submitted.length === 1 && pool.size === 0);
+
+        pool.maxBatch = 10;
+        deadlines.forEach((deadline, i) => pool.add(orderAt(20 + i, deadline)));
+        pool.maxBatch = 3;
+        await pool.flush();
+        this.check('each batch takes the most urgent intents first',
+            submitted.length === 2 && submitted[1].join(',') === '1500,2000,7000' && pool.size === 2);
+
+        clock.now = 8000;
+        const expired = [];
+        pool.on('expired', ({ key }) => expired.push(key));
+        await pool.flush();
+        this.check('expired intents are pruned before a flush',
+            expired.length === 1 && submitted[2].join(',') === '9000' && pool.size === 0);
+
+        clock.now = 10_000;
+        pool.prune();
+        this.check('dedupe keys are forgotten once past their deadline', pool.seen.size === 0);
+    }
+
+    async testFailures() {
+        const clock = { now: 1000 };
+        let fail = true;
+        const dropped = [];
+        const pool = this.makePool(clock, async (orders) => {
+            if (fail) throw new Error('nonce too low');
+            return { orderIds: orders.map((_, i) => i === 0 ? '0x' + '00'.repeat(32) : '0x' + '01'.repeat(32)) };
+        }, { maxAttempts: 2 });
+        pool.on('dropped', event => dropped.push(event));
+
+        pool.add(orderAt(20, 5000));
+        pool.add(orderAt(21, 6000));
+        let threw = false;
+        try {
+            await pool.flush();
+        } catch (error) {
+            threw = true;
+        }
+        this.check('a failed submission requeues the batch', threw && pool.size === 2);
+
+        fail = false;
+        const result = await pool.flush();
+        this.check('orders skipped on-chain are reported as dropped',
+            result.keys.length === 2 && dropped.length === 1 && dropped[0].reason === 'skipped on-chain' && pool.size === 0);
+    }
+
+    async run() {
+        console.log('🧪 INTENT POOL TEST');
+        console.log('===================');
+
+        this.testHeap();
+        this.testAdmission();
+        await this.testBatches();
+        await this.testFailures();
+
+        console.log('===================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new IntentPoolTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { IntentPoolTester };
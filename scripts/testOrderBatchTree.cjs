@@ -0,0 +1,128 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 ORDER BATCH TREE TEST
+ *
+ * Offline checks for orderBatchTree.cjs: proofs for every order and batch size
+ * against a port of OpenZeppelin MerkleProof.processProof, rejection of altered
+ * intents, and submitLimitOrdersFromBatch chunking.
+ *
+ * Uses sha256 for nodes and leaves so it runs without ethers; the tree layout
+ * does not depend on the hash function.
+ */
+
+const crypto = require('crypto');
+const { OrderBatchTree } = require('./orderBatchTree.cjs');
+
+const sha256 = (data) => crypto.createHash('sha256').update(data).digest();
+const hashIntent = (intent) => sha256(Buffer.from(JSON.stringify(intent, (k, v) => typeof v === 'bigint' ? v.toString() : v)));
+const options = { hash: sha256, hashIntent };
+
+// MerkleProof.processProof with commutative (sorted-pair) hashing
+function processProof(proof, leaf) {
+    let computed = leaf;
+    for (const sibling of proof.map(hex => Buffer.from(hex.slice(2), 'hex'))) {
+        computed = Buffer.compare(computed, sibling) < 0
+            ? sha256(Buffer.concat([computed, sibling]))
+            : sha256(Buffer.concat([sibling, computed]));
+    }
+    return '0x' + computed.toString('hex');
+}
+
+const maker = '0x' + '11'.repeat(20);
+const intentAt = (i) => ({
+    maker,
+    makerToken: '0x' + '00'.repeat(20),
+    takerToken: '0x' + '00'.repeat(20),
+    makerAmount: 10n ** 16n + BigInt(i),
+    takerAmount: 2n * 10n ** 16n,
+    deadline: 1_760_000_000,
+    algorandChainId: 416002,
+    algorandAddress: 'BJDBVZITI7VRHJLMPY4C6BX5UVBHZVNT6PRD3ZZWO2E2HSDYGSF4KO6RR4',
+    salt: '0x' + i.toString(16).padStart(64, '0'),
+    allowPartialFills: false,
+    minPartialFill: 0n
+});
+
+class OrderBatchTreeTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testProofs() {
+        let allValid = true;
+        let maxDepth = 0;
+        for (let size = 1; size <= 33; size++) {
+            const intents = Array.from({ length: size }, (_, i) => intentAt(i));
+            const tree = new OrderBatchTree(intents, options);
+            intents.forEach((intent, i) => {
+                const proof = tree.proof(i);
+                maxDepth = Math.max(maxDepth, proof.length);
+                allValid = allValid && processProof(proof, hashIntent(intent)) === tree.root && tree.verify(intent, proof);
+            });
+        }
+        this.check('every order of every batch size verifies like MerkleProof', allValid);
+        this.check('proof length is logarithmic in the batch size', maxDepth === 6);
+
+        const single = new OrderBatchTree([intentAt(0)], options);
+        this.check('a one-order batch has the leaf as root and an empty proof',
+            single.root === '0x' + hashIntent(intentAt(0)).toString('hex') && single.proof(0).length === 0);
+    }
+
+    testRejections() {
+        const intents = Array.from({ length: 10 }, (_, i) => intentAt(i));
+        const tree = new OrderBatchTree(intents, options);
+        const altered = { ...intents[3], takerAmount: 1n };
+        this.check('an altered intent does not verify', !tree.verify(altered, tree.proof(3)) && !tree.verify(intents[4], tree.proof(3)));
+
+        let mixedRejected = false;
+        try {
+            new OrderBatchTree([intentAt(0), { ...intentAt(1), maker: '0x' + '22'.repeat(20) }], options);
+        } catch (error) {
+            mixedRejected = true;
+        }
+        this.check('intents of different makers cannot share a batch', mixedRejected);
+    }
+
+    testSubmissions() {
+        const intents = Array.from({ length: 60 }, (_, i) => intentAt(i));
+        const tree = new OrderBatchTree(intents, options);
+        const locks = intents.map((_, i) => ({ hashlock: '0x' + i.toString(16).padStart(64, 'f') }));
+        const calls = tree.submissions(locks, 25);
+        const expectedValue = (from, to) => intents.slice(from, to).reduce((sum, intent) => sum + intent.makerAmount, 0n);
+        this.check('submissions are chunked with msg.value equal to the summed makerAmounts',
+            calls.map(call => call.orders.length).join(',') === '25,25,10'
+            && calls[2].value === expectedValue(50, 60) && calls[0].orders[7].hashlock === locks[7].hashlock
+            && calls[0].orders[7].timelock === 0 && tree.verify(calls[1].orders[0].intent, calls[1].orders[0].proof));
+    }
+
+    async run() {
+        console.log('🧪 ORDER BATCH TREE TEST');
+        console.log('========================');
+
+        this.testProofs();
+        this.testRejections();
+        this.testSubmissions();
+
+        console.log('========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new OrderBatchTreeTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { OrderBatchTreeTester };
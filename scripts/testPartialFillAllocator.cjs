@@ -0,0 +1,169 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 PARTIAL FILL ALLOCATOR TEST
+ *
+ * Offline checks for partialFillAllocator.cjs:
+ * knapsack optimality against brute force, minFill / tail rules,
+ * gas-limited fill slots and incremental re-solves.
+ */
+
+const { PartialFillAllocator } = require('./partialFillAllocator.cjs');
+
+const eth = (x) => BigInt(Math.round(x * 1e6)) * 10n ** 12n;
+const algo = (x) => BigInt(Math.round(x * 1e6));
+
+class PartialFillAllocatorTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    allocator(options = {}) {
+        return new PartialFillAllocator({ priceOf: (asset) => asset === 'ETH' ? 1 : 0.001, ...options });
+    }
+
+    totalProfit(allocation) {
+        return [...allocation.values()].reduce((sum, fill) => sum + fill.profitEth, 0);
+    }
+
+    // Exhaustive search over every candidate combination at the same lot resolution
+    bruteForce(allocator, capacity) {
+        const lotSize = (capacity + BigInt(allocator.lotsPerAsset) - 1n) / BigInt(allocator.lotsPerAsset);
+        const capacityLots = Number(capacity / lotSize);
+        const lists = [...allocator.orders.values()].map(order => [null, ...allocator.candidateFills(order, lotSize, capacityLots)]);
+        let best = 0;
+        const walk = (i, lots, profit) => {
+            if (lots > capacityLots) return;
+            if (i === lists.length) {
+                best = Math.max(best, profit);
+                return;
+            }
+            for (const candidate of lists[i]) {
+                walk(i + 1, lots + (candidate ? candidate.lots : 0), profit + (candidate ? candidate.profitEth : 0));
+            }
+        };
+        walk(0, 0, 0);
+        return best;
+    }
+
+    testMatchesBruteForce() {
+        let seed = 12345;
+        const rand = () => (seed = (seed * 1103515245 + 12345) % 2147483648) / 2147483648;
+        let mismatches = 0;
+
+        for (let round = 0; round < 20; round++) {
+            const allocator = this.allocator({ lotsPerAsset: 20, gasCostWei: eth(0.0005) });
+            allocator.inventory.ALGO = algo(500 + rand() * 1500);
+            allocator.inventory.ETH = eth(1);
+            for (let i = 0; i < 4; i++) {
+                const makerAmount = eth(0.2 + rand());
+                const rate = 900 + rand() * 150; // ALGO per ETH, some orders unprofitable
+                allocator.upsertOrder({
+                    orderId: `o${i}`,
+                    makerAmount,
+                    takerAmount: algo(Number(makerAmount) / 1e18 * rate),
+                    minFill: makerAmount * BigInt(Math.floor(rand() * 40)) / 100n,
+                    allowPartial: rand() > 0.2,
+                    remainderBelowMin: rand() > 0.5
+                });
+            }
+            const got = this.totalProfit(allocator.solve());
+            const expected = this.bruteForce(allocator, allocator.inventory.ALGO);
+            if (Math.abs(got - expected) > 1e-12) {
+                mismatches++;
+                console.log(`   round ${round}: expected ${expected}, got ${got}`);
+            }
+        }
+        this.check('knapsack matches brute force (20 random books)', mismatches === 0);
+    }
+
+    testInventoryRespected() {
+        const allocator = this.allocator();
+        allocator.inventory = { ETH: eth(1), ALGO: algo(1500) };
+        allocator.upsertOrder({ orderId: 'A', makerAmount: eth(1), takerAmount: algo(950), minFill: eth(0.1) });
+        allocator.upsertOrder({ orderId: 'B', makerAmount: eth(1), takerAmount: algo(980), minFill: eth(0.2) });
+        const allocation = allocator.solve();
+        const spent = [...allocation.values()].reduce((sum, fill) => sum + fill.spendAmount, 0n);
+
+        this.check('best-margin order filled first', allocation.get('A')?.fillAmount === eth(1));
+        this.check('ALGO inventory never exceeded', spent <= algo(1500), `(spent ${spent})`);
+        this.check('delivery covers proportional taker amount', [...allocation.values()].every(fill =>
+            fill.spendAmount * eth(1) >= allocator.orders.get(fill.orderId).takerAmount * fill.fillAmount));
+    }
+
+    testMinFillRules() {
+        const allocator = this.allocator();
+        allocator.inventory = { ETH: eth(1), ALGO: algo(10_000) };
+        const base = { makerAmount: eth(1), takerAmount: algo(900), remaining: eth(0.05), minFill: eth(0.1) };
+
+        const partialBridge = allocator.candidateFills({ ...base, allowPartial: true, remainderBelowMin: true, fillsLeft: 3 }, 1000n, 1e6);
+        const enhancedBridge = allocator.candidateFills({ ...base, allowPartial: true, remainderBelowMin: false, fillsLeft: 3 }, 1000n, 1e6);
+        this.check('tail below minFill allowed on PartialFill bridge', partialBridge.some(c => c.fillAmount === eth(0.05)));
+        this.check('tail below minFill rejected on Enhanced bridge', enhancedBridge.length === 0);
+
+        const noDust = allocator.candidateFills({ ...base, remaining: eth(1), allowPartial: true, remainderBelowMin: false, fillsLeft: 3 }, algo(10), 1000);
+        this.check('no fill leaves a dust tail below minFill', noDust.every(c => c.fillAmount === eth(1) || eth(1) - c.fillAmount >= eth(0.1)));
+
+        const exhausted = allocator.candidateFills({ ...base, remaining: eth(1), allowPartial: true, fillsLeft: 0 }, algo(10), 1000);
+        this.check('orders without fill slots are skipped', exhausted.length === 0);
+    }
+
+    testGasLimitsFillCount() {
+        const allocator = this.allocator({ gasCostWei: eth(0.001) });
+        allocator.inventory = { ETH: eth(0.0025), ALGO: algo(10_000) };
+        for (const id of ['A', 'B', 'C', 'D']) {
+            allocator.upsertOrder({ orderId: id, makerAmount: eth(1), takerAmount: algo(950) });
+        }
+        this.check('fills capped by ETH available for gas', allocator.solve().size === 2);
+    }
+
+    async testIncrementalResolve() {
+        const allocator = this.allocator();
+        allocator.setInventory('ALGO', algo(1000));
+        allocator.setInventory('ETH', eth(1));
+        allocator.upsertOrder({ orderId: 'A', makerAmount: eth(1), takerAmount: algo(950), minFill: eth(0.1) });
+        allocator.upsertOrder({ orderId: 'B', makerAmount: eth(1), takerAmount: algo(980), minFill: eth(0.1) });
+
+        const first = await new Promise(resolve => allocator.once('allocation', resolve));
+        this.check('burst of updates coalesced into one solve', first.allocation.has('A'));
+
+        allocator.removeOrder('A');
+        const second = await new Promise(resolve => allocator.once('allocation', resolve));
+        this.check('removal frees inventory for the next order', second.changed.includes('A') && second.allocation.get('B')?.fillAmount > eth(0.9));
+
+        const idle = allocator.solve();
+        this.check('clean solve is a no-op', idle === second.allocation);
+    }
+
+    async run() {
+        console.log('🧪 PARTIAL FILL ALLOCATOR TEST');
+        console.log('==============================');
+
+        this.testMatchesBruteForce();
+        this.testInventoryRespected();
+        this.testMinFillRules();
+        this.testGasLimitsFillCount();
+        await this.testIncrementalResolve();
+
+        console.log('==============================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new PartialFillAllocatorTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { PartialFillAllocatorTester };
@@ -0,0 +1,130 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 PARTIAL FILL HISTORY INDEX TEST
+ *
+ * Offline checks for partialFillHistoryIndex.cjs against a mock contract:
+ * event join, chunked backfill, duplicate logs, paging and live events.
+ */
+
+const { EventEmitter } = require('events');
+const { PartialFillHistoryIndex } = require('./partialFillHistoryIndex.cjs');
+
+const ORDER = '0x' + 'ab'.repeat(32);
+
+class MockBridge extends EventEmitter {
+    constructor() {
+        super();
+        this.logs = [];
+        this.queries = [];
+        this.filters = {
+            PartialOrderFilled: () => 'PartialOrderFilled',
+            PartialFillSecretRevealed: () => 'PartialFillSecretRevealed'
+        };
+    }
+
+    addFill(blockNumber, fillIndex, fillAmount, fee, remaining) {
+        const transactionHash = `0xtx${blockNumber}`;
+        this.logs.push({ name: 'PartialOrderFilled', blockNumber, transactionHash, index: 0,
+            args: [ORDER, `0xresolver${fillIndex}`, fillAmount, remaining, fillAmount * 2n, fee, BigInt(fillIndex), remaining === 0n] });
+        this.logs.push({ name: 'PartialFillSecretRevealed', blockNumber, transactionHash, index: 1,
+            args: [ORDER, BigInt(fillIndex), `0xsecret${fillIndex}`] });
+    }
+
+    async queryFilter(name, fromBlock, toBlock) {
+        this.queries.push([name, fromBlock, toBlock]);
+        return this.logs.filter(log => log.name === name && log.blockNumber >= fromBlock && log.blockNumber <= toBlock);
+    }
+}
+
+class PartialFillHistoryIndexTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    bridgeWithFills(count) {
+        const bridge = new MockBridge();
+        let remaining = BigInt(count) * 100n;
+        for (let i = 0; i < count; i++) {
+            remaining -= 100n;
+            bridge.addFill(10 + i * 7, i, 100n, 5n, remaining);
+        }
+        return bridge;
+    }
+
+    async testBackfillJoinsEvents() {
+        const bridge = this.bridgeWithFills(3);
+        const index = new PartialFillHistoryIndex({ chunkBlocks: 10 });
+        await index.backfill(bridge, 0, 40);
+        const { total, fills } = index.getOrderFills(ORDER);
+        this.check('backfill joins fills with their secrets', total === 3 && fills.every(f => f.secret === `0xsecret${f.fillIndex}`));
+        this.check('backfill queries in block chunks', bridge.queries.length === 10, `(${bridge.queries.length} queries)`);
+    }
+
+    async testDuplicateLogsIgnored() {
+        const bridge = this.bridgeWithFills(2);
+        const index = new PartialFillHistoryIndex({ chunkBlocks: 100 });
+        await index.backfill(bridge, 0, 30);
+        await index.backfill(bridge, 0, 30);
+        const totals = index.getOrderTotals(ORDER);
+        this.check('overlapping backfill does not double count', totals.fillCount === 2 && totals.totalFees === 10n && totals.filled === 200n);
+    }
+
+    async testPaging() {
+        const bridge = this.bridgeWithFills(25);
+        const index = new PartialFillHistoryIndex({ chunkBlocks: 1000 });
+        await index.backfill(bridge, 0, 1000);
+        const page = index.getOrderFills(ORDER, { offset: 20, limit: 10 });
+        this.check('paging returns the tail in fill order', page.total === 25 && page.fills.length === 5 && page.fills[0].fillIndex === 20);
+    }
+
+    testLiveEvents() {
+        const bridge = new MockBridge();
+        const index = new PartialFillHistoryIndex();
+        index.attach(bridge);
+        const log = { transactionHash: '0xlive', index: 0, blockNumber: 99 };
+        bridge.emit('PartialOrderFilled', ORDER, '0xr', 10n, 0n, 20n, 1n, 0n, true, { log });
+        bridge.emit('PartialOrderFilled', ORDER, '0xr', 10n, 0n, 20n, 1n, 0n, true, { log });
+        bridge.emit('PartialFillSecretRevealed', ORDER, 0n, '0xs', { log: { ...log, index: 1 } });
+        const { fills } = index.getOrderFills(ORDER);
+        this.check('live events indexed once with secret', fills.length === 1 && fills[0].secret === '0xs' &&
+            index.getOrderTotals(ORDER).totalFees === 1n && index.lastBlock === 99);
+    }
+
+    testUnknownOrder() {
+        const index = new PartialFillHistoryIndex();
+        this.check('unknown order has empty history', index.getOrderFills(ORDER).total === 0 && index.getOrderTotals(ORDER) === null);
+    }
+
+    async run() {
+        console.log('🧪 PARTIAL FILL HISTORY INDEX TEST');
+        console.log('==================================');
+
+        await this.testBackfillJoinsEvents();
+        await this.testDuplicateLogsIgnored();
+        await this.testPaging();
+        this.testLiveEvents();
+        this.testUnknownOrder();
+
+        console.log('==================================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new PartialFillHistoryIndexTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { PartialFillHistoryIndexTester };
@@ -0,0 +1,123 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 RELAYER LOGGER TEST
+ *
+ * Offline checks for relayerLogger.cjs with an in-memory stream:
+ * level filtering, context fields, sampling, batching and backpressure.
+ */
+
+const { EventEmitter } = require('events');
+const { Logger } = require('./relayerLogger.cjs');
+
+class MemoryStream extends EventEmitter {
+    constructor(highWaterMark = Infinity) {
+        super();
+        this.writes = [];
+        this.highWaterMark = highWaterMark;
+    }
+
+    write(chunk) {
+        this.writes.push(chunk);
+        return this.writes.length < this.highWaterMark;
+    }
+
+    get lines() {
+        return this.writes.join('').split('\n').filter(Boolean).map(line => JSON.parse(line));
+    }
+}
+
+const tick = () => new Promise(resolve => setImmediate(resolve));
+
+class RelayerLoggerTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    logger(options = {}) {
+        const stream = new MemoryStream(options.highWaterMark);
+        const log = new Logger({ stream, format: 'json', flushOnExit: false, ...options });
+        return { stream, log };
+    }
+
+    async testLevelsAndContext() {
+        const { stream, log } = this.logger({ level: 'info' });
+        const swap = log.child({ orderHash: '0xabc' }).child({ lane: '0x01' });
+        swap.debug('hidden');
+        swap.info('committed', { amount: 10n ** 18n });
+        await tick();
+
+        const [line] = stream.lines;
+        this.check('below-level lines dropped', stream.lines.length === 1);
+        this.check('child context merged into line', line.orderHash === '0xabc' && line.lane === '0x01' && line.msg === 'committed');
+        this.check('BigInt fields serialized', line.amount === '1000000000000000000');
+    }
+
+    async testSampling() {
+        let now = 0;
+        const { stream, log } = this.logger({ level: 'debug', now: () => now });
+        for (let i = 0; i < 100; i++) {
+            log.sampled('poll', 1000).debug('poll tick', { i });
+            now += 50; // 100 ticks over 5 s -> 5 lines
+        }
+        await tick();
+
+        const lines = stream.lines;
+        this.check('sampled to one line per interval', lines.length === 5, `(got ${lines.length})`);
+        this.check('suppressed count reported', lines[1].suppressed === 19, `(got ${lines[1].suppressed})`);
+    }
+
+    async testBatching() {
+        const { stream, log } = this.logger();
+        for (let i = 0; i < 500; i++) log.info('event', { i });
+        this.check('no synchronous stream writes on the hot path', stream.writes.length === 0);
+        await tick();
+        this.check('one stream write per tick', stream.writes.length === 1 && stream.lines.length === 500);
+    }
+
+    async testBackpressure() {
+        const { stream, log } = this.logger({ highWaterMark: 1, maxBufferedLines: 10 });
+        log.info('first');
+        await tick();
+        for (let i = 0; i < 25; i++) log.info('while blocked', { i });
+        await tick();
+        this.check('writer pauses while stream is full', stream.writes.length === 1);
+
+        stream.emit('drain');
+        await tick();
+        const lines = stream.lines;
+        this.check('oldest lines dropped past buffer cap', lines.some(line => line.msg === 'log lines dropped' && line.dropped === 15));
+        this.check('newest lines kept', lines[lines.length - 1].i === 24);
+    }
+
+    async run() {
+        console.log('🧪 RELAYER LOGGER TEST');
+        console.log('======================');
+
+        await this.testLevelsAndContext();
+        await this.testSampling();
+        await this.testBatching();
+        await this.testBackpressure();
+
+        console.log('======================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new RelayerLoggerTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { RelayerLoggerTester };
@@ -0,0 +1,197 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 RELAYER LOGIC-SIGNATURE FLOW TEST
+ *
+ * Offline checks that CompleteCrossChainRelayer routes logic-signature escrows
+ * end to end: an ALGO → ETH funding is committed on Ethereum and claimed through
+ * the escrow, and a mirrored ETH → ALGO escrow's claim is recognized, its secret
+ * recorded and the refund sweep skips it. ethers/algosdk are stubbed; no network.
+ */
+
+const Module = require('module');
+const crypto = require('crypto');
+const { encodeAlgorandAddress, decodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const { SecretStore } = require('./secretStore.cjs');
+
+// The relayer requires ethers/algosdk at load time; only these helpers are reached here
+const STUBS = {
+    ethers: {
+        ethers: {
+            ZeroAddress: '0x' + '00'.repeat(20),
+            parseEther: (value) => BigInt(Math.round(Number(value) * 1e18)),
+            formatEther: (value) => (Number(value) / 1e18).toString(),
+            AbiCoder: { defaultAbiCoder: () => ({ encode: () => '0x' }) }
+        }
+    },
+    algosdk: {}
+};
+const load = Module._load;
+Module._load = function (request, ...rest) {
+    return request in STUBS ? STUBS[request] : load.call(this, request, ...rest);
+};
+const { CompleteCrossChainRelayer } = require('../working-scripts/relayer/completeCrossChainRelayer.cjs');
+Module._load = load;
+
+const account = (byte) => encodeAlgorandAddress('0x' + byte.repeat(32));
+const publicKey = (address) => Buffer.from(decodeAlgorandAddress(address).publicKey.slice(2), 'hex');
+
+class RelayerLogicSigFlowTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+        this.secret = '0x' + '5e'.repeat(32);
+        this.hashlock = '0x' + crypto.createHash('sha256').update(Buffer.from(this.secret.slice(2), 'hex')).digest('hex');
+        this.orderHash = '0x' + '0d'.repeat(32);
+        this.escrow = account('e5');
+        this.relayerAddr = account('c1');
+        this.swap = {
+            htlcId: '0x' + 'ab'.repeat(32),
+            hashlock: this.hashlock,
+            recipient: account('11'),
+            refundTo: account('22'),
+            timeoutRound: 45000000,
+            maxFee: 1000
+        };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    /**
+     * Relayer without its constructor: in-memory DB, fake chains, recorded Algorand spends
+     */
+    relayer() {
+        const relayer = Object.create(CompleteCrossChainRelayer.prototype);
+        const calls = { claims: [], refunds: [], appClaims: 0 };
+        relayer.calls = calls;
+        relayer.localDB = {
+            orderMappings: new Map(),
+            htlcMappings: new Map(),
+            logicSigEscrows: new Map(),
+            pendingSwaps: new Map(),
+            completedSwaps: new Map()
+        };
+        relayer.config = { ethereum: { relayerAddress: '0x' + '11'.repeat(20) } };
+        relayer.secretStore = new SecretStore();
+        relayer.algoAccount = { addr: this.relayerAddr };
+        relayer.ethProvider = { getBlock: async () => ({ timestamp: 1767225600 }) };
+        relayer.walletPool = {
+            submit: async () => ({ tx: { hash: '0xtx' }, receipt: { blockNumber: 1, logs: [{}] }, lane: 0 })
+        };
+        relayer.resolver = {
+            interface: { parseLog: () => ({ name: 'CrossChainOrderCreated', args: { orderHash: this.orderHash } }) }
+        };
+        relayer.logicSigHTLC = {
+            recognizeFunding: async () => ({ swap: this.swap, address: this.escrow, amount: 2500000n }),
+            create: async () => ({ txId: 'FUND', round: 100, address: this.escrow, swap: this.swap }),
+            claim: async (swap, secret) => {
+                calls.claims.push({ swap, secret });
+                return { txId: 'CLAIM', round: 101 };
+            },
+            refund: async (swap) => {
+                calls.refunds.push(swap);
+                return { txId: 'REFUND', round: 102 };
+            }
+        };
+        relayer.getOwnerLanes = () => [relayer.config.ethereum.relayerAddress];
+        relayer.monitorSecretReveal = () => {};
+        relayer.submitAlgorandAppClaim = async () => {
+            calls.appClaims++;
+            return { txId: 'APP', round: 101 };
+        };
+        relayer.saveDBToFile = () => {};
+        relayer.logSuccessfulSwap = () => {};
+        return relayer;
+    }
+
+    // Algod block shape of a close-out signed by the escrow
+    spend(closeTo, args = []) {
+        return {
+            id: 'SPEND',
+            txn: { type: 'pay', snd: publicKey(this.escrow), rcv: publicKey(closeTo), close: publicKey(closeTo) },
+            lsig: { arg: args }
+        };
+    }
+
+    async testAlgoToEthClaim() {
+        const relayer = this.relayer();
+        const funding = { id: 'FUND', txn: { type: 'pay', snd: publicKey(this.swap.refundTo), rcv: publicKey(this.escrow), amt: 2501000 } };
+        await relayer.processLogicSigPayment(funding, 100);
+
+        const mapping = relayer.localDB.orderMappings.get(this.orderHash);
+        this.check('a logic-signature funding is committed on Ethereum with its template parameters',
+            mapping && mapping.htlcId === this.escrow && mapping.logicSig === this.swap
+            && relayer.localDB.htlcMappings.get(this.escrow).orderHash === this.orderHash);
+
+        await relayer.triggerClaimOnAlgorand(this.orderHash, this.secret);
+        this.check('the revealed secret claims the escrow through logicSigHTLC.claim, not the app',
+            relayer.calls.claims.length === 1 && relayer.calls.claims[0].swap === this.swap
+            && relayer.calls.claims[0].secret === this.secret && relayer.calls.appClaims === 0
+            && relayer.localDB.completedSwaps.get(this.orderHash).status === 'COMPLETED');
+    }
+
+    async mirrored() {
+        const relayer = this.relayer();
+        relayer.localDB.orderMappings.set(this.orderHash, { htlcId: null, direction: 'ETH_TO_ALGO', status: 'ORDER_CREATED' });
+        await relayer.createMirroredLogicSigHTLC(this.orderHash, this.hashlock, 2500000, this.swap.recipient, 1767229200);
+        return relayer;
+    }
+
+    async testMirroredClaim() {
+        const relayer = await this.mirrored();
+        this.check('a mirrored escrow is indexed by its address',
+            relayer.localDB.logicSigEscrows.get(this.escrow) === this.orderHash);
+
+        await relayer.processLogicSigPayment(this.spend(this.swap.recipient, [Buffer.from(this.secret.slice(2), 'hex')]), 200);
+        const mapping = relayer.localDB.orderMappings.get(this.orderHash);
+        this.check("the recipient's claim is classified and its secret recorded for the Ethereum side",
+            mapping.status === 'ALGO_CLAIMED' && mapping.claimTxId === 'SPEND'
+            && relayer.secretStore.get(this.orderHash) === this.secret);
+
+        await relayer.refundExpiredLogicSigHTLCs(this.swap.timeoutRound + 10);
+        this.check('the refund sweep skips a claimed escrow after the timeout', relayer.calls.refunds.length === 0);
+    }
+
+    async testMirroredRefundAfterRestart() {
+        const relayer = await this.mirrored();
+        relayer.localDB.logicSigEscrows = new Map();
+        relayer.indexMirroredLogicSigEscrows(); // as after loadDBFromFile
+        this.check('the escrow index is rebuilt from persisted order mappings',
+            relayer.localDB.logicSigEscrows.get(this.escrow) === this.orderHash);
+
+        await relayer.refundExpiredLogicSigHTLCs(this.swap.timeoutRound);
+        await relayer.processLogicSigPayment(this.spend(this.swap.refundTo), 300);
+        await relayer.refundExpiredLogicSigHTLCs(this.swap.timeoutRound + 10);
+        this.check('an expired mirrored escrow is refunded once and its close-out is recognized',
+            relayer.calls.refunds.length === 1
+            && relayer.localDB.orderMappings.get(this.orderHash).status === 'ALGO_REFUNDED'
+            && relayer.secretStore.get(this.orderHash) === null);
+    }
+
+    async run() {
+        console.log('🧪 RELAYER LOGIC-SIGNATURE FLOW TEST');
+        console.log('====================================');
+
+        await this.testAlgoToEthClaim();
+        await this.testMirroredClaim();
+        await this.testMirroredRefundAfterRestart();
+
+        console.log('====================================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new RelayerLogicSigFlowTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { RelayerLogicSigFlowTester };
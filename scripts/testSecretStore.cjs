@@ -0,0 +1,133 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 SECRET STORE TEST
+ *
+ * Offline checks for secretStore.cjs against a fake event-only bridge:
+ * chunked backfill, live events, per-id recovery by topic, the storage
+ * fallback, and persistence.
+ */
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { EventEmitter } = require('events');
+const { SecretStore, ZERO_SECRET } = require('./secretStore.cjs');
+
+const id = (n) => '0x' + n.toString(16).padStart(64, '0');
+const secret = (n) => '0x' + (n + 0x100).toString(16).padStart(64, 'f');
+
+class FakeBridge extends EventEmitter {
+    constructor(logs, head, storedSecrets = new Map()) {
+        super();
+        this.logs = logs;
+        this.queries = [];
+        this.storedSecrets = storedSecrets;
+        this.runner = { provider: { getBlockNumber: async () => head } };
+        this.filters = { SecretRevealed: (htlcId) => ({ htlcId }) };
+    }
+
+    async queryFilter(filter, fromBlock, toBlock) {
+        this.queries.push([fromBlock, toBlock]);
+        return this.logs.filter(log => log.blockNumber >= fromBlock && log.blockNumber <= toBlock
+            && (filter.htlcId === undefined || log.args[0] === filter.htlcId));
+    }
+
+    async getRevealedSecret(htlcId) {
+        return this.storedSecrets.get(htlcId) || ZERO_SECRET;
+    }
+}
+
+const revealLog = (n, blockNumber) => ({
+    args: [id(n), secret(n)], blockNumber, transactionHash: '0x' + n.toString(16).padStart(64, 'a')
+});
+
+class SecretStoreTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    async testBackfill() {
+        const bridge = new FakeBridge([revealLog(1, 10), revealLog(2, 2500), revealLog(1, 2600)], 3000);
+        const store = new SecretStore({ chunkBlocks: 1000 });
+        const seen = [];
+        store.on('secret', event => seen.push(event.id));
+
+        const added = await store.backfill(bridge, 0, 2999);
+        this.check('backfill walks fixed chunks and keeps the first reveal per id',
+            added === 2 && bridge.queries.length === 3 && bridge.queries[2][1] === 2999
+            && store.get(id(1)) === secret(1) && store.secrets.get(id(1)).blockNumber === 10 && seen.length === 2);
+        this.check('backfill advances the resume block', store.lastBlock === 2999);
+
+        bridge.emit('SecretRevealed', id(3), secret(3), { log: { blockNumber: 3001, transactionHash: '0x03' } });
+        store.attach(bridge);
+        bridge.emit('SecretRevealed', id(3), secret(3), { log: { blockNumber: 3001, transactionHash: '0x03' } });
+        bridge.emit('SecretRevealed', id(3), secret(3), { log: { blockNumber: 3001, transactionHash: '0x03' } });
+        this.check('live events are stored once', store.get(id(3)) === secret(3) && seen.length === 3 && store.lastBlock === 3001);
+    }
+
+    async testResolve() {
+        const bridge = new FakeBridge([revealLog(7, 48_200)], 50_000, new Map([[id(8), secret(8)]]));
+        const store = new SecretStore({ chunkBlocks: 1000, lookbackBlocks: 5000 });
+
+        const found = await store.resolve(bridge, id(7));
+        this.check('resolve scans newest chunks first and stops at the reveal',
+            found === secret(7) && bridge.queries.length === 2 && bridge.queries[0][1] === 50_000);
+
+        bridge.queries = [];
+        const cached = await store.resolve(bridge, id(7));
+        this.check('resolved secrets are served from memory', cached === secret(7) && bridge.queries.length === 0);
+
+        const legacy = await store.resolve(bridge, id(8));
+        const missing = await store.resolve(bridge, id(9));
+        this.check('storage getter is the fallback and the scan is bounded by lookbackBlocks',
+            legacy === secret(8) && missing === null && bridge.queries.length === 10
+            && Math.min(...bridge.queries.map(([from]) => from)) === 45_001);
+    }
+
+    async testPersistence() {
+        const file = path.join(os.tmpdir(), `secret-store-${process.pid}.json`);
+        try {
+            const bridge = new FakeBridge([revealLog(4, 120)], 200);
+            const store = new SecretStore({ persistPath: file });
+            await store.backfill(bridge, 0, 200);
+
+            const reloaded = new SecretStore({ persistPath: file });
+            this.check('persisted store reloads secrets and the resume block',
+                reloaded.get(id(4)) === secret(4) && reloaded.lastBlock === 200
+                && reloaded.secrets.get(id(4)).transactionHash === revealLog(4, 120).transactionHash);
+        } finally {
+            if (fs.existsSync(file)) fs.unlinkSync(file);
+        }
+    }
+
+    async run() {
+        console.log('🧪 SECRET STORE TEST');
+        console.log('====================');
+
+        await this.testBackfill();
+        await this.testResolve();
+        await this.testPersistence();
+
+        console.log('====================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new SecretStoreTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { SecretStoreTester };
@@ -0,0 +1,143 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 SECRET TREE TEST
+ *
+ * Offline checks for secretTree.cjs: proofs for every leaf and tree size,
+ * rejection of wrong secrets/indices, and the part/index rule against a
+ * literal port of BaseEscrowFactory._isValidPartialFill.
+ *
+ * Uses sha256 as the node hash so it runs without ethers; tree layout and
+ * index logic do not depend on the hash function.
+ */
+
+const crypto = require('crypto');
+const { SecretTree, secretIndex } = require('./secretTree.cjs');
+
+const sha256 = (data) => crypto.createHash('sha256').update(data).digest();
+
+// BaseEscrowFactory._isValidPartialFill, validatedIndex = secret index + 1
+function isValidPartialFill(makingAmount, remainingMakingAmount, orderMakingAmount, partsAmount, validatedIndex) {
+    const calculatedIndex = (orderMakingAmount - remainingMakingAmount + makingAmount - 1n) * partsAmount / orderMakingAmount;
+    if (remainingMakingAmount === makingAmount) return calculatedIndex + 2n === validatedIndex;
+    if (orderMakingAmount !== remainingMakingAmount) {
+        const prevCalculatedIndex = (orderMakingAmount - remainingMakingAmount - 1n) * partsAmount / orderMakingAmount;
+        if (calculatedIndex === prevCalculatedIndex) return false;
+    }
+    return calculatedIndex + 1n === validatedIndex;
+}
+
+class SecretTreeTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testProofsAllSizes() {
+        let failures = 0;
+        for (let parts = 2; parts <= 20; parts++) {
+            const tree = SecretTree.generate(parts, { hash: sha256 });
+            for (let i = 0; i <= parts; i++) {
+                if (!tree.verify(i, tree.secret(i), tree.proof(i))) failures++;
+            }
+        }
+        this.check('every leaf proves against the root for 2..20 parts', failures === 0, `(${failures} failures)`);
+    }
+
+    testRejectsWrongSecret() {
+        const tree = SecretTree.generate(5, { hash: sha256 });
+        this.check('secret of another part rejected', !tree.verify(2, tree.secret(3), tree.proof(2)));
+        this.check('valid secret at wrong index rejected', !tree.verify(3, tree.secret(2), tree.proof(2)));
+    }
+
+    testIndexRuleMatchesContract() {
+        let mismatches = 0;
+        const total = 1000n;
+        for (const parts of [2n, 3n, 4n, 7n, 10n]) {
+            for (let before = 0n; before < total; before += 37n) {
+                for (const fill of [1n, 50n, 125n, 333n, total - before]) {
+                    if (before + fill > total) continue;
+                    const { valid, index } = secretIndex(total, before, fill, parts);
+                    const remaining = total - before;
+                    const expected = [];
+                    for (let idx = 0n; idx <= parts; idx++) {
+                        if (isValidPartialFill(fill, remaining, total, parts, idx + 1n)) expected.push(Number(idx));
+                    }
+                    const ok = valid ? expected.length === 1 && expected[0] === index : expected.length === 0;
+                    if (!ok) mismatches++;
+                }
+            }
+        }
+        this.check('secretIndex matches _isValidPartialFill', mismatches === 0, `(${mismatches} mismatches)`);
+    }
+
+    testMinFillToNextPart() {
+        let errors = 0;
+        const total = 1000n;
+        for (const parts of [2, 3, 4, 10]) {
+            for (let before = 0n; before < total; before += 13n) {
+                const min = SecretTree.minFillToNextPart(total, before, parts);
+                if (!secretIndex(total, before, min, parts).valid) errors++;
+                if (min > 1n && before + min < total && secretIndex(total, before, min - 1n, parts).valid) errors++;
+            }
+        }
+        this.check('minFillToNextPart is the smallest valid fill', errors === 0, `(${errors} errors)`);
+    }
+
+    testFillArgs() {
+        const tree = SecretTree.generate(4, { hash: sha256 });
+        const first = tree.fillArgs(1000n, 0n, 300n);
+        const samePart = tree.fillArgs(1000n, 300n, 100n);
+        const completion = tree.fillArgs(1000n, 300n, 700n);
+        this.check('fill args carry the index secret and proof', first.index === 1 && tree.verify(1, first.secret, first.proof));
+        this.check('fill inside the previous part gets no secret', samePart === null);
+        this.check('completing fill uses the last secret', completion.index === 4);
+    }
+
+    testJsonRoundTrip() {
+        const tree = SecretTree.generate(6, { hash: sha256 });
+        const copy = SecretTree.fromJSON(JSON.parse(JSON.stringify(tree)), { hash: sha256 });
+        this.check('JSON round trip keeps the root', copy.root === tree.root && copy.partsAmount === 6);
+    }
+
+    testLargeTreeSpeed() {
+        const start = process.hrtime.bigint();
+        const tree = SecretTree.generate(4096, { hash: sha256 });
+        for (let i = 0; i <= tree.partsAmount; i++) tree.proof(i);
+        const ms = Number(process.hrtime.bigint() - start) / 1e6;
+        this.check('4096-part tree and all proofs under 1s', ms < 1000, `(${ms.toFixed(1)}ms)`);
+    }
+
+    run() {
+        console.log('🧪 SECRET TREE TEST');
+        console.log('===================');
+
+        this.testProofsAllSizes();
+        this.testRejectsWrongSecret();
+        this.testIndexRuleMatchesContract();
+        this.testMinFillToNextPart();
+        this.testFillArgs();
+        this.testJsonRoundTrip();
+        this.testLargeTreeSpeed();
+
+        console.log('===================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    process.exit(new SecretTreeTester().run() ? 0 : 1);
+}
+
+module.exports = { SecretTreeTester };
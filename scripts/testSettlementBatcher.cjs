@@ -0,0 +1,151 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 SETTLEMENT BATCHER TEST
+ *
+ * Offline checks for settlementBatcher.cjs: size/window flushing, dedupe,
+ * per-item results, bisecting reverted batches and receipt decoding.
+ */
+
+const { SettlementBatcher } = require('./settlementBatcher.cjs');
+
+class MockSettlement {
+    constructor() {
+        this.calls = [];
+        this.revertOn = new Set();     // ids whose payout reverts the whole batch
+        this.invalid = new Set();      // ids the contract skips with a reason
+    }
+
+    async submit(items) {
+        this.calls.push(items.map(item => item.id));
+        const bad = items.find(item => this.revertOn.has(item.id));
+        if (bad) throw new Error(`transfer failed for ${bad.id}`);
+        const results = new Map(items.map(item => [item.id, this.invalid.has(item.id)
+            ? { success: false, reason: 'Invalid secret' }
+            : { success: true, reason: '' }]));
+        return { results, txHash: `0x${this.calls.length}` };
+    }
+}
+
+class SettlementBatcherTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    batcher(mock, options = {}) {
+        return new SettlementBatcher({ submit: items => mock.submit(items), maxBatch: 4, windowMs: 20, ...options });
+    }
+
+    async testFlushWhenFull() {
+        const mock = new MockSettlement();
+        const batcher = this.batcher(mock, { windowMs: 60000 });
+        const results = await Promise.all([1, 2, 3, 4].map(id => batcher.add(id)));
+        this.check('full batch flushes without waiting for the window', mock.calls.length === 1 && results.every(r => r.success));
+    }
+
+    async testFlushAfterWindow() {
+        const mock = new MockSettlement();
+        const batcher = this.batcher(mock);
+        const result = await batcher.add(1);
+        this.check('partial batch flushes after the window', mock.calls.length === 1 && result.success && result.txHash === '0x1');
+    }
+
+    async testDedupe() {
+        const mock = new MockSettlement();
+        const batcher = this.batcher(mock);
+        const first = batcher.add('a');
+        const second = batcher.add('a');
+        await Promise.all([first, second]);
+        this.check('duplicate id shares one pending entry', first === second && mock.calls[0].length === 1);
+    }
+
+    async testPerItemResults() {
+        const mock = new MockSettlement();
+        mock.invalid.add(2);
+        const batcher = this.batcher(mock);
+        const [one, two] = await Promise.all([batcher.add(1), batcher.add(2)]);
+        this.check('skipped item reports its reason', one.success && !two.success && two.reason === 'Invalid secret');
+        this.check('skipped item does not cost an extra transaction', mock.calls.length === 1);
+    }
+
+    async testBisectOnRevert() {
+        const mock = new MockSettlement();
+        mock.revertOn.add(3);
+        const batcher = this.batcher(mock);
+        const results = await Promise.all([1, 2, 3, 4].map(id => batcher.add(id)));
+        this.check('reverting item isolated by bisection', results.filter(r => r.success).length === 3 && !results[2].success,
+            JSON.stringify(results));
+        this.check('bisection stops at the failing item', mock.calls.some(call => call.length === 1 && call[0] === 3) &&
+            batcher.stats.splits === 2, `(${JSON.stringify(mock.calls)})`);
+    }
+
+    async testOversizedFlushChunks() {
+        const mock = new MockSettlement();
+        const batcher = this.batcher(mock, { maxBatch: 100, windowMs: 60000 });
+        const pending = [...Array(10).keys()].map(id => batcher.add(id));
+        batcher.maxBatch = 4;
+        batcher.flush();
+        await Promise.all(pending);
+        this.check('flush splits the queue into maxBatch chunks', mock.calls.map(call => call.length).join(',') === '4,4,2');
+    }
+
+    testResultsFromReceipt() {
+        const iface = {
+            parseLog(log) {
+                if (log.topic !== 'batch') throw new Error('unknown event');
+                return { name: 'HTLCBatchResult', args: [log.id, log.ok, log.reason] };
+            }
+        };
+        const receipt = { logs: [
+            { topic: 'batch', id: '0x01', ok: true, reason: '' },
+            { topic: 'other' },
+            { topic: 'batch', id: '0x02', ok: false, reason: 'HTLC expired' }
+        ] };
+        const results = SettlementBatcher.resultsFromReceipt(iface, receipt);
+        this.check('receipt decoding maps ids to results', results.size === 2 && results.get('0x01').success &&
+            results.get('0x02').reason === 'HTLC expired');
+
+        // AlgorandHTLCBridge reports custom error selectors
+        iface.parseError = (data) => data === '0xdeadbeef' ? { name: 'HTLCExpired' } : null;
+        const selectors = SettlementBatcher.resultsFromReceipt(iface, { logs: [
+            { topic: 'batch', id: '0x03', ok: true, reason: '0x00000000' },
+            { topic: 'batch', id: '0x04', ok: false, reason: '0xdeadbeef' }
+        ] });
+        this.check('selector reasons resolve to error names',
+            selectors.get('0x03').reason === '' && selectors.get('0x04').reason === 'HTLCExpired');
+    }
+
+    async run() {
+        console.log('🧪 SETTLEMENT BATCHER TEST');
+        console.log('==========================');
+
+        await this.testFlushWhenFull();
+        await this.testFlushAfterWindow();
+        await this.testDedupe();
+        await this.testPerItemResults();
+        await this.testBisectOnRevert();
+        await this.testOversizedFlushChunks();
+        this.testResultsFromReceipt();
+
+        console.log('==========================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new SettlementBatcherTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { SettlementBatcherTester };
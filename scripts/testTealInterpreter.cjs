@@ -0,0 +1,156 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 TEAL INTERPRETER & COST BENCHMARK TEST
+ *
+ * Offline checks for tealInterpreter.cjs and benchAlgorandTeal.cjs: assembly,
+ * AVM type/assert/budget failures, opcode costs, rollback of rejected calls,
+ * box HTLC logs vs the event decoder, the logic-signature HTLC rules, snapshot
+ * comparison, and the committed snapshot itself.
+ */
+
+const fs = require('fs');
+const path = require('path');
+const crypto = require('crypto');
+const { encodeAlgorandAddress } = require('./compactLimitOrder.cjs');
+const { TealMachine, assembleTeal, createLedger, addressBytes, applicationAddress } = require('./tealInterpreter.cjs');
+const { encodeHtlcEvent } = require('./htlcEvents.cjs');
+const { fillHtlcTemplate } = require('./algorandLogicSigHTLC.cjs');
+const { SNAPSHOT_PATH, runBenchmarks, compareSnapshots } = require('./benchAlgorandTeal.cjs');
+
+const ALGORAND_DIR = path.join(__dirname, '../contracts/algorand');
+
+class TealInterpreterTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+        this.alice = encodeAlgorandAddress('0x' + 'a1'.repeat(32));
+        this.bob = encodeAlgorandAddress('0x' + 'b0'.repeat(32));
+        this.secret = Buffer.alloc(32, 0x5e);
+        this.hashlock = crypto.createHash('sha256').update(this.secret).digest();
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    exec(source, options = {}) {
+        return new TealMachine(source).run({ txn: { Sender: this.alice }, ...options });
+    }
+
+    testMachine() {
+        const program = assembleTeal('#pragma version 8\nbyte "a b" // comment\nlen\nint 3\n==\nbnz done\nerr\ndone:\nint 1\nreturn\n');
+        this.check('assembler keeps quoted strings and resolves labels',
+            program.version === 8 && program.ops.length === 8 && program.labels.done === 6
+            && this.exec(program).approved);
+
+        let unknownLabel = false;
+        try {
+            assembleTeal('int 1\nbnz nowhere\n');
+        } catch (error) {
+            unknownLabel = /Unknown label nowhere/.test(error.message);
+        }
+        const typeError = this.exec('int 0\nbyte "x"\n==\n');
+        const assertError = this.exec('int 0\nassert\nint 1\n');
+        const loop = this.exec('loop:\nint 1\nbnz loop\n');
+        this.check('unknown labels, type mismatches, failed asserts and runaway loops are rejected',
+            unknownLabel
+            && /compares a uint64 with bytes/.test(typeError.error)
+            && /assert failed \(line 2\)/.test(assertError.error)
+            && /budget exceeded/.test(loop.error) && loop.cost === 701);
+
+        const hashed = this.exec('byte "x"\nsha256\nlen\nint 32\n==\n');
+        this.check('sha256 costs 35, other opcodes 1', hashed.approved && hashed.cost === 39);
+
+        const ledger = createLedger();
+        const rejected = this.exec('byte "k"\nint 7\napp_global_put\nint 0\n', { ledger });
+        const accepted = this.exec('byte "k"\nint 7\napp_global_put\nint 1\n', { ledger });
+        this.check('rejected calls leave the ledger untouched, approved ones report their delta',
+            !rejected.approved && rejected.delta.global.k === undefined
+            && accepted.approved && accepted.delta.global.k === 7 && ledger.global.get(Buffer.from('k').toString('hex')) === 7n);
+    }
+
+    testBoxHtlcLogs() {
+        const machine = new TealMachine(fs.readFileSync(path.join(ALGORAND_DIR, 'AlgorandBoxHTLCBridge.teal'), 'utf8'));
+        const ledger = createLedger();
+        const htlcId = Buffer.alloc(32, 0xab);
+        const uint64 = (value) => {
+            const word = Buffer.alloc(8);
+            word.writeBigUInt64BE(BigInt(value));
+            return word;
+        };
+        const base = { appId: 1001, ledger, timestamp: 1767225600 };
+        const created = machine.run({
+            ...base,
+            txn: { Sender: this.alice, ApplicationID: 1001, GroupIndex: 1, ApplicationArgs: [Buffer.from('create_htlc'), htlcId, this.hashlock, uint64(1767232800), addressBytes(this.bob)] },
+            group: [{ TypeEnum: 'pay', Sender: this.alice, Receiver: applicationAddress(1001), Amount: 1000000 + 60100 }]
+        });
+        const claimed = machine.run({ ...base, txn: { Sender: this.bob, ApplicationID: 1001, ApplicationArgs: [Buffer.from('claim_htlc'), htlcId, this.secret] } });
+        const expected = encodeHtlcEvent('HTLCClaimed', { htlcKey: '0x' + htlcId.toString('hex'), recipient: this.bob, secret: '0x' + this.secret.toString('hex'), amount: 1000000n });
+        this.check('box HTLC create/claim run end to end and log what the event decoder expects',
+            created.approved && claimed.approved
+            && claimed.logs.length === 1 && Buffer.compare(claimed.logs[0], expected) === 0
+            && claimed.innerTxns.length === 2 && claimed.innerTxns[0].Receiver === this.bob && claimed.innerTxns[0].Amount === 1000000
+            && claimed.delta.boxes['0x' + htlcId.toString('hex')] === null && ledger.boxes.size === 0,
+            claimed.error || created.error || '');
+    }
+
+    testLogicSig() {
+        const teal = fillHtlcTemplate({ hashlock: '0x' + this.hashlock.toString('hex'), recipient: this.bob, refundTo: this.alice, timeoutRound: 2000 });
+        const machine = new TealMachine(teal);
+        const spend = (to, fields, args = []) => machine.run({
+            mode: 'signature', args,
+            txn: { TypeEnum: 'pay', Amount: 0, Receiver: to, CloseRemainderTo: to, Fee: 1000, FirstValid: 1000, LastValid: 1999, ...fields }
+        }).approved;
+        this.check('logic-signature HTLC: claim needs the preimage before the timeout, refund only after it',
+            spend(this.bob, {}, [this.secret])
+            && !spend(this.bob, {}, [Buffer.alloc(32)])
+            && !spend(this.bob, { LastValid: 2000 }, [this.secret])
+            && !spend(this.alice, {})
+            && spend(this.alice, { FirstValid: 2000, LastValid: 3000 }));
+        this.check('logic-signature HTLC rejects rekeys, payments and fees above the cap',
+            !spend(this.bob, { RekeyTo: this.alice }, [this.secret])
+            && !spend(this.bob, { Amount: 1 }, [this.secret])
+            && !spend(this.bob, { Fee: 1001 }, [this.secret]));
+    }
+
+    testSnapshots() {
+        const base = { App: { claim: { result: 'approved', cost: 100, fee: 2000, delta: { global: {}, local: {}, boxes: {} } } }, Py: { skipped: 'pyteal not installed' } };
+        const worse = { App: { claim: { ...base.App.claim, cost: 120, result: 'rejected: assert failed (line 9)' } }, Py: { skipped: 'pyteal not installed' } };
+        const better = { App: { claim: { ...base.App.claim, cost: 90 }, refund: { ...base.App.claim, cost: 60 } } };
+        const regressed = compareSnapshots(base, worse);
+        const improved = compareSnapshots(base, better);
+        this.check('snapshot comparison flags cost and outcome regressions, lists improvements',
+            regressed.regressions.length === 2 && improved.regressions.length === 0 && improved.improvements.length === 2);
+
+        const snapshot = JSON.parse(fs.readFileSync(SNAPSHOT_PATH, 'utf8'));
+        const { regressions } = compareSnapshots(snapshot, runBenchmarks());
+        this.check('committed programs match the committed cost snapshot', regressions.length === 0, regressions.join('; '));
+    }
+
+    async run() {
+        console.log('🧪 TEAL INTERPRETER & COST BENCHMARK TEST');
+        console.log('=========================================');
+
+        this.testMachine();
+        this.testBoxHtlcLogs();
+        this.testLogicSig();
+        this.testSnapshots();
+
+        console.log('=========================================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new TealInterpreterTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { TealInterpreterTester };
@@ -0,0 +1,110 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 TIMELOCKS TEST
+ *
+ * Offline checks for timelocks.cjs: packing against the TimelocksLib bit layout,
+ * stage boundaries (a stage starts at its timestamp, as in the contracts)
+ * and the stage scheduler's timers.
+ */
+
+const { Timelocks, TimelockScheduler } = require('./timelocks.cjs');
+
+// TimelocksLib.get, literally: (data >> 224) + uint32(data >> stage * 32)
+const referenceGet = (data, stage) => (data >> 224n) + ((data >> BigInt(stage * 32)) & 0xffffffffn);
+
+class TimelocksTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    testPackMatchesLayout() {
+        const deployedAt = 1_700_000_000n;
+        const timelocks = Timelocks.pack(deployedAt, { withdrawal: 3600, publicWithdrawal: 25200, cancellation: 86400, publicCancellation: 90000 });
+        const expected = [3600n, 25200n, 86400n, 90000n].map(offset => deployedAt + offset);
+        const same = expected.every((at, stage) => referenceGet(timelocks.word, stage) === at && timelocks.get(stage) === at);
+        this.check('pack matches TimelocksLib.get for every source stage', same && timelocks.deployedAt === deployedAt);
+        this.check('rescueStart is deployedAt + delay', timelocks.rescueStart(604800) === deployedAt + 604800n);
+    }
+
+    testPackRejects() {
+        const throws = (fn) => {
+            try {
+                fn();
+                return false;
+            } catch (error) {
+                return true;
+            }
+        };
+        this.check('out-of-order and overlong offsets rejected',
+            throws(() => Timelocks.pack(0, { withdrawal: 10, publicWithdrawal: 5, cancellation: 20, publicCancellation: 20 }))
+            && throws(() => Timelocks.pack(0, { publicWithdrawal: 1, cancellation: 1, publicCancellation: 2n ** 32n }))
+            && throws(() => Timelocks.untilExpiry(100, 100)));
+    }
+
+    testStageBoundaries() {
+        const timelocks = Timelocks.untilExpiry(1000, 2000);
+        this.check('plain HTLC: withdrawal from creation, refund from expiry',
+            timelocks.stageAt(999) === 'created' && timelocks.stageAt(1000) === 'srcWithdrawal'
+            && timelocks.stageAt(1999) === 'srcWithdrawal' && timelocks.stageAt(2000) === 'srcPublicCancellation');
+
+        const staged = Timelocks.pack(0, { withdrawal: 3600, publicWithdrawal: 25200, cancellation: 86400, publicCancellation: 86400 });
+        this.check('staged order: srcStagesStarted counts started stages',
+            staged.srcStagesStarted(3599) === 0 && staged.srcStagesStarted(3600) === 1
+            && staged.srcStagesStarted(25200) === 2 && staged.srcStagesStarted(86400) === 4);
+        const next = staged.nextStage(3600);
+        this.check('nextStage is strictly after now', next.stage === 'srcPublicWithdrawal' && next.at === 25200n);
+    }
+
+    async testScheduler() {
+        const start = Math.floor(Date.now() / 1000);
+        const scheduler = new TimelockScheduler();
+        const fired = [];
+        scheduler.on('stage', ({ key, stage }) => fired.push(`${key}:${stage}`));
+
+        scheduler.track('a', Timelocks.pack(start, { withdrawal: 0, publicWithdrawal: 0, cancellation: 1, publicCancellation: 1 }));
+        const immediate = fired.slice();
+        await new Promise(resolve => setTimeout(resolve, 2200));
+
+        this.check('started stages fire immediately, in order', immediate.join() === 'a:srcWithdrawal,a:srcPublicWithdrawal');
+        this.check('later stages fire on their timer and the order is released',
+            fired.slice(2).join() === 'a:srcCancellation,a:srcPublicCancellation' && scheduler.pending().length === 0, `(${fired.join()})`);
+
+        scheduler.track('far', Timelocks.untilExpiry(start, start + 90 * 86400));
+        const pending = scheduler.pending();
+        this.check('far stages stay armed (timer clamped) and untrack clears them',
+            pending.length === 1 && pending[0].next.stage === 'srcPublicWithdrawal' && scheduler.untrack('far') && scheduler.pending().length === 0);
+        scheduler.stop();
+    }
+
+    async run() {
+        console.log('🧪 TIMELOCKS TEST');
+        console.log('=================');
+
+        this.testPackMatchesLayout();
+        this.testPackRejects();
+        this.testStageBoundaries();
+        await this.testScheduler();
+
+        console.log('=================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new TimelocksTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { TimelocksTester };
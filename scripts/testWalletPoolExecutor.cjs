@@ -0,0 +1,193 @@
+#!/usr/bin/env node
+
+/**
+ * 🧪 WALLET POOL EXECUTOR TEST
+ *
+ * Offline checks for walletPoolExecutor.cjs against a mock chain:
+ * lane spreading, funding limits, swap affinity, lane pinning, per-lane nonces,
+ * queueing when saturated and background rebalancing.
+ */
+
+const { WalletPoolExecutor } = require('./walletPoolExecutor.cjs');
+
+const ETH = 10n ** 18n;
+
+class MockChain {
+    constructor() {
+        this.balances = new Map();
+        this.nonces = new Map();
+        this.sent = [];
+        this.confirmDelayMs = 20;
+    }
+
+    async getBalance(address) {
+        return this.balances.get(address) || 0n;
+    }
+
+    async getTransactionCount(address) {
+        return this.nonces.get(address) || 0;
+    }
+
+    async getFeeData() {
+        return { gasPrice: 1n };
+    }
+
+    signer(address, balance) {
+        this.balances.set(address, balance);
+        const chain = this;
+        return {
+            address,
+            async sendTransaction(tx) {
+                return chain.broadcast(address, tx);
+            }
+        };
+    }
+
+    broadcast(from, tx) {
+        const expected = this.nonces.get(from) || 0;
+        if (tx.nonce !== expected) throw new Error(`nonce too low: expected ${expected}, got ${tx.nonce}`);
+        this.nonces.set(from, expected + 1);
+        this.sent.push({ from, ...tx });
+        const value = BigInt(tx.value || 0n);
+        return {
+            hash: `0x${from.slice(2, 6)}${tx.nonce}`,
+            wait: () => new Promise(resolve => setTimeout(() => {
+                this.balances.set(from, this.balances.get(from) - value - 21000n);
+                if (tx.to) this.balances.set(tx.to, (this.balances.get(tx.to) || 0n) + value);
+                resolve({ gasUsed: 21000n, gasPrice: 1n, blockNumber: 1 });
+            }, this.confirmDelayMs))
+        };
+    }
+}
+
+class WalletPoolExecutorTester {
+    constructor() {
+        this.results = { passed: 0, failed: 0, errors: [] };
+    }
+
+    check(name, condition, detail = '') {
+        if (condition) {
+            this.results.passed++;
+            console.log(`✅ ${name}`);
+        } else {
+            this.results.failed++;
+            this.results.errors.push(name);
+            console.log(`❌ ${name} ${detail}`);
+        }
+    }
+
+    async pool(balances, options = {}) {
+        const chain = new MockChain();
+        const signers = balances.map((balance, i) => chain.signer(`0x${String(i + 1).repeat(40)}`, balance));
+        const pool = await new WalletPoolExecutor(chain, signers, {
+            maxInFlightPerLane: 2,
+            minLaneBalance: ETH / 10n,
+            targetLaneBalance: ETH / 2n,
+            ...options
+        }).init();
+        return { chain, pool };
+    }
+
+    transfer(to = '0x' + 'f'.repeat(40)) {
+        return (signer, overrides) => signer.sendTransaction({ to, value: 0n, ...overrides });
+    }
+
+    async testSpreadsAcrossLanes() {
+        const { chain, pool } = await this.pool([ETH, ETH, ETH]);
+        const start = Date.now();
+        await Promise.all(Array.from({ length: 6 }, (_, i) => pool.submit(`swap-${i}`, this.transfer())));
+        const elapsed = Date.now() - start;
+
+        const perLane = new Set(chain.sent.map(tx => tx.from));
+        this.check('6 swaps spread over 3 lanes', perLane.size === 3);
+        this.check('lanes confirm in parallel', elapsed < 3 * chain.confirmDelayMs, `(${elapsed} ms)`);
+        this.check('per-lane nonces are sequential', [...perLane].every(address =>
+            chain.sent.filter(tx => tx.from === address).map(tx => tx.nonce).join() === '0,1'));
+    }
+
+    async testUnfundedLaneSkipped() {
+        const { chain, pool } = await this.pool([ETH, 0n]);
+        await Promise.all([0, 1, 2].map(i => pool.submit(null, this.transfer(), { value: ETH / 100n })));
+        this.check('unfunded lane never used', chain.sent.every(tx => tx.from === pool.lanes[0].address));
+
+        let rejected = false;
+        await pool.submit(null, this.transfer(), { value: 10n * ETH }).catch(() => { rejected = true; });
+        this.check('unfundable transaction rejected', rejected);
+    }
+
+    async testSwapAffinity() {
+        const { chain, pool } = await this.pool([ETH, ETH, ETH]);
+        await pool.submit('order-A', this.transfer());
+        await pool.submit('order-B', this.transfer());
+        await pool.submit('order-A', this.transfer());
+        const fromA = chain.sent.filter((_, i) => i !== 1).map(tx => tx.from);
+        this.check('follow-up transaction reuses swap lane', fromA[0] === fromA[1]);
+    }
+
+    async testAllowedLanes() {
+        const { chain, pool } = await this.pool([ETH, 2n * ETH, 2n * ETH]);
+        const owner = pool.lanes[0].address;
+        await pool.submit('order-C', this.transfer());
+        const stickyLane = chain.sent[0].from;
+        await Promise.all([0, 1, 2].map(() => pool.submit('order-C', this.transfer(), { allowed: [owner] })));
+        await pool.submit('order-C', this.transfer());
+        this.check('owner-only calls use the owner lane even when the swap is pinned elsewhere',
+            stickyLane !== owner && chain.sent.slice(1, 4).every(tx => tx.from === owner)
+            && chain.sent[4].from === stickyLane && pool.laneFor('order-C').address === stickyLane);
+
+        let rejected = null;
+        await pool.submit(null, this.transfer(), { allowed: ['0x' + '9'.repeat(40)] }).catch(error => { rejected = error.message; });
+        this.check('calls no pool lane may send are rejected, not queued', /No pool lane is allowed/.test(rejected || ''));
+    }
+
+    async testQueueWhenSaturated() {
+        const { chain, pool } = await this.pool([ETH], { maxInFlightPerLane: 1 });
+        await Promise.all([0, 1, 2].map(() => pool.submit(null, this.transfer())));
+        this.check('saturated lane queues instead of failing', chain.sent.length === 3 && pool.lanes[0].inFlight === 0);
+    }
+
+    async testFailedBroadcastKeepsNonce() {
+        const { chain, pool } = await this.pool([ETH]);
+        let reverted = false;
+        await pool.submit(null, async () => { throw new Error('execution reverted'); }).catch(() => { reverted = true; });
+        await pool.submit(null, this.transfer());
+        this.check('failed broadcast does not burn a nonce', reverted && chain.sent[0].nonce === 0);
+
+        chain.nonces.set(pool.lanes[0].address, 5); // another process used the key
+        await pool.submit(null, this.transfer()).catch(() => {});
+        await pool.submit(null, this.transfer());
+        this.check('nonce error resyncs the lane', chain.sent[chain.sent.length - 1].nonce === 5);
+    }
+
+    async testRebalance() {
+        const { chain, pool } = await this.pool([2n * ETH, ETH / 100n]);
+        const events = [];
+        pool.on('rebalance', event => events.push(event));
+        await pool.rebalance();
+        const poor = pool.lanes[1].address;
+        this.check('poor lane topped up from rich lane', events.length === 1 && chain.balances.get(poor) === ETH / 2n, `(${chain.balances.get(poor)})`);
+    }
+
+    async run() {
+        console.log('🧪 WALLET POOL EXECUTOR TEST');
+        console.log('============================');
+
+        await this.testSpreadsAcrossLanes();
+        await this.testUnfundedLaneSkipped();
+        await this.testSwapAffinity();
+        await this.testAllowedLanes();
+        await this.testQueueWhenSaturated();
+        await this.testFailedBroadcastKeepsNonce();
+        await this.testRebalance();
+
+        console.log('============================');
+        console.log(`📊 Passed: ${this.results.passed}  Failed: ${this.results.failed}`);
+        return this.results.failed === 0;
+    }
+}
+
+if (require.main === module) {
+    new WalletPoolExecutorTester().run().then(ok => process.exit(ok ? 0 : 1));
+}
+
+module.exports = { WalletPoolExecutorTester };
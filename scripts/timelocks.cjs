@@ -0,0 +1,178 @@
+#!/usr/bin/env node
+
+/**
+ * ⏳ PACKED TIMELOCKS DECODER + STAGE SCHEDULER
+ *
+ * Relayer-side twin of TimelocksLib / contracts/BridgeTimelocksLib.sol:
+ * ✅ Decodes the one-word Timelocks (deployedAt in the top 32 bits, stage offsets as uint32)
+ * ✅ Same stage math as TimelocksLib.get / rescueStart, with BigInt
+ * ✅ TimelockScheduler: one timer per order for its next stage, re-armed stage by stage
+ *    (replaces polling every order for expiry)
+ *
+ * Stages follow TimelocksLib.Stage; the custom bridges use the four source stages
+ * (withdrawal, publicWithdrawal, cancellation, publicCancellation).
+ */
+
+const { EventEmitter } = require('events');
+
+const STAGES = [
+    'srcWithdrawal',
+    'srcPublicWithdrawal',
+    'srcCancellation',
+    'srcPublicCancellation',
+    'dstWithdrawal',
+    'dstPublicWithdrawal',
+    'dstCancellation'
+];
+const SRC_STAGES = STAGES.slice(0, 4);
+const UINT32 = 0xffffffffn;
+const MAX_TIMER_MS = 2 ** 31 - 1; // setTimeout limit (~24.8 days)
+
+const toBigInt = (value) => typeof value === 'bigint' ? value : BigInt(value);
+
+class Timelocks {
+    constructor(word) {
+        this.word = toBigInt(word);
+    }
+
+    /**
+     * BridgeTimelocksLib.pack: source stage offsets in seconds after deployedAt
+     */
+    static pack(deployedAt, { withdrawal = 0, publicWithdrawal, cancellation, publicCancellation }) {
+        const offsets = [withdrawal, publicWithdrawal, cancellation, publicCancellation].map(toBigInt);
+        for (let i = 1; i < offsets.length; i++) {
+            if (offsets[i] < offsets[i - 1]) throw new Error('Timelocks out of order');
+        }
+        if (offsets[3] > UINT32) throw new Error('Timelock too long');
+        const word = offsets.reduce((acc, offset, i) => acc | offset << BigInt(32 * i), 0n);
+        return new Timelocks(word | toBigInt(deployedAt) << 224n);
+    }
+
+    /**
+     * BridgeTimelocksLib.untilExpiry: withdraw until expiry, refund afterwards
+     */
+    static untilExpiry(deployedAt, expiry) {
+        const offset = toBigInt(expiry) - toBigInt(deployedAt);
+        if (offset <= 0n) throw new Error('Expiry in the past');
+        return Timelocks.pack(deployedAt, { withdrawal: 0n, publicWithdrawal: offset, cancellation: offset, publicCancellation: offset });
+    }
+
+    get deployedAt() {
+        return this.word >> 224n;
+    }
+
+    offset(stage) {
+        const index = typeof stage === 'number' ? stage : STAGES.indexOf(stage);
+        if (index < 0 || index >= STAGES.length) throw new Error(`Unknown stage: ${stage}`);
+        return (this.word >> BigInt(32 * index)) & UINT32;
+    }
+
+    /** TimelocksLib.get: absolute start of a stage */
+    get(stage) {
+        return this.deployedAt + this.offset(stage);
+    }
+
+    rescueStart(rescueDelay) {
+        return toBigInt(rescueDelay) + this.deployedAt;
+    }
+
+    /** BridgeTimelocksLib.srcStagesStarted */
+    srcStagesStarted(timestamp) {
+        const t = toBigInt(timestamp);
+        let started = 0;
+        while (started < SRC_STAGES.length && t >= this.get(started)) started++;
+        return started;
+    }
+
+    /** Name of the latest source stage that has started, or 'created' */
+    stageAt(timestamp) {
+        const started = this.srcStagesStarted(timestamp);
+        return started === 0 ? 'created' : SRC_STAGES[started - 1];
+    }
+
+    /** Next source stage strictly after `timestamp`, or null */
+    nextStage(timestamp) {
+        const t = toBigInt(timestamp);
+        for (const stage of SRC_STAGES) {
+            const at = this.get(stage);
+            if (at > t) return { stage, at };
+        }
+        return null;
+    }
+
+    toJSON() {
+        const json = { word: '0x' + this.word.toString(16).padStart(64, '0'), deployedAt: Number(this.deployedAt) };
+        for (const stage of SRC_STAGES) json[stage] = Number(this.get(stage));
+        return json;
+    }
+}
+
+class TimelockScheduler extends EventEmitter {
+    /**
+     * @param {object} options { now: () => chain seconds, stages: stage names to announce }
+     * Emits 'stage' { key, stage, at, timelocks } once per tracked stage, in order.
+     */
+    constructor(options = {}) {
+        super();
+        this.now = options.now || (() => Math.floor(Date.now() / 1000));
+        this.stages = options.stages || SRC_STAGES;
+        this.tracked = new Map(); // key -> { timelocks, timer, fired: Set }
+    }
+
+    track(key, word) {
+        this.untrack(key);
+        const timelocks = word instanceof Timelocks ? word : new Timelocks(word);
+        const entry = { timelocks, timer: null, fired: new Set() };
+        this.tracked.set(key, entry);
+        this.arm(key, entry);
+        return timelocks;
+    }
+
+    arm(key, entry) {
+        const now = BigInt(this.now());
+        // Stages already started fire immediately, in order
+        for (const stage of this.stages) {
+            if (entry.fired.has(stage)) continue;
+            const at = entry.timelocks.get(stage);
+            if (at > now) {
+                const delayMs = Math.min(Number(at - now) * 1000, MAX_TIMER_MS);
+                entry.timer = setTimeout(() => this.arm(key, entry), delayMs);
+                return;
+            }
+            entry.fired.add(stage);
+            this.emit('stage', { key, stage, at: Number(at), timelocks: entry.timelocks });
+            if (this.tracked.get(key) !== entry) return; // untracked by a listener
+        }
+        this.tracked.delete(key);
+    }
+
+    untrack(key) {
+        const entry = this.tracked.get(key);
+        if (entry) {
+            clearTimeout(entry.timer);
+            this.tracked.delete(key);
+        }
+        return Boolean(entry);
+    }
+
+    stop() {
+        for (const key of [...this.tracked.keys()]) this.untrack(key);
+    }
+
+    pending() {
+        const now = this.now();
+        return [...this.tracked.entries()].map(([key, { timelocks }]) => ({ key, next: timelocks.nextStage(now) }));
+    }
+}
+
+if (require.main === module) {
+    const word = process.argv[2];
+    const timelocks = word ? new Timelocks(word) : Timelocks.untilExpiry(1_700_000_000, 1_700_086_400);
+    console.log('⏳ TIMELOCKS');
+    console.log('============');
+    for (const [name, value] of Object.entries(timelocks.toJSON())) {
+        console.log(`   ${name}: ${value}`);
+    }
+}
+
+module.exports = { Timelocks, TimelockScheduler, STAGES, SRC_STAGES };
@@ -0,0 +1,351 @@
+#!/usr/bin/env node
+
+/**
+ * 🛤️ WALLET POOL EXECUTOR
+ *
+ * Spreads relayer transactions across every funded resolver key so on-chain
+ * throughput is not capped by a single nonce sequence:
+ * ✅ One lane per wallet with a local nonce counter (broadcasts serialized per lane)
+ * ✅ Lane choice by in-flight count, then by uncommitted balance
+ * ✅ Sticky lanes per swap (bid → execute must come from the same resolver)
+ * ✅ `allowed` pins calls to specific lanes (e.g. onlyOwner calls to the owner key)
+ * ✅ Background rebalancing from rich lanes to lanes below the floor
+ *
+ * Keys come from resolver-wallets-with-keys.json (generateResolverWalletsWithKeys.cjs)
+ * or RESOLVER_<n>_PRIVATE_KEY, plus the relayer's own wallet as the first lane.
+ */
+
+const { EventEmitter } = require('events');
+const fs = require('fs');
+const path = require('path');
+
+const DEFAULT_WALLETS_FILE = path.join(__dirname, '..', 'resolver-wallets-with-keys.json');
+const WEI_PER_ETH = 10n ** 18n;
+
+const ethToWei = (eth) => BigInt(Math.round(parseFloat(eth) * 1e9)) * (WEI_PER_ETH / 1000000000n);
+
+function isNonceError(error) {
+    const text = `${error && error.code} ${error && error.message}`.toLowerCase();
+    return text.includes('nonce') || text.includes('replacement');
+}
+
+class Lane {
+    constructor(signer, name) {
+        this.signer = signer;
+        this.address = signer.address;
+        this.name = name || signer.address;
+        this.nonce = null;
+        this.balance = 0n;
+        this.reserved = 0n;        // value + max gas of transactions not yet confirmed
+        this.inFlight = 0;
+        this.sent = 0;
+        this.failed = 0;
+        this.broadcast = Promise.resolve(); // serializes nonce assignment + broadcast
+    }
+
+    get available() {
+        return this.balance - this.reserved;
+    }
+}
+
+class WalletPoolExecutor extends EventEmitter {
+    /**
+     * @param {object} provider  ethers provider (getBalance, getTransactionCount, getFeeData)
+     * @param {Array}  signers   [{ signer, name }] or bare signers
+     * @param {object} options
+     */
+    constructor(provider, signers, options = {}) {
+        super();
+        this.provider = provider;
+        this.lanes = signers.map(entry => entry.signer ? new Lane(entry.signer, entry.name) : new Lane(entry));
+        if (this.lanes.length === 0) throw new Error('Wallet pool needs at least one signer');
+
+        this.maxInFlightPerLane = options.maxInFlightPerLane || parseInt(process.env.WALLET_POOL_MAX_IN_FLIGHT || '4');
+        this.minLaneBalance = options.minLaneBalance ?? ethToWei(process.env.WALLET_POOL_MIN_BALANCE_ETH || '0.05');
+        this.targetLaneBalance = options.targetLaneBalance ?? ethToWei(process.env.WALLET_POOL_TARGET_BALANCE_ETH || '0.2');
+        this.rebalanceIntervalMs = options.rebalanceIntervalMs || parseInt(process.env.WALLET_POOL_REBALANCE_MS || '60000');
+        this.confirmations = options.confirmations || 1;
+        this.stickyTtlMs = options.stickyTtlMs || 60 * 60 * 1000;
+        this.defaultGasLimit = options.defaultGasLimit || 300000n;
+
+        this.gasPrice = 0n;
+        this.sticky = new Map();   // swapKey -> { lane, touchedAt }
+        this.waiters = [];         // FIFO of callers waiting for a lane
+        this.rebalancing = new Set();
+        this.timer = null;
+    }
+
+    /** Relayer wallet first, then every resolver key found on disk / in env. */
+    static loadSigners(provider, Wallet, options = {}) {
+        const signers = [];
+        const seen = new Set();
+        const add = (privateKey, name) => {
+            const signer = new Wallet(privateKey, provider);
+            if (seen.has(signer.address.toLowerCase())) return;
+            seen.add(signer.address.toLowerCase());
+            signers.push({ signer, name });
+        };
+
+        if (options.primaryKey) add(options.primaryKey, 'relayer');
+
+        const file = options.file || process.env.RESOLVER_WALLETS_FILE || DEFAULT_WALLETS_FILE;
+        if (fs.existsSync(file)) {
+            const data = JSON.parse(fs.readFileSync(file, 'utf8'));
+            for (const resolver of data.resolvers || []) {
+                if (resolver.privateKey) add(resolver.privateKey, resolver.name);
+            }
+        }
+
+        let index = 1;
+        while (process.env[`RESOLVER_${index}_PRIVATE_KEY`]) {
+            add(process.env[`RESOLVER_${index}_PRIVATE_KEY`], process.env[`RESOLVER_${index}_NAME`]);
+            index++;
+        }
+        return signers;
+    }
+
+    // 🔄 Lane state
+
+    async init() {
+        await this.refreshGasPrice();
+        await Promise.all(this.lanes.map(lane => this.syncLane(lane)));
+        return this;
+    }
+
+    async syncLane(lane) {
+        const [balance, nonce] = await Promise.all([
+            this.provider.getBalance(lane.address),
+            this.provider.getTransactionCount(lane.address, 'pending')
+        ]);
+        lane.balance = BigInt(balance);
+        // Never move the local counter backwards while our own broadcasts are still propagating
+        if (lane.nonce === null || lane.inFlight === 0 || nonce > lane.nonce) lane.nonce = nonce;
+    }
+
+    async refreshGasPrice() {
+        const feeData = await this.provider.getFeeData();
+        this.gasPrice = BigInt(feeData.maxFeePerGas || feeData.gasPrice || 0n);
+    }
+
+    start() {
+        if (this.timer) return this;
+        this.timer = setInterval(() => this.rebalance().catch(error => this.emit('error', error)), this.rebalanceIntervalMs);
+        if (this.timer.unref) this.timer.unref();
+        return this;
+    }
+
+    stop() {
+        clearInterval(this.timer);
+        this.timer = null;
+    }
+
+    hasAddress(address) {
+        return this.lanes.some(lane => lane.address.toLowerCase() === String(address).toLowerCase());
+    }
+
+    laneFor(swapKey) {
+        const entry = this.sticky.get(swapKey);
+        return entry ? entry.lane : null;
+    }
+
+    /** Drop a swap's lane affinity once the swap is finished. */
+    endSwap(swapKey) {
+        this.sticky.delete(swapKey);
+    }
+
+    // 🎯 Lane selection
+
+    pickLane(cost, allowed) {
+        let best = null;
+        for (const lane of this.lanes) {
+            if (lane.inFlight >= this.maxInFlightPerLane || lane.available < cost) continue;
+            if (allowed && !allowed.has(lane.address.toLowerCase())) continue;
+            if (!best || lane.inFlight < best.inFlight || (lane.inFlight === best.inFlight && lane.available > best.available)) {
+                best = lane;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * Claims a slot synchronously so concurrent callers see each other's reservations.
+     * A swap's sticky lane is only used when `allowed` permits it (owner-only calls
+     * go out from the owner lane without moving the swap's affinity).
+     */
+    tryAcquire(swapKey, cost, allowed) {
+        const entry = swapKey && this.sticky.get(swapKey);
+        const sticky = entry && (!allowed || allowed.has(entry.lane.address.toLowerCase())) ? entry : null;
+        let lane;
+        if (sticky) {
+            if (sticky.lane.inFlight >= this.maxInFlightPerLane) return null;
+            sticky.touchedAt = Date.now();
+            lane = sticky.lane;
+        } else {
+            lane = this.pickLane(cost, allowed);
+            if (!lane) return null;
+            if (swapKey && !entry) this.sticky.set(swapKey, { lane, touchedAt: Date.now() });
+        }
+        lane.inFlight++;
+        lane.reserved += cost;
+        return lane;
+    }
+
+    acquire(swapKey, cost, allowed) {
+        const lane = this.tryAcquire(swapKey, cost, allowed);
+        if (lane) return Promise.resolve(lane);
+
+        const isAllowed = (candidate) => !allowed || allowed.has(candidate.address.toLowerCase());
+        const sticky = this.laneFor(swapKey);
+        const canEverFit = (sticky && isAllowed(sticky)) || this.lanes.some(candidate => isAllowed(candidate) && candidate.balance >= cost);
+        if (!canEverFit) {
+            const reason = allowed && !this.lanes.some(isAllowed) ? 'No pool lane is allowed to send this call' : `No pool lane can fund ${cost} wei`;
+            return Promise.reject(new Error(reason));
+        }
+
+        return new Promise(resolve => this.waiters.push({ swapKey, cost, allowed, resolve }));
+    }
+
+    release(lane, cost) {
+        lane.inFlight--;
+        lane.reserved -= cost;
+
+        // Wake waiters in order; skip (but keep) those that still do not fit
+        const pending = this.waiters;
+        this.waiters = [];
+        for (const waiter of pending) {
+            const next = this.tryAcquire(waiter.swapKey, waiter.cost, waiter.allowed);
+            if (next) {
+                waiter.resolve(next);
+            } else {
+                this.waiters.push(waiter);
+            }
+        }
+    }
+
+    // 🚀 Submission
+
+    /**
+     * Run `send(signer, overrides)` on a pool lane and wait for the receipt.
+     * `send` must pass `overrides` (carries the lane nonce) into the contract call.
+     *
+     * @param {string}   swapKey   affinity key (orderId/orderHash); null for no affinity
+     * @param {Function} send      async (signer, overrides) => TransactionResponse
+     * @param {object}   options   { value, gasLimit, allowed: [addresses] }
+     */
+    async submit(swapKey, send, options = {}) {
+        const value = BigInt(options.value || 0n);
+        const gasLimit = BigInt(options.gasLimit || this.defaultGasLimit);
+        const cost = value + gasLimit * this.gasPrice;
+        const allowed = options.allowed ? new Set(options.allowed.map(address => address.toLowerCase())) : null;
+
+        const lane = await this.acquire(swapKey, cost, allowed);
+
+        try {
+            // Nonce is only consumed once the node has accepted the transaction
+            const broadcast = lane.broadcast.then(async () => {
+                const tx = await send(lane.signer, { nonce: lane.nonce, gasLimit });
+                lane.nonce++;
+                return tx;
+            });
+            lane.broadcast = broadcast.catch(() => {});
+
+            let tx;
+            try {
+                tx = await broadcast;
+            } catch (error) {
+                if (isNonceError(error)) await this.syncLane(lane);
+                throw error;
+            }
+            lane.sent++;
+            this.emit('submitted', { swapKey, lane: lane.address, hash: tx.hash });
+
+            const receipt = await tx.wait(this.confirmations);
+            const spent = BigInt(receipt.gasUsed || 0n) * BigInt(receipt.gasPrice || receipt.effectiveGasPrice || this.gasPrice);
+            lane.balance -= spent + value;
+            this.emit('confirmed', { swapKey, lane: lane.address, hash: tx.hash, blockNumber: receipt.blockNumber });
+            return { lane: lane.address, tx, receipt };
+        } catch (error) {
+            lane.failed++;
+            this.emit('failed', { swapKey, lane: lane.address, error });
+            throw error;
+        } finally {
+            this.release(lane, cost);
+        }
+    }
+
+    // ⚖️ Rebalancing
+
+    /**
+     * Top up lanes below `minLaneBalance` to `targetLaneBalance` from the lane
+     * with the most uncommitted balance above target.
+     */
+    async rebalance() {
+        await this.refreshGasPrice();
+        await Promise.all(this.lanes.map(lane => this.syncLane(lane)));
+
+        const now = Date.now();
+        for (const [swapKey, entry] of this.sticky) {
+            if (now - entry.touchedAt > this.stickyTtlMs && entry.lane.inFlight === 0) this.sticky.delete(swapKey);
+        }
+
+        const transferGas = 21000n * this.gasPrice;
+        const transfers = [];
+        for (const lane of this.lanes) {
+            if (lane.balance >= this.minLaneBalance || this.rebalancing.has(lane.address)) continue;
+
+            const amount = this.targetLaneBalance - lane.balance;
+            const donor = this.lanes
+                .filter(candidate => candidate !== lane && candidate.available - amount - transferGas >= this.targetLaneBalance)
+                .sort((a, b) => (b.available > a.available ? 1 : b.available < a.available ? -1 : 0))[0];
+            if (!donor) continue;
+
+            this.rebalancing.add(lane.address);
+            this.emit('rebalance', { from: donor.address, to: lane.address, amount });
+            transfers.push(this.submit(null, (signer, overrides) => signer.sendTransaction({ to: lane.address, value: amount, ...overrides }), {
+                value: amount,
+                gasLimit: 21000n,
+                allowed: [donor.address]
+            }).then(() => {
+                lane.balance += amount;
+            }).finally(() => {
+                this.rebalancing.delete(lane.address);
+            }));
+        }
+        await Promise.allSettled(transfers);
+    }
+
+    stats() {
+        return this.lanes.map(lane => ({
+            name: lane.name,
+            address: lane.address,
+            balance: lane.balance.toString(),
+            available: lane.available.toString(),
+            inFlight: lane.inFlight,
+            nonce: lane.nonce,
+            sent: lane.sent,
+            failed: lane.failed
+        }));
+    }
+}
+
+if (require.main === module) {
+    (async () => {
+        const { ethers } = require('ethers');
+        require('dotenv').config();
+
+        const provider = new ethers.JsonRpcProvider(process.env.SEPOLIA_URL || `https://sepolia.infura.io/v3/${process.env.INFURA_PROJECT_ID}`);
+        const signers = WalletPoolExecutor.loadSigners(provider, ethers.Wallet, { primaryKey: process.env.PRIVATE_KEY });
+        const pool = await new WalletPoolExecutor(provider, signers).init();
+
+        console.log('🛤️ WALLET POOL LANES');
+        console.log('====================');
+        for (const lane of pool.stats()) {
+            console.log(`   ${lane.name}: ${ethers.formatEther(lane.balance)} ETH (nonce ${lane.nonce})`);
+        }
+    })().catch(error => {
+        console.error('❌ Wallet pool check failed:', error.message);
+        process.exit(1);
+    });
+}
+
+module.exports = { WalletPoolExecutor, Lane, isNonceError };
@@ -139,7 +139,8 @@ class CompleteCrossChainRelayer {
             'function createCrossChainHTLC(bytes32 hashlock, uint256 timelock, address token, uint256 amount, address recipient, string calldata algorandAddress) external payable returns (bytes32)',
             'function createEscrowContracts(bytes32 orderHash, bytes calldata resolverCalldata) external returns (address escrowSrc, address escrowDst)',
             'function executeCrossChainSwap(bytes32 orderHash, bytes32 secret) external',
-            'function getCrossChainOrder(bytes32 orderHash) external view returns (address maker, address token, uint256 amount, address recipient, bytes32 hashlock, uint256 timelock, bool executed, bool refunded, address escrowSrc, address escrowDst)',
+            'function getCrossChainOrder(bytes32 orderHash) external view returns (tuple(bytes32 orderHash, bytes32 hashlock, uint256 timelocks, address token, uint256 amount, address recipient, string algorandAddress, address escrowSrc, address escrowDst, bool executed, bool refunded, address maker))',
+            'function getExpiry(bytes32 orderHash) external view returns (uint256)',
             'function getRevealedSecret(bytes32 orderHash) external view returns (bytes32)',
             'event CrossChainOrderCreated(bytes32 indexed orderHash, address indexed maker, address token, uint256 amount, bytes32 hashlock, uint256 timelock, string algorandAddress)',
             'event SecretRevealed(bytes32 indexed orderHash, bytes32 secret)',
@@ -666,11 +667,11 @@ class CompleteCrossChainRelayer {
             for (const [orderHash, mapping] of this.localDB.orderMappings) {
                 if (mapping.status === 'ORDER_CREATED' || mapping.status === 'ESCROW_CREATED') {
                     // Get order details
-                    const order = await this.resolver.getCrossChainOrder(orderHash);
+                    const expiry = await this.resolver.getExpiry(orderHash);
                     
-                    if (currentTime > order.timelock) {
+                    if (currentTime > expiry) {
                         console.log(`⏰ ORDER EXPIRED: ${orderHash}`);
-                        console.log(`   Timelock: ${order.timelock}`);
+                        console.log(`   Timelock: ${expiry}`);
                         console.log(`   Current Time: ${currentTime}`);
                         
                         // Process refund
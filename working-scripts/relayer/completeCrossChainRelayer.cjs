@@ -20,6 +20,7 @@
  * - Competitive bidding system
  * - Local DB for orderHash ↔ htlc_id mappings
  * - Cryptographic secret validation
+ * - Optional stateless logic-signature HTLCs on Algorand (ALGORAND_HTLC_MODE=logicsig)
  * - Online and funded on both chains
  */
 
@@ -27,6 +28,16 @@ const { ethers } = require('ethers');
 const algosdk = require('algosdk');
 const crypto = require('crypto');
 const fs = require('fs');
+const { WalletPoolExecutor } = require('../../scripts/walletPoolExecutor.cjs');
+const { getLogger } = require('../../scripts/relayerLogger.cjs');
+const { Timelocks, TimelockScheduler } = require('../../scripts/timelocks.cjs');
+const { BridgeOrderLensClient, LENS_ABI } = require('../../scripts/bridgeOrderLens.cjs');
+const { SecretStore } = require('../../scripts/secretStore.cjs');
+const { decodeTransactionEvents } = require('../../scripts/htlcEvents.cjs');
+const { LogicSigHTLCClient, classifyLogicSigSpend, paymentFields } = require('../../scripts/algorandLogicSigHTLC.cjs');
+
+// Hot-loop output goes through the structured logger (LOG_LEVEL / LOG_FORMAT / LOG_FILE)
+const log = getLogger('complete-relayer');
 
 class CompleteCrossChainRelayer {
     constructor() {
@@ -75,12 +86,15 @@ class CompleteCrossChainRelayer {
                 resolverAddress: '0x7404763a3ADf2711104BD47b331EC3D7eC82Cb64',
                 escrowFactoryAddress: '0x523258A91028793817F84aB037A3372B468ee940', // Official 1inch EscrowFactory
                 limitOrderBridgeAddress: '0x384B0011f6E6aA8C192294F36dCE09a3758Df788', // EnhancedLimitOrderBridge
+                orderLensAddress: process.env.BRIDGE_ORDER_LENS_ADDRESS, // Optional BridgeOrderLens for batched reads
                 relayerAddress: ethRelayerAddress, // CORRECTED: From .env.relayer
-                relayerPrivateKey: ethRelayerPrivateKey // CORRECTED: From .env.relayer
+                relayerPrivateKey: ethRelayerPrivateKey, // CORRECTED: From .env.relayer
+                resolverOwner: process.env.RESOLVER_OWNER_ADDRESS || ethRelayerAddress // deployer of CrossChainHTLCResolver (onlyOwner calls)
             },
             algorand: {
                 rpcUrl: 'https://testnet-api.algonode.cloud',
                 appId: 743645803, // HTLC contract
+                htlcMode: process.env.ALGORAND_HTLC_MODE === 'logicsig' ? 'logicsig' : 'app', // mirrored HTLCs: app call or per-swap logic signature
                 relayerAddress: algoRelayerAddress, // CORRECTED: From .env.relayer
                 relayerMnemonic: algoRelayerMnemonic // CORRECTED: From .env.relayer
             },
@@ -102,6 +116,16 @@ class CompleteCrossChainRelayer {
         this.ethWallet = new ethers.Wallet(this.config.ethereum.relayerPrivateKey, this.ethProvider);
         this.algoClient = new algosdk.Algodv2('', this.config.algorand.rpcUrl, 443);
         this.algoAccount = algosdk.mnemonicToSecretKey(this.config.algorand.relayerMnemonic);
+        this.logicSigHTLC = new LogicSigHTLCClient(this.algoClient, this.algoAccount);
+        
+        // Ethereum writes go through a lane per funded resolver key (relayer wallet is lane 0)
+        this.walletPool = new WalletPoolExecutor(
+            this.ethProvider,
+            WalletPoolExecutor.loadSigners(this.ethProvider, ethers.Wallet, { primaryKey: this.config.ethereum.relayerPrivateKey })
+        );
+        await this.walletPool.init();
+        this.walletPool.start();
+        this.authorizedLanes = { addresses: [], checkedAt: 0 };
         
         // Initialize contracts
         await this.loadContracts();
@@ -114,11 +138,13 @@ class CompleteCrossChainRelayer {
         
         console.log('✅ Complete Cross-Chain Relayer Initialized');
         console.log(`📱 Ethereum Relayer: ${this.ethWallet.address}`);
+        console.log(`🛤️ Wallet Pool Lanes: ${this.walletPool.lanes.length}`);
         console.log(`📱 Algorand Relayer: ${this.algoAccount.addr}`);
         console.log(`🏦 Resolver: ${this.config.ethereum.resolverAddress}`);
         console.log(`🏦 EscrowFactory: ${this.config.ethereum.escrowFactoryAddress}`);
         console.log(`🏦 LimitOrderBridge: ${this.config.ethereum.limitOrderBridgeAddress}`);
         console.log(`🏦 Algorand App: ${this.config.algorand.appId}`);
+        console.log(`🔏 Algorand HTLC Mode: ${this.config.algorand.htlcMode}`);
     }
     
     async loadContracts() {
@@ -126,10 +152,12 @@ class CompleteCrossChainRelayer {
         const resolverABI = [
             'function createCrossChainHTLC(bytes32 hashlock, uint256 timelock, address token, uint256 amount, address recipient, string calldata algorandAddress) external payable returns (bytes32)',
             'function createEscrowContracts(bytes32 orderHash, bytes calldata resolverCalldata) external returns (address escrowSrc, address escrowDst)',
+            'function createCrossChainHTLCWithEscrow(bytes32 hashlock, uint256 timelock, address token, uint256 amount, address recipient, string calldata algorandAddress, bytes calldata resolverCalldata) external payable returns (bytes32 orderHash, address escrowSrc, address escrowDst)',
             'function executeCrossChainSwap(bytes32 orderHash, bytes32 secret) external',
-            'function getCrossChainOrder(bytes32 orderHash) external view returns (address maker, address token, uint256 amount, address recipient, bytes32 hashlock, uint256 timelock, bool executed, bool refunded, address escrowSrc, address escrowDst)',
+            'function getCrossChainOrder(bytes32 orderHash) external view returns (tuple(bytes32 orderHash, bytes32 hashlock, uint256 timelocks, address token, uint256 amount, address recipient, string algorandAddress, address escrowSrc, address escrowDst, bool executed, bool refunded, address maker))',
             'function getRevealedSecret(bytes32 orderHash) external view returns (bytes32)',
             'event CrossChainOrderCreated(bytes32 indexed orderHash, address indexed maker, address token, uint256 amount, bytes32 hashlock, uint256 timelock, string algorandAddress)',
+            'event EscrowCreated(bytes32 indexed orderHash, address indexed escrowSrc, address indexed escrowDst, address token, uint256 amount)',
             'event SecretRevealed(bytes32 indexed orderHash, bytes32 secret)',
             'event SwapCommitted(bytes32 indexed orderHash, bytes32 hashlock, bytes32 secret, address recipient)'
         ];
@@ -172,6 +200,13 @@ class CompleteCrossChainRelayer {
             this.ethWallet
         );
         
+        this.orderLens = this.config.ethereum.orderLensAddress
+            ? new BridgeOrderLensClient(new ethers.Contract(this.config.ethereum.orderLensAddress, LENS_ABI, this.ethProvider))
+            : null;
+        
+        // Relayer copy of revealed secrets; the resolver may run in event-only mode
+        this.secretStore = new SecretStore({ persistPath: 'relayer-secrets.json' });
+        
         console.log('✅ Smart contracts loaded');
     }
 
@@ -201,6 +236,7 @@ class CompleteCrossChainRelayer {
         this.localDB = {
             orderMappings: new Map(), // orderHash -> { htlcId, direction, status }
             htlcMappings: new Map(),  // htlcId -> { orderHash, direction, status }
+            logicSigEscrows: new Map(), // mirrored logic-signature escrow address -> orderHash
             pendingSwaps: new Map(),  // orderHash -> swap data
             completedSwaps: new Map() // orderHash -> completed swap data
         };
@@ -219,6 +255,7 @@ class CompleteCrossChainRelayer {
                 this.localDB.htlcMappings = new Map(data.htlcMappings || []);
                 this.localDB.pendingSwaps = new Map(data.pendingSwaps || []);
                 this.localDB.completedSwaps = new Map(data.completedSwaps || []);
+                this.indexMirroredLogicSigEscrows();
                 console.log('✅ Database loaded from file');
             }
         } catch (error) {
@@ -226,6 +263,16 @@ class CompleteCrossChainRelayer {
         }
     }
     
+    /**
+     * Escrows we funded for ETH → ALGO orders live only in orderMappings; the watcher finds them by address
+     */
+    indexMirroredLogicSigEscrows() {
+        this.localDB.logicSigEscrows = new Map();
+        for (const [orderHash, mapping] of this.localDB.orderMappings) {
+            if (mapping.direction === 'ETH_TO_ALGO' && mapping.logicSig) this.localDB.logicSigEscrows.set(mapping.htlcId, orderHash);
+        }
+    }
+    
     saveDBToFile() {
         try {
             const data = {
@@ -267,6 +314,8 @@ class CompleteCrossChainRelayer {
             const status = await this.algoClient.status().do();
             const currentRound = status['last-round'];
             
+            log.sampled('algo-poll', 60000).debug('Algorand poll', { fromRound: currentRound - 50, toRound: currentRound });
+            
             // Check recent rounds for application calls
             for (let round = currentRound - 50; round <= currentRound; round++) {
                 const block = await this.algoClient.block(round).do();
@@ -277,31 +326,31 @@ class CompleteCrossChainRelayer {
                             txn['application-transaction']['application-id'] === this.config.algorand.appId) {
                             
                             await this.processAlgorandTransaction(txn, round);
+                        } else if (txn['payment-transaction']) {
+                            await this.processLogicSigPayment(txn, round);
                         }
                     }
                 }
             }
+            
+            await this.refundExpiredLogicSigHTLCs(currentRound);
         } catch (error) {
-            console.error('❌ Error checking Algorand events:', error.message);
+            log.sampled('algo-poll-error', 30000).error('Algorand poll failed', { error: error.message });
         }
     }
     
     async processAlgorandTransaction(txn, round) {
         try {
-            const appTxn = txn['application-transaction'];
-            const appArgs = appTxn['application-args'];
-            
-            if (appArgs && appArgs.length > 0) {
-                const action = Buffer.from(appArgs[0], 'base64').toString('utf8');
-                
-                if (action === 'create_htlc') {
-                    console.log(`🔔 ALGORAND HTLC CREATED: ${txn.id}`);
+            // Only the app's ARC-28 logs are read: they exist only for successful calls
+            for (const event of decodeTransactionEvents(txn)) {
+                if (event.name === 'HTLCCreated') {
+                    if (this.localDB.htlcMappings.has(event.htlcKey)) continue; // seen in an earlier poll
+                    log.info('Algorand HTLC created', { htlcId: event.htlcKey, txId: txn.id, round });
                     
-                    // Extract HTLC parameters
-                    const htlcData = await this.extractAlgorandHTLCDetails(txn, appArgs);
+                    const htlcData = this.extractAlgorandHTLCDetails(txn, event, round);
                     
                     // Store in local DB
-                    this.localDB.htlcMappings.set(txn.id, {
+                    this.localDB.htlcMappings.set(event.htlcKey, {
                         orderHash: null, // Will be set when Ethereum order is created
                         direction: 'ALGO_TO_ETH',
                         status: 'CREATED',
@@ -311,36 +360,128 @@ class CompleteCrossChainRelayer {
                     });
                     
                     // Trigger Ethereum swap commitment
-                    await this.commitSwapOnEthereum(htlcData, txn.id);
+                    await this.commitSwapOnEthereum(htlcData, event.htlcKey);
+                } else {
+                    this.applyAlgorandHTLCEvent(event, txn, round);
+                }
+            }
+        } catch (error) {
+            log.error('Algorand transaction processing failed', { txId: txn.id, round, error: error.message });
+        }
+    }
+    
+    /**
+     * Logic-signature HTLCs have no app and no logs: a funding payment is recognized by
+     * rebuilding the escrow from its note, a spend by its escrow sender
+     */
+    async processLogicSigPayment(txn, round) {
+        try {
+            const fields = paymentFields(txn);
+            const mirrored = this.localDB.logicSigEscrows.get(fields.sender);
+            if (mirrored) {
+                this.applyMirroredLogicSigSpend(mirrored, txn, round);
+                return;
+            }
+            
+            const known = this.localDB.htlcMappings.get(fields.sender);
+            if (known && known.logicSig) {
+                const spend = classifyLogicSigSpend(txn, known.logicSig);
+                if (spend) {
+                    this.applyAlgorandHTLCEvent(spend.type === 'claim'
+                        ? { name: 'HTLCClaimed', htlcKey: fields.sender, secret: spend.secret }
+                        : { name: 'HTLCRefunded', htlcKey: fields.sender }, txn, round);
                 }
+                return;
             }
+            
+            if (fields.sender === this.algoAccount.addr) return; // our own mirrored HTLCs
+            const funding = await this.logicSigHTLC.recognizeFunding(txn);
+            if (!funding || this.localDB.htlcMappings.has(funding.address)) return;
+            log.info('Algorand logic-signature HTLC funded', { htlcId: funding.address, txId: txn.id, round });
+            
+            const htlcData = {
+                htlcId: funding.address,
+                hashlock: funding.swap.hashlock,
+                amount: Number(funding.amount),
+                timeoutRound: funding.swap.timeoutRound,
+                recipient: funding.swap.recipient,
+                initiator: funding.swap.refundTo,
+                txId: txn.id,
+                round: round
+            };
+            this.localDB.htlcMappings.set(funding.address, {
+                orderHash: null,
+                direction: 'ALGO_TO_ETH',
+                status: 'CREATED',
+                data: htlcData,
+                logicSig: funding.swap,
+                createdAt: new Date().toISOString(),
+                round: round
+            });
+            
+            await this.commitSwapOnEthereum(htlcData, funding.address);
         } catch (error) {
-            console.error('❌ Error processing Algorand transaction:', error.message);
+            log.error('Algorand payment processing failed', { txId: txn.id, round, error: error.message });
         }
     }
     
-    async extractAlgorandHTLCDetails(txn, appArgs) {
-        // Extract parameters from application args
-        const hashlock = '0x' + Buffer.from(appArgs[1], 'base64').toString('hex');
-        const amount = algosdk.decodeUint64(Buffer.from(appArgs[2], 'base64'), 'safe');
-        const timelock = algosdk.decodeUint64(Buffer.from(appArgs[3], 'base64'), 'safe');
-        const recipient = Buffer.from(appArgs[4], 'base64').toString('utf8');
+    /**
+     * Spend of an escrow we mirrored: a recipient claim reveals the secret for the Ethereum side,
+     * and either spend closes the escrow so the refund sweep leaves it alone
+     */
+    applyMirroredLogicSigSpend(orderHash, txn, round) {
+        const mapping = this.localDB.orderMappings.get(orderHash);
+        if (!mapping || !mapping.logicSig) return;
+        const spend = classifyLogicSigSpend(txn, mapping.logicSig);
+        if (!spend) return;
         
+        if (spend.type === 'claim') {
+            this.secretStore.put(orderHash, spend.secret, { transactionHash: txn.id });
+            mapping.status = 'ALGO_CLAIMED';
+            mapping.claimTxId = txn.id;
+        } else {
+            mapping.status = 'ALGO_REFUNDED';
+            mapping.refundTxId = txn.id;
+        }
+        log.info(`Algorand logic-signature ${spend.type}`, { orderHash, htlcId: mapping.htlcId, txId: txn.id, round });
+        this.localDB.orderMappings.set(orderHash, mapping);
+    }
+    
+    extractAlgorandHTLCDetails(txn, event, round) {
         return {
-            htlcId: txn.id,
-            hashlock: hashlock,
-            amount: amount,
-            timelock: timelock,
-            recipient: recipient,
-            initiator: txn.sender,
-            round: txn['confirmed-round']
+            htlcId: event.htlcKey,
+            hashlock: event.hashlock,
+            amount: Number(event.amount),
+            timelock: Number(event.timelock),
+            recipient: event.recipient,
+            initiator: event.initiator,
+            txId: txn.id,
+            round: round
         };
     }
     
+    /**
+     * Claims, partial fills and refunds on Algorand: status, plus the secret a claim reveals
+     */
+    applyAlgorandHTLCEvent(event, txn, round) {
+        const mapping = this.localDB.htlcMappings.get(event.htlcKey);
+        if (!mapping) return;
+        
+        if (event.secret && mapping.orderHash) {
+            this.secretStore.put(mapping.orderHash, event.secret, { transactionHash: txn.id });
+        }
+        if (event.name === 'HTLCClaimed') mapping.status = 'ALGO_CLAIMED';
+        else if (event.name === 'HTLCRefunded') mapping.status = 'ALGO_REFUNDED';
+        else if (event.name === 'HTLCPartiallyFilled') mapping.remaining = Number(event.remaining);
+        
+        log.info(`Algorand ${event.name}`, { htlcId: event.htlcKey, txId: txn.id, round });
+        this.localDB.htlcMappings.set(event.htlcKey, mapping);
+    }
+    
     /**
      * 2. 🏗️ COMMIT SWAP ON ETHEREUM
-     * Call createCrossChainHTLC() on the resolver with same hashlock, amount, and timelock
-     * Use createEscrowContracts() to fund escrow on Ethereum via 1inch-compliant EscrowFactory
+     * Call createCrossChainHTLCWithEscrow() on the resolver with same hashlock, amount, and timelock
+     * The order is recorded and its escrow funded via the 1inch-compliant EscrowFactory in one transaction
      */
     async commitSwapOnEthereum(algoHTLCData, algoHTLCId) {
         console.log('\n🏗️ STEP 2: COMMITTING SWAP ON ETHEREUM');
@@ -365,60 +506,71 @@ class CompleteCrossChainRelayer {
             console.log(`   Timelock: ${timelock}`);
             console.log(`   Recipient: ${algoHTLCData.recipient}`);
             
-            // Create cross-chain HTLC order
-            const tx = await this.resolver.createCrossChainHTLC(
-                algoHTLCData.hashlock,
-                timelock,
-                ethers.ZeroAddress, // ETH
-                ethAmount,
-                this.config.ethereum.relayerAddress, // Relayer receives ETH
-                algoHTLCData.recipient, // Algorand recipient
-                { value: ethAmount }
+            // Resolver calldata for escrow creation (orderHash is only known on-chain)
+            const resolverCalldata = ethers.AbiCoder.defaultAbiCoder().encode(
+                ['bytes32', 'bytes32'],
+                [algoHTLCData.hashlock, '0x' + '0'.repeat(64)]
             );
             
-            console.log(`⏳ Transaction submitted: ${tx.hash}`);
-            
-            // Wait for confirmation
-            const receipt = await tx.wait();
+            // Create order + escrow in one transaction; createCrossChainHTLCWithEscrow is onlyOwner
+            const { tx, receipt, lane } = await this.walletPool.submit(algoHTLCId, (signer, overrides) =>
+                this.resolver.connect(signer).createCrossChainHTLCWithEscrow(
+                    algoHTLCData.hashlock,
+                    timelock,
+                    ethers.ZeroAddress, // ETH
+                    ethAmount,
+                    this.config.ethereum.relayerAddress, // Relayer receives ETH
+                    algoHTLCData.recipient, // Algorand recipient
+                    resolverCalldata,
+                    { value: ethAmount, ...overrides }
+                ), { value: ethAmount, allowed: this.getOwnerLanes() });
+            
+            console.log(`⏳ Transaction submitted: ${tx.hash} (lane ${lane})`);
             console.log(`✅ Transaction confirmed in block: ${receipt.blockNumber}`);
             
-            // Extract order hash from event
-            const event = receipt.logs.find(log => {
+            // Extract order hash and escrow addresses from the same receipt
+            const events = {};
+            for (const log of receipt.logs) {
                 try {
                     const parsed = this.resolver.interface.parseLog(log);
-                    return parsed.name === 'CrossChainOrderCreated';
+                    if (parsed) events[parsed.name] = parsed;
                 } catch {
-                    return false;
+                    // Not a resolver event (EscrowFactory logs etc.)
                 }
-            });
+            }
             
-            if (event) {
-                const parsed = this.resolver.interface.parseLog(event);
-                const orderHash = parsed.args.orderHash;
+            if (events.CrossChainOrderCreated) {
+                const orderHash = events.CrossChainOrderCreated.args.orderHash;
+                const escrow = events.EscrowCreated && events.EscrowCreated.args;
                 
                 console.log(`🎯 Order Hash: ${orderHash}`);
+                if (escrow) {
+                    console.log(`🏦 EscrowSrc: ${escrow.escrowSrc}`);
+                    console.log(`🏦 EscrowDst: ${escrow.escrowDst}`);
+                }
                 
-                // Store mapping
+                // Store mapping; logic-signature escrows are claimed with their template parameters
+                const algoMapping = this.localDB.htlcMappings.get(algoHTLCId);
                 this.localDB.orderMappings.set(orderHash, {
                     htlcId: algoHTLCId,
                     direction: 'ALGO_TO_ETH',
-                    status: 'ORDER_CREATED',
+                    status: escrow ? 'ESCROW_CREATED' : 'ORDER_CREATED',
                     algoData: algoHTLCData,
+                    logicSig: algoMapping ? algoMapping.logicSig : undefined,
                     ethOrderHash: orderHash,
+                    escrowSrc: escrow ? escrow.escrowSrc : undefined,
+                    escrowDst: escrow ? escrow.escrowDst : undefined,
                     createdAt: new Date().toISOString()
                 });
+                this.trackOrderTimelocks(orderHash);
                 
                 // Update Algorand mapping
-                const algoMapping = this.localDB.htlcMappings.get(algoHTLCId);
                 if (algoMapping) {
                     algoMapping.orderHash = orderHash;
                     algoMapping.status = 'ETH_ORDER_CREATED';
                     this.localDB.htlcMappings.set(algoHTLCId, algoMapping);
                 }
                 
-                // Create escrow contracts
-                await this.createEscrowContracts(orderHash);
-                
                 // Start monitoring for secret reveal
                 this.monitorSecretReveal(orderHash);
                 
@@ -432,6 +584,9 @@ class CompleteCrossChainRelayer {
         }
     }
     
+    /**
+     * Two-step fallback for orders created without escrows (e.g. by makers calling createCrossChainHTLC directly)
+     */
     async createEscrowContracts(orderHash) {
         console.log('\n🏦 CREATING ESCROW CONTRACTS');
         console.log('============================');
@@ -444,12 +599,12 @@ class CompleteCrossChainRelayer {
             );
             
             console.log('📤 Creating escrow contracts via 1inch EscrowFactory...');
-            const tx = await this.resolver.createEscrowContracts(orderHash, resolverCalldata);
+            // createEscrowContracts is onlyOwner: pin it to the owner lane
+            const { tx, receipt } = await this.walletPool.submit(orderHash, (signer, overrides) =>
+                this.resolver.connect(signer).createEscrowContracts(orderHash, resolverCalldata, overrides),
+                { allowed: this.getOwnerLanes() });
             
             console.log(`⏳ Escrow creation submitted: ${tx.hash}`);
-            
-            // Wait for confirmation
-            const receipt = await tx.wait();
             console.log(`✅ Escrow contracts created in block: ${receipt.blockNumber}`);
             
             // Get escrow addresses
@@ -486,6 +641,16 @@ class CompleteCrossChainRelayer {
         console.log('✅ Triggering Algorand claim');
         console.log('===================================\n');
         
+        // Revealed while we were offline: the secret store has it from the backfill
+        const knownSecret = this.secretStore.get(orderHash);
+        if (knownSecret) {
+            console.log(`🔑 SECRET ALREADY REVEALED FOR ${orderHash}`);
+            this.validateSecret(orderHash, knownSecret).then(isValid => {
+                if (isValid) return this.triggerClaimOnAlgorand(orderHash, knownSecret);
+            });
+            return;
+        }
+        
         // Listen for SecretRevealed event
         this.resolver.on('SecretRevealed', async (revealedOrderHash, secret, event) => {
             if (revealedOrderHash === orderHash) {
@@ -570,35 +735,14 @@ class CompleteCrossChainRelayer {
             const algoHTLCId = mapping.htlcId;
             console.log(`🎯 Claiming Algorand HTLC: ${algoHTLCId}`);
             
-            // Get suggested params
-            const suggestedParams = await this.algoClient.getTransactionParams().do();
-            
-            // Create claim transaction
-            const claimTxn = algosdk.makeApplicationCallTxnFromObject({
-                from: this.algoAccount.addr,
-                appIndex: this.config.algorand.appId,
-                onComplete: algosdk.OnApplicationComplete.NoOpOC,
-                appArgs: [
-                    new Uint8Array(Buffer.from('claim_htlc', 'utf8')),
-                    new Uint8Array(Buffer.from(secret.slice(2), 'hex')) // Remove '0x' prefix
-                ],
-                suggestedParams: suggestedParams
-            });
-            
-            // Sign and submit
-            console.log('💰 RELAYER PAYING ALGORAND CLAIM FEES...');
-            const signedClaim = claimTxn.signTxn(this.algoAccount.sk);
-            const { txId } = await this.algoClient.sendRawTransaction(signedClaim).do();
-            
-            console.log(`⏳ Claim transaction submitted: ${txId}`);
-            
-            // Wait for confirmation
-            console.log('⏳ Waiting for confirmation...');
-            const confirmedTxn = await algosdk.waitForConfirmation(this.algoClient, txId, 4);
+            // Logic-signature escrows pay their own close-out fee
+            const { txId, round } = mapping.logicSig
+                ? await this.logicSigHTLC.claim(mapping.logicSig, secret)
+                : await this.submitAlgorandAppClaim(secret);
             
             console.log('✅ ALGORAND HTLC CLAIMED SUCCESSFULLY!');
             console.log(`   Transaction ID: ${txId}`);
-            console.log(`   Confirmed in round: ${confirmedTxn['confirmed-round']}`);
+            console.log(`   Confirmed in round: ${round}`);
             console.log(`   Explorer: https://testnet.algoexplorer.io/tx/${txId}`);
             
             // Update mapping
@@ -615,6 +759,35 @@ class CompleteCrossChainRelayer {
         }
     }
     
+    async submitAlgorandAppClaim(secret) {
+        // Get suggested params
+        const suggestedParams = await this.algoClient.getTransactionParams().do();
+        
+        // Create claim transaction
+        const claimTxn = algosdk.makeApplicationCallTxnFromObject({
+            from: this.algoAccount.addr,
+            appIndex: this.config.algorand.appId,
+            onComplete: algosdk.OnApplicationComplete.NoOpOC,
+            appArgs: [
+                new Uint8Array(Buffer.from('claim_htlc', 'utf8')),
+                new Uint8Array(Buffer.from(secret.slice(2), 'hex')) // Remove '0x' prefix
+            ],
+            suggestedParams: suggestedParams
+        });
+        
+        // Sign and submit
+        console.log('💰 RELAYER PAYING ALGORAND CLAIM FEES...');
+        const signedClaim = claimTxn.signTxn(this.algoAccount.sk);
+        const { txId } = await this.algoClient.sendRawTransaction(signedClaim).do();
+        
+        console.log(`⏳ Claim transaction submitted: ${txId}`);
+        
+        // Wait for confirmation
+        console.log('⏳ Waiting for confirmation...');
+        const confirmedTxn = await algosdk.waitForConfirmation(this.algoClient, txId, 4);
+        return { txId, round: confirmedTxn['confirmed-round'] };
+    }
+    
     /**
      * 5. 🔄 HANDLE REFUNDS
      * If swap times out, check timelock and call timeoutRefund() on Ethereum or refundhtlc() on Algorand
@@ -627,35 +800,90 @@ class CompleteCrossChainRelayer {
         console.log('✅ Ensuring no funds are locked forever');
         console.log('============================\n');
         
-        // Check for expired orders
-        setInterval(async () => {
-            await this.checkExpiredOrders();
-        }, 60000); // Check every minute
+        // One timer per order, armed from its packed timelocks (no per-minute polling)
+        this.timelockScheduler = new TimelockScheduler({ stages: ['srcCancellation'] });
+        this.timelockScheduler.on('stage', async ({ key: orderHash, at }) => {
+            const mapping = this.localDB.orderMappings.get(orderHash);
+            if (!mapping || (mapping.status !== 'ORDER_CREATED' && mapping.status !== 'ESCROW_CREATED')) return;
+            
+            console.log(`⏰ ORDER EXPIRED: ${orderHash}`);
+            console.log(`   Cancellation start: ${at}`);
+            await this.processRefund(orderHash, mapping);
+        });
+        
+        // Orders created before monitoring started
+        await this.checkExpiredOrders();
         
         console.log('✅ Refund monitoring started');
     }
     
     async checkExpiredOrders() {
-        try {
-            const currentTime = Math.floor(Date.now() / 1000);
-            
-            for (const [orderHash, mapping] of this.localDB.orderMappings) {
-                if (mapping.status === 'ORDER_CREATED' || mapping.status === 'ESCROW_CREATED') {
-                    // Get order details
-                    const order = await this.resolver.getCrossChainOrder(orderHash);
-                    
-                    if (currentTime > order.timelock) {
-                        console.log(`⏰ ORDER EXPIRED: ${orderHash}`);
-                        console.log(`   Timelock: ${order.timelock}`);
-                        console.log(`   Current Time: ${currentTime}`);
-                        
-                        // Process refund
-                        await this.processRefund(orderHash, mapping);
-                    }
-                }
+        const pending = [...this.localDB.orderMappings]
+            .filter(([, mapping]) => mapping.status === 'ORDER_CREATED' || mapping.status === 'ESCROW_CREATED')
+            .map(([orderHash]) => orderHash);
+        
+        if (this.orderLens && pending.length > 0) {
+            try {
+                await this.reconcileOrdersWithLens(pending);
+                return;
+            } catch (error) {
+                console.error('❌ Order lens read failed, falling back to per-order reads:', error.message);
             }
+        }
+        for (const orderHash of pending) {
+            await this.trackOrderTimelocks(orderHash);
+        }
+    }
+    
+    /**
+     * Restart reconciliation in one eth_call per lens chunk: settle what the chain
+     * already settled, arm refund timers for the rest
+     */
+    async reconcileOrdersWithLens(orderHashes) {
+        const states = await this.orderLens.getOrders(this.config.ethereum.resolverAddress, 'crossChainHTLC', orderHashes);
+        for (const [orderHash, state] of states) {
+            const mapping = this.localDB.orderMappings.get(orderHash);
+            if (state.status === 'filled' || state.status === 'cancelled') {
+                mapping.status = state.status === 'filled' ? 'COMPLETED' : 'REFUNDED';
+                this.localDB.orderMappings.set(orderHash, mapping);
+                console.log(`🔁 ${orderHash} already ${mapping.status} on-chain`);
+            } else if (state.status === 'unknown') {
+                console.log(`⚠️ ${orderHash} not found on the resolver`);
+            } else if (this.timelockScheduler) {
+                // Only the cancellation stage is scheduled here, so every stage can sit at the expiry
+                this.timelockScheduler.track(orderHash, Timelocks.pack(state.expiry, { publicWithdrawal: 0, cancellation: 0, publicCancellation: 0 }));
+            }
+        }
+        console.log(`🔭 Reconciled ${states.size} order(s) through the lens`);
+    }
+    
+    async trackOrderTimelocks(orderHash) {
+        if (!this.timelockScheduler) return;
+        try {
+            const order = await this.resolver.getCrossChainOrder(orderHash);
+            const timelocks = this.timelockScheduler.track(orderHash, order.timelocks);
+            console.log(`⏳ Refund timer armed for ${orderHash} at ${timelocks.get('srcCancellation')}`);
         } catch (error) {
-            console.error('❌ Error checking expired orders:', error.message);
+            console.error(`❌ Failed to read timelocks for ${orderHash}:`, error.message);
+        }
+    }
+    
+    /**
+     * Mirrored logic-signature HTLCs still funded at their timeout round go back to the relayer
+     */
+    async refundExpiredLogicSigHTLCs(currentRound) {
+        for (const [orderHash, mapping] of this.localDB.orderMappings) {
+            if (!mapping.logicSig || mapping.status !== 'ALGO_HTLC_CREATED' || currentRound < mapping.logicSig.timeoutRound) continue;
+            try {
+                const { txId } = await this.logicSigHTLC.refund(mapping.logicSig);
+                mapping.status = 'ALGO_REFUNDED';
+                mapping.refundTxId = txId;
+                mapping.refundedAt = new Date().toISOString();
+                this.localDB.orderMappings.set(orderHash, mapping);
+                log.info('Algorand logic-signature HTLC refunded', { orderHash, htlcId: mapping.htlcId, txId });
+            } catch (error) {
+                log.error('Algorand logic-signature refund failed', { orderHash, htlcId: mapping.htlcId, error: error.message });
+            }
         }
     }
     
@@ -758,6 +986,9 @@ class CompleteCrossChainRelayer {
         console.log('✅ Gasless user experience');
         console.log('==============================================\n');
         
+        // Catch up on secrets revealed while offline before re-arming watchers
+        await this.syncSecretStore();
+        
         // Start all monitoring services
         await this.startAlgorandMonitoring();
         await this.handleRefunds();
@@ -786,6 +1017,25 @@ class CompleteCrossChainRelayer {
         }, 300000); // Every 5 minutes
     }
     
+    /**
+     * Backfill SecretRevealed logs since the last run (or lookbackBlocks on first
+     * start), then follow new ones. Secrets are never read from resolver storage,
+     * so this works with setEventOnlySecrets(true).
+     */
+    async syncSecretStore() {
+        try {
+            const head = await this.ethProvider.getBlockNumber();
+            const fromBlock = this.secretStore.lastBlock
+                ? this.secretStore.lastBlock + 1
+                : Math.max(head - this.secretStore.lookbackBlocks + 1, 0);
+            const added = await this.secretStore.backfill(this.resolver, fromBlock, head);
+            this.secretStore.attach(this.resolver);
+            console.log(`🔑 Secret store synced to block ${head} (${added} new, ${this.secretStore.secrets.size} total)`);
+        } catch (error) {
+            console.error('❌ Secret store backfill failed:', error.message);
+        }
+    }
+    
     /**
      * 🔄 ETHEREUM MONITORING (ETH → ALGO direction)
      * Handle the reverse flow
@@ -818,6 +1068,7 @@ class CompleteCrossChainRelayer {
                 },
                 createdAt: new Date().toISOString()
             });
+            this.trackOrderTimelocks(orderHash);
             
             // Create mirrored Algorand HTLC
             await this.createMirroredAlgorandHTLC(orderHash, hashlock, amount, algorandAddress, timelock);
@@ -834,6 +1085,11 @@ class CompleteCrossChainRelayer {
             // Convert ETH amount to ALGO
             const algoAmount = this.convertEthToAlgo(ethAmount);
             
+            if (this.config.algorand.htlcMode === 'logicsig') {
+                await this.createMirroredLogicSigHTLC(orderHash, hashlock, algoAmount, algorandAddress, timelock);
+                return;
+            }
+            
             // Get suggested params
             const suggestedParams = await this.algoClient.getTransactionParams().do();
             
@@ -882,6 +1138,37 @@ class CompleteCrossChainRelayer {
         }
     }
     
+    /**
+     * Stateless mode: fund a per-swap escrow (one payment, no app state); the relayer is the refund address
+     */
+    async createMirroredLogicSigHTLC(orderHash, hashlock, algoAmount, algorandAddress, timelock) {
+        console.log('💰 RELAYER FUNDING LOGIC-SIGNATURE ESCROW...');
+        const { txId, round, address, swap } = await this.logicSigHTLC.create({
+            htlcId: orderHash,
+            hashlock,
+            timelock: Number(timelock),
+            recipient: algorandAddress,
+            amount: algoAmount
+        });
+        
+        console.log('✅ MIRRORED ALGORAND HTLC CREATED!');
+        console.log(`   Escrow: ${address}`);
+        console.log(`   Transaction ID: ${txId}`);
+        console.log(`   Confirmed in round: ${round}`);
+        console.log(`   Timeout round: ${swap.timeoutRound}`);
+        
+        const mapping = this.localDB.orderMappings.get(orderHash);
+        if (mapping) {
+            mapping.htlcId = address;
+            mapping.logicSig = swap;
+            mapping.status = 'ALGO_HTLC_CREATED';
+            this.localDB.orderMappings.set(orderHash, mapping);
+            this.localDB.logicSigEscrows.set(address, orderHash);
+        }
+        
+        this.monitorSecretReveal(orderHash);
+    }
+    
     convertEthToAlgo(ethAmount) {
         // Simple conversion (in production, use price feeds)
         const ethInWei = ethAmount.toString();
@@ -1037,11 +1324,9 @@ class CompleteCrossChainRelayer {
      * Monitors for new limit orders and places competitive bids
      */
     async monitorLOPOrders() {
-        console.log('\n🎯 MONITORING LOP ORDERS');
-        console.log('========================');
-        
         try {
             const currentBlock = await this.ethProvider.getBlockNumber();
+            log.sampled('lop-poll', 60000).debug('LOP poll', { fromBlock: this.lopState.lastCheckedBlock + 1, toBlock: currentBlock });
             
             // Check for new LimitOrderCreated events
             const events = await this.limitOrderBridge.queryFilter(
@@ -1053,11 +1338,7 @@ class CompleteCrossChainRelayer {
             for (const event of events) {
                 const { orderId, maker, makerToken, takerToken, makerAmount, takerAmount, deadline, algorandAddress, hashlock, timelock } = event.args;
                 
-                console.log(`📋 New LOP Order: ${orderId}`);
-                console.log(`   Maker: ${maker}`);
-                console.log(`   Amount: ${ethers.formatEther(makerAmount)} ETH`);
-                console.log(`   Target: ${ethers.formatEther(takerAmount)} ALGO`);
-                console.log(`   Deadline: ${new Date(Number(deadline) * 1000).toISOString()}`);
+                log.info('New LOP order', { orderId, maker, makerAmount, takerAmount, deadline: Number(deadline) });
                 
                 // Add to active orders
                 this.lopState.activeOrders.set(orderId, {
@@ -1081,7 +1362,7 @@ class CompleteCrossChainRelayer {
             this.lopState.lastCheckedBlock = currentBlock;
             
         } catch (error) {
-            console.error('❌ Error monitoring LOP orders:', error.message);
+            log.sampled('lop-poll-error', 30000).error('LOP poll failed', { error: error.message });
         }
     }
     
@@ -1090,21 +1371,19 @@ class CompleteCrossChainRelayer {
      * Analyzes order profitability and places competitive bid
      */
     async analyzeAndBid(orderId) {
-        console.log(`\n🏆 ANALYZING ORDER: ${orderId}`);
-        console.log('===============================');
+        const orderLog = log.child({ orderId });
         
         try {
             const order = this.lopState.activeOrders.get(orderId);
             if (!order) {
-                console.log('❌ Order not found in active orders');
+                orderLog.warn('Order not found in active orders');
                 return;
             }
             
-            // Check if we're authorized as resolver
-            const isAuthorized = await this.limitOrderBridge.authorizedResolvers(this.ethWallet.address);
-            if (!isAuthorized) {
-                console.log('⚠️ Relayer not authorized as resolver');
-                console.log('🔧 Need to authorize relayer on LimitOrderBridge');
+            // Only lanes authorized on the bridge may bid
+            const authorizedLanes = await this.getAuthorizedLanes();
+            if (authorizedLanes.length === 0) {
+                log.sampled('no-authorized-lane', 300000).warn('No pool wallet authorized as resolver on LimitOrderBridge');
                 return;
             }
             
@@ -1117,22 +1396,15 @@ class CompleteCrossChainRelayer {
             // Simple profitability check (in production, would include market rates)
             const profitMargin = (outputAmount - totalCost) / totalCost;
             
-            console.log('💰 Profitability Analysis:');
-            console.log(`   Input Amount: ${ethers.formatEther(inputAmount)} ETH`);
-            console.log(`   Output Amount: ${ethers.formatEther(outputAmount)} ALGO`);
-            console.log(`   Gas Cost: ${ethers.formatEther(gasCost)} ETH`);
-            console.log(`   Total Cost: ${ethers.formatEther(totalCost)} ETH`);
-            console.log(`   Profit Margin: ${(profitMargin * 100).toFixed(2)}%`);
+            const profitable = profitMargin >= this.minProfitMargin;
+            orderLog.info('Order analyzed', { inputAmount, outputAmount, gasCost, totalCost, profitMargin: Number(profitMargin), profitable });
             
-            if (profitMargin >= this.minProfitMargin) {
-                console.log('✅ Profitable order - placing bid!');
-                await this.placeBid(orderId, inputAmount, outputAmount);
-            } else {
-                console.log('❌ Order not profitable enough');
+            if (profitable) {
+                await this.placeBid(orderId, inputAmount, outputAmount, authorizedLanes);
             }
             
         } catch (error) {
-            console.error('❌ Error analyzing order:', error.message);
+            orderLog.error('Order analysis failed', { error: error.message });
         }
     }
     
@@ -1140,28 +1412,24 @@ class CompleteCrossChainRelayer {
      * 💰 PLACE BID ON LOP ORDER
      * Places a competitive bid on a limit order
      */
-    async placeBid(orderId, inputAmount, outputAmount) {
-        console.log(`\n💰 PLACING BID ON ORDER: ${orderId}`);
-        console.log('================================');
-        
+    async placeBid(orderId, inputAmount, outputAmount, authorizedLanes) {
         try {
-            const tx = await this.limitOrderBridge.placeBid(
-                orderId,
-                inputAmount,
-                outputAmount,
-                this.gasEstimate,
-                { gasLimit: 300000 }
-            );
-            
-            console.log(`⏳ Bid transaction submitted: ${tx.hash}`);
-            console.log(`🔗 Etherscan: https://sepolia.etherscan.io/tx/${tx.hash}`);
+            // The lane that bids is pinned to the order so it also executes the win
+            const { tx, receipt, lane } = await this.walletPool.submit(orderId, (signer, overrides) =>
+                this.limitOrderBridge.connect(signer).placeBid(
+                    orderId,
+                    inputAmount,
+                    outputAmount,
+                    this.gasEstimate,
+                    overrides
+                ), { gasLimit: 300000n, allowed: authorizedLanes });
             
-            const receipt = await tx.wait();
-            console.log(`✅ Bid placed successfully in block: ${receipt.blockNumber}`);
+            log.info('Bid placed', { orderId, lane, txHash: tx.hash, blockNumber: receipt.blockNumber });
             
             // Track our bid
             this.lopState.ourBids.set(orderId, {
                 orderId,
+                resolver: lane,
                 inputAmount,
                 outputAmount,
                 gasEstimate: this.gasEstimate,
@@ -1170,10 +1438,8 @@ class CompleteCrossChainRelayer {
                 timestamp: Date.now()
             });
             
-            console.log('✅ Bid placed and tracked!\n');
-            
         } catch (error) {
-            console.error('❌ Error placing bid:', error.message);
+            log.error('Bid placement failed', { orderId, error: error.message });
         }
     }
     
@@ -1182,8 +1448,7 @@ class CompleteCrossChainRelayer {
      * Checks if we have winning bids and executes them
      */
     async checkWinningBids() {
-        console.log('\n🏆 CHECKING FOR WINNING BIDS');
-        console.log('============================');
+        log.sampled('bid-check', 60000).debug('Checking our bids', { openBids: this.lopState.ourBids.size });
         
         try {
             for (const [orderId, bid] of this.lopState.ourBids) {
@@ -1191,29 +1456,27 @@ class CompleteCrossChainRelayer {
                 const order = await this.limitOrderBridge.limitOrders(orderId);
                 
                 if (order.filled) {
-                    console.log(`✅ Order ${orderId} has been filled`);
+                    const won = order.resolver === bid.resolver;
+                    log.info('Bid settled', { orderId, won, winner: order.resolver, lane: bid.resolver });
                     
-                    // Check if we won
-                    if (order.resolver === this.ethWallet.address) {
-                        console.log('🎉 WE WON THE BID!');
-                        console.log('🚀 Executing order...');
+                    // Check if we won (with the lane that placed the bid)
+                    if (won) {
                         
                         // Get the secret (in production, this would come from the order)
                         const secret = ethers.randomBytes(32); // Placeholder
                         
                         await this.executeWinningBid(orderId, secret);
-                    } else {
-                        console.log('❌ We lost the bid to another resolver');
                     }
                     
                     // Remove from tracking
                     this.lopState.ourBids.delete(orderId);
                     this.lopState.activeOrders.delete(orderId);
+                    this.walletPool.endSwap(orderId);
                 }
             }
             
         } catch (error) {
-            console.error('❌ Error checking winning bids:', error.message);
+            log.sampled('bid-check-error', 30000).error('Bid check failed', { error: error.message });
         }
     }
     
@@ -1228,10 +1491,12 @@ class CompleteCrossChainRelayer {
         try {
             // Get our bid index
             const bids = await this.limitOrderBridge.getBids(orderId);
+            const ourLane = this.walletPool.laneFor(orderId);
+            const ourAddress = ourLane ? ourLane.address : this.ethWallet.address;
             let ourBidIndex = 0;
             
             for (let i = 0; i < bids.length; i++) {
-                if (bids[i].resolver === this.ethWallet.address && bids[i].active) {
+                if (bids[i].resolver === ourAddress && bids[i].active) {
                     ourBidIndex = i;
                     break;
                 }
@@ -1240,17 +1505,16 @@ class CompleteCrossChainRelayer {
             console.log(`🎯 Executing with bid index: ${ourBidIndex}`);
             console.log(`🔑 Secret: ${secret}`);
             
-            const tx = await this.limitOrderBridge.selectBestBidAndExecute(
-                orderId,
-                ourBidIndex,
-                secret,
-                { gasLimit: 500000 }
-            );
+            const { tx, receipt } = await this.walletPool.submit(orderId, (signer, overrides) =>
+                this.limitOrderBridge.connect(signer).selectBestBidAndExecute(
+                    orderId,
+                    ourBidIndex,
+                    secret,
+                    overrides
+                ), { gasLimit: 500000n });
             
             console.log(`⏳ Execution transaction submitted: ${tx.hash}`);
             console.log(`🔗 Etherscan: https://sepolia.etherscan.io/tx/${tx.hash}`);
-            
-            const receipt = await tx.wait();
             console.log(`✅ Order executed successfully in block: ${receipt.blockNumber}`);
             
             console.log('🎉 WINNING BID EXECUTED SUCCESSFULLY!\n');
@@ -1260,6 +1524,34 @@ class CompleteCrossChainRelayer {
         }
     }
     
+    /**
+     * 🛤️ OWNER LANE
+     * CrossChainHTLCResolver's onlyOwner functions must be sent by its deployer,
+     * never by a resolver lane
+     */
+    getOwnerLanes() {
+        const owner = this.config.ethereum.resolverOwner;
+        if (!owner || !this.walletPool.hasAddress(owner)) {
+            throw new Error(`Resolver owner ${owner} is not a wallet pool lane`);
+        }
+        return [owner];
+    }
+    
+    /**
+     * 🛤️ AUTHORIZED POOL LANES
+     * Pool wallets allowed to bid on the LimitOrderBridge (cached for 5 minutes)
+     */
+    async getAuthorizedLanes() {
+        if (Date.now() - this.authorizedLanes.checkedAt < 5 * 60 * 1000) {
+            return this.authorizedLanes.addresses;
+        }
+        
+        const checks = await Promise.all(this.walletPool.lanes.map(async lane =>
+            (await this.limitOrderBridge.authorizedResolvers(lane.address)) ? lane.address : null));
+        this.authorizedLanes = { addresses: checks.filter(Boolean), checkedAt: Date.now() };
+        return this.authorizedLanes.addresses;
+    }
+    
     /**
      * 🔄 START LOP MONITORING
      * Starts the LOP monitoring loop
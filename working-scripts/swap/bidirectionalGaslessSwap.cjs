@@ -102,7 +102,8 @@ class BidirectionalGaslessSwap {
         const resolverABI = [
             'function createCrossChainHTLC(bytes32 hashlock, uint256 timelock, address token, uint256 amount, address recipient, string calldata algorandAddress) external payable returns (bytes32)',
             'function executeCrossChainSwap(bytes32 orderHash, bytes32 secret) external',
-            'function getCrossChainOrder(bytes32 orderHash) external view returns (address maker, address token, uint256 amount, address recipient, bytes32 hashlock, uint256 timelock, bool executed, bool refunded, address escrowSrc, address escrowDst)',
+            'function getCrossChainOrder(bytes32 orderHash) external view returns (tuple(bytes32 orderHash, bytes32 hashlock, uint256 timelocks, address token, uint256 amount, address recipient, string algorandAddress, address escrowSrc, address escrowDst, bool executed, bool refunded, address maker))',
+            'function getExpiry(bytes32 orderHash) external view returns (uint256)',
             'event CrossChainOrderCreated(bytes32 indexed orderHash, address indexed maker, address token, uint256 amount, bytes32 hashlock, uint256 timelock, string algorandAddress)'
         ];
         